@@ -170,10 +170,10 @@ typename cslib::AVLTree<T>::BinaryNode* cslib::AVLTree<T>::ms_balance(BinaryNode
         return p_subtree;
     }
 
-    Stack<BinaryNode*> last;
+    Scratch<BinaryNode*> last;
     last.push(nullptr);
 
-    Stack<BinaryNode*> stack;
+    Scratch<BinaryNode*> stack;
     stack.push(p_subtree);
 
     // Loop until stack is empty
@@ -303,6 +303,17 @@ typename cslib::AVLTree<T>::BinaryNode* cslib::AVLTree<T>::ms_balance_LeftRotati
     left->right = center->left;
     center->left = left;
 
+    // The parents follow
+    center->parent = left->parent;
+    left->parent = center;
+    if (left->right != nullptr) {
+        left->right->parent = left;
+    }
+
+    // The same nodes are under center as were under left, only the lowered one changes
+    BSTree<T>::ms_resize(left);
+    BSTree<T>::ms_resize(center);
+
     // Return new root
     return center;
 }
@@ -327,6 +338,16 @@ typename cslib::AVLTree<T>::BinaryNode* cslib::AVLTree<T>::ms_balance_RightRotat
     right->left = center->right;
     center->right = right;
 
+    // The parents follow
+    center->parent = right->parent;
+    right->parent = center;
+    if (right->left != nullptr) {
+        right->left->parent = right;
+    }
+
+    BSTree<T>::ms_resize(right);
+    BSTree<T>::ms_resize(center);
+
     return center;
 }
 
@@ -351,6 +372,21 @@ typename cslib::AVLTree<T>::BinaryNode* cslib::AVLTree<T>::ms_balance_LeftRightR
     center->right = right;
     center->left = left;
 
+    // The parents follow
+    center->parent = right->parent;
+    right->parent = center;
+    left->parent = center;
+    if (right->left != nullptr) {
+        right->left->parent = right;
+    }
+    if (left->right != nullptr) {
+        left->right->parent = left;
+    }
+
+    BSTree<T>::ms_resize(left);
+    BSTree<T>::ms_resize(right);
+    BSTree<T>::ms_resize(center);
+
     return center;
 }
 
@@ -374,6 +410,21 @@ typename cslib::AVLTree<T>::BinaryNode* cslib::AVLTree<T>::ms_balance_RightLeftR
     center->left = left;
     center->right = right;
 
+    // The parents follow
+    center->parent = left->parent;
+    left->parent = center;
+    right->parent = center;
+    if (left->right != nullptr) {
+        left->right->parent = left;
+    }
+    if (right->left != nullptr) {
+        right->left->parent = right;
+    }
+
+    BSTree<T>::ms_resize(left);
+    BSTree<T>::ms_resize(right);
+    BSTree<T>::ms_resize(center);
+
     return center;
 }
 
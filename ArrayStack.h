@@ -0,0 +1,603 @@
+/**
+ * @file ArrayStack.h
+ * @brief Holds the ArrayStack, a last-in-first out structure kept in arrays instead of nodes.
+ **/
+#ifndef CSARRAYSTACK_H
+#define CSARRAYSTACK_H
+
+#include "Universal.h"
+
+#include <new>
+
+/// The least amount of values the first chunk holds.
+#define ARRAYSTACK_CHUNK_MIN 32
+
+namespace cslib {
+    /**
+     * @class ArrayStack
+     * @tparam T Type of the data structure.
+     * @brief A Last-in-first out structure where values sit in arrays.
+     *
+     * Values go into a chain of chunks, each at least as big as all the ones under it, so
+     * growing never moves a value and pushing only allocates O(log n) times. The last chunk
+     * that emptied is kept as a spare, so pushing and popping around a chunk's edge doesn't
+     * allocate either.
+     **/
+    template<typename T>
+    class ArrayStack {
+    protected:
+        /**
+         * @struct Chunk
+         * @brief An array of values with the chunk under it
+         **/
+        struct Chunk {
+            /// The chunk under this one, full
+            Chunk* below;
+            /// The values
+            T* data;
+            /// How many values fit
+            size_t capacity;
+            /// How many values are in it
+            size_t count;
+        };
+
+    public:
+        /**
+         * @class Iterator
+         * @brief Walks the stack from the top to the bottom.
+         **/
+        class Iterator : public cslib::Iterator<T> {
+        public:
+            /**
+             * @param p_chunk The chunk we're in
+             * @param p_offset One more than the index in the chunk, 0 for the end
+             *
+             * @brief Constructs the Iterator
+             */
+            Iterator(Chunk* p_chunk = nullptr, size_t p_offset = 0);
+
+            /**
+             * @brief Gets the value below
+             * @return Returns the value that was next
+             */
+            Iterator& operator++();
+
+            /**
+             * @brief Gets the value below
+             * @return Returns the value before moving
+             */
+            Iterator  operator++(int);
+
+        private:
+            /// The chunk we're in
+            Chunk* m_chunk;
+
+            /// One more than the index in the chunk
+            size_t m_offset;
+        };
+
+        /**
+         * @class ConstIterator
+         * @brief Walks the stack from the top to the bottom.
+         **/
+        class ConstIterator : public cslib::ConstIterator<T> {
+        public:
+            /**
+             * @param p_chunk The chunk we're in
+             * @param p_offset One more than the index in the chunk, 0 for the end
+             *
+             * @brief Constructs the Iterator
+             */
+            ConstIterator(const Chunk* p_chunk = nullptr, size_t p_offset = 0);
+
+            /**
+             * @brief Gets the value below
+             * @return Returns the value that was next
+             */
+            ConstIterator& operator++();
+
+            /**
+             * @brief Gets the value below
+             * @return Returns the value before moving
+             */
+            ConstIterator  operator++(int);
+
+        private:
+            /// The chunk we're in
+            const Chunk* m_chunk;
+
+            /// One more than the index in the chunk
+            size_t m_offset;
+        };
+
+        /**
+         * @brief Constructs the class, nothing is allocated until the first push
+         */
+        ArrayStack();
+
+        /**
+         * @brief Deep copies the stack into one chunk
+         */
+        ArrayStack(const ArrayStack<T>& p_stack);
+
+        /**
+         * @brief Deep copies the stack.
+         * @return Returns "this" data structure
+         */
+        ArrayStack<T>& operator= (const ArrayStack<T>& p_stack);
+
+        /**
+         * @brief Destroys the class
+         */
+        ~ArrayStack();
+
+        /**
+         * @brief Returns the size of the stack, O(1).
+         * @return Returns the size of a stack.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if there is no data in the data structure.
+         * @return True if empty, false if at least one item.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Gets the top value of the stack without poping.
+         * @return Top value of the stack.
+         */
+        T& top();
+
+        /**
+         * @brief Gets the top value of the stack without poping.
+         * @return Top value of the stack.
+         */
+        const T& top() const;
+
+        /**
+         * @brief Removes the top value from the stack.
+         * @return Gives the popped value back
+         */
+        T  pop();
+
+        /**
+         * @param p_data The data we are adding to the top of the stack.
+         *
+         * @brief Adds the parameter into the top of the stack
+         * @return Top value of the stack.
+         */
+        T& push(const T& p_data);
+
+        /**
+         * @param p_size The amount of values we want room for
+         *
+         * @brief Makes room so the stack can hold that many values without allocating
+         */
+        void reserve(size_t p_size);
+
+        /**
+         * @param p_data The values, the last one ends up on top
+         * @param p_count How many values
+         *
+         * @brief Pushes all the values with at most one allocation
+         */
+        void pushMany(const T* p_data, size_t p_count);
+
+        /**
+         * @param p_data Gets the values in the order they were popped
+         * @param p_count The most values we want
+         *
+         * @brief Pops values until there are none or we have enough
+         * @return Returns how many were popped
+         */
+        size_t popMany(T* p_data, size_t p_count);
+
+        /**
+         * @brief Removes every value, keeps the biggest chunk
+         */
+        void clear();
+
+        /**
+         * @brief Gets the top value of the stack by iterator.
+         * @return Iterator representing top of the stack
+         */
+        Iterator begin();
+
+        /**
+         * @brief Gets the top value of the stack by iterator.
+         * @return Iterator representing top of the stack
+         */
+        ConstIterator cbegin() const;
+
+        /**
+         * @brief Gets the value right after the end of the stack by iterator.
+         * @return Iterator representing past the bottom of the stack
+         */
+        Iterator end();
+
+        /**
+         * @brief Gets the value right after the end of the stack by iterator.
+         * @return Iterator representing past the bottom of the stack
+         */
+        ConstIterator cend() const;
+
+    protected:
+        /**
+         * @param p_capacity How many values it holds
+         *
+         * @brief Allocates an empty chunk
+         * @return Returns the chunk
+         */
+        static Chunk* ms_createChunk(size_t p_capacity);
+
+        /**
+         * @param p_chunk The chunk, its values must already be destroyed
+         *
+         * @brief Frees a chunk
+         */
+        static void ms_destroyChunk(Chunk* p_chunk);
+
+        /**
+         * @param p_least The least amount of free room wanted
+         *
+         * @brief Puts a chunk with room on top, the spare if it is big enough
+         */
+        void m_grow(size_t p_least);
+
+        /**
+         * @brief Takes the empty top chunk off, keeping it as the spare if it is bigger
+         */
+        void m_shrink();
+
+        /// The chunk on top, nullptr if nothing was ever pushed
+        Chunk* m_top;
+
+        /// An empty chunk we can grow into
+        Chunk* m_spare;
+
+        /// The amount of values
+        size_t m_size;
+
+        /// How many values the chunks in use hold
+        size_t m_capacity;
+    };
+}
+
+template<typename T>
+cslib::ArrayStack<T>::ArrayStack() : m_top(nullptr), m_spare(nullptr), m_size(0), m_capacity(0) {
+
+}
+
+template<typename T>
+cslib::ArrayStack<T>::ArrayStack(const ArrayStack<T>& p_stack) : m_top(nullptr), m_spare(nullptr), m_size(0), m_capacity(0) {
+    *this = p_stack;
+}
+
+template<typename T>
+cslib::ArrayStack<T>& cslib::ArrayStack<T>::operator= (const ArrayStack<T>& p_stack) {
+    if (this == &p_stack) {
+        return *this;
+    }
+
+    this->clear();
+    this->reserve(p_stack.m_size);
+
+    // Bottom chunk first, the chain only points down so collect them on the way
+    size_t chunks = 0;
+    for (const Chunk* chunk = p_stack.m_top; chunk != nullptr; chunk = chunk->below) {
+        chunks++;
+    }
+    for (size_t i = chunks; i > 0; i--) {
+        const Chunk* chunk = p_stack.m_top;
+        for (size_t j = 1; j < i; j++) {
+            chunk = chunk->below;
+        }
+        this->pushMany(chunk->data, chunk->count);
+    }
+    return *this;
+}
+
+template<typename T>
+cslib::ArrayStack<T>::~ArrayStack() {
+    this->clear();
+    if (this->m_top != nullptr) {
+        ms_destroyChunk(this->m_top);
+    }
+    if (this->m_spare != nullptr) {
+        ms_destroyChunk(this->m_spare);
+    }
+}
+
+template<typename T>
+size_t cslib::ArrayStack<T>::size() const {
+    return this->m_size;
+}
+
+template<typename T>
+bool cslib::ArrayStack<T>::empty() const {
+    return (this->m_size == 0);
+}
+
+template<typename T>
+T& cslib::ArrayStack<T>::top() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_top->data[this->m_top->count - 1];
+}
+
+template<typename T>
+const T& cslib::ArrayStack<T>::top() const {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_top->data[this->m_top->count - 1];
+}
+
+template<typename T>
+T cslib::ArrayStack<T>::pop() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+
+    // Take the value off the top
+    Chunk* chunk = this->m_top;
+    T* value = &chunk->data[chunk->count - 1];
+    T temp = *value;
+    value->~T();
+    chunk->count--;
+    this->m_size--;
+
+    // Step down a chunk once this one empties
+    if (chunk->count == 0 && chunk->below != nullptr) {
+        this->m_shrink();
+    }
+    return temp;
+}
+
+template<typename T>
+T& cslib::ArrayStack<T>::push(const T& p_data) {
+    if (this->m_top == nullptr || this->m_top->count == this->m_top->capacity) {
+        this->m_grow(1);
+    }
+
+    Chunk* chunk = this->m_top;
+    T* value = new (&chunk->data[chunk->count]) T(p_data);
+    chunk->count++;
+    this->m_size++;
+    return *value;
+}
+
+template<typename T>
+void cslib::ArrayStack<T>::reserve(size_t p_size) {
+    // The chunks under the top are full, so the only room is on top
+    size_t room = this->m_capacity - this->m_size;
+    if (this->m_size + room >= p_size) {
+        return;
+    }
+
+    // Anything else has to fit in the spare
+    size_t needed = p_size - this->m_size - room;
+    if (this->m_spare != nullptr) {
+        if (this->m_spare->capacity >= needed) {
+            return;
+        }
+        ms_destroyChunk(this->m_spare);
+        this->m_spare = nullptr;
+    }
+    this->m_spare = ms_createChunk(needed);
+}
+
+template<typename T>
+void cslib::ArrayStack<T>::pushMany(const T* p_data, size_t p_count) {
+    size_t i = 0;
+    while (i < p_count) {
+        // Grow to fit the rest in one go
+        if (this->m_top == nullptr || this->m_top->count == this->m_top->capacity) {
+            this->m_grow(p_count - i);
+        }
+
+        // Fill what fits in this chunk
+        Chunk* chunk = this->m_top;
+        size_t fit = chunk->capacity - chunk->count;
+        if (fit > p_count - i) {
+            fit = p_count - i;
+        }
+        for (size_t j = 0; j < fit; j++) {
+            new (&chunk->data[chunk->count]) T(p_data[i]);
+            chunk->count++;
+            i++;
+        }
+        this->m_size += fit;
+    }
+}
+
+template<typename T>
+size_t cslib::ArrayStack<T>::popMany(T* p_data, size_t p_count) {
+    size_t popped = 0;
+    while (popped < p_count && this->m_size > 0) {
+        // Empty what we can from this chunk
+        Chunk* chunk = this->m_top;
+        while (popped < p_count && chunk->count > 0) {
+            T* value = &chunk->data[chunk->count - 1];
+            p_data[popped] = *value;
+            value->~T();
+            chunk->count--;
+            popped++;
+            this->m_size--;
+        }
+
+        if (chunk->count == 0 && chunk->below != nullptr) {
+            this->m_shrink();
+        }
+    }
+    return popped;
+}
+
+template<typename T>
+void cslib::ArrayStack<T>::clear() {
+    while (this->m_top != nullptr) {
+        Chunk* chunk = this->m_top;
+        for (size_t i = 0; i < chunk->count; i++) {
+            chunk->data[i].~T();
+        }
+        chunk->count = 0;
+
+        // Keep the bottom, the biggest goes to the spare
+        if (chunk->below == nullptr) {
+            break;
+        }
+        this->m_shrink();
+    }
+    this->m_size = 0;
+}
+
+template<typename T>
+typename cslib::ArrayStack<T>::Iterator cslib::ArrayStack<T>::begin() {
+    if (this->empty()) {
+        return Iterator();
+    }
+    return Iterator(this->m_top, this->m_top->count);
+}
+
+template<typename T>
+typename cslib::ArrayStack<T>::ConstIterator cslib::ArrayStack<T>::cbegin() const {
+    if (this->empty()) {
+        return ConstIterator();
+    }
+    return ConstIterator(this->m_top, this->m_top->count);
+}
+
+template<typename T>
+typename cslib::ArrayStack<T>::Iterator cslib::ArrayStack<T>::end() {
+    return Iterator();
+}
+
+template<typename T>
+typename cslib::ArrayStack<T>::ConstIterator cslib::ArrayStack<T>::cend() const {
+    return ConstIterator();
+}
+
+template<typename T>
+typename cslib::ArrayStack<T>::Chunk* cslib::ArrayStack<T>::ms_createChunk(size_t p_capacity) {
+    Chunk* chunk = new Chunk{ nullptr, nullptr, p_capacity, 0 };
+    try {
+        chunk->data = static_cast<T*>(::operator new(sizeof(T) * p_capacity, std::align_val_t(alignof(T))));
+    } catch (...) {
+        delete chunk;
+        throw;
+    }
+    return chunk;
+}
+
+template<typename T>
+void cslib::ArrayStack<T>::ms_destroyChunk(Chunk* p_chunk) {
+    ::operator delete(p_chunk->data, std::align_val_t(alignof(T)));
+    delete p_chunk;
+}
+
+template<typename T>
+void cslib::ArrayStack<T>::m_grow(size_t p_least) {
+    // The current top might be the empty bottom
+    if (this->m_top != nullptr && this->m_top->count < this->m_top->capacity) {
+        return;
+    }
+
+    // As big as everything under it, so the chunks double
+    size_t capacity = (this->m_capacity < ARRAYSTACK_CHUNK_MIN) ? ARRAYSTACK_CHUNK_MIN : this->m_capacity;
+    if (capacity < p_least) {
+        capacity = p_least;
+    }
+
+    Chunk* chunk = nullptr;
+    if (this->m_spare != nullptr && this->m_spare->capacity >= p_least) {
+        chunk = this->m_spare;
+        this->m_spare = nullptr;
+    } else {
+        chunk = ms_createChunk(capacity);
+    }
+
+    chunk->below = this->m_top;
+    this->m_top = chunk;
+    this->m_capacity += chunk->capacity;
+}
+
+template<typename T>
+void cslib::ArrayStack<T>::m_shrink() {
+    Chunk* chunk = this->m_top;
+    this->m_top = chunk->below;
+    this->m_capacity -= chunk->capacity;
+    chunk->below = nullptr;
+
+    // Keep whichever spare is bigger
+    if (this->m_spare == nullptr) {
+        this->m_spare = chunk;
+    } else if (this->m_spare->capacity < chunk->capacity) {
+        ms_destroyChunk(this->m_spare);
+        this->m_spare = chunk;
+    } else {
+        ms_destroyChunk(chunk);
+    }
+}
+
+
+
+
+
+
+
+
+
+
+
+template<typename T>
+cslib::ArrayStack<T>::Iterator::Iterator(Chunk* p_chunk, size_t p_offset) : m_chunk(p_chunk), m_offset(p_offset) {
+    this->m_ptr = (p_chunk == nullptr) ? nullptr : &p_chunk->data[p_offset - 1];
+}
+
+template<typename T>
+typename cslib::ArrayStack<T>::Iterator& cslib::ArrayStack<T>::Iterator::operator++() {
+    // Next one down, into the chunk below when this one runs out
+    this->m_offset--;
+    if (this->m_offset == 0) {
+        this->m_chunk = this->m_chunk->below;
+        this->m_offset = (this->m_chunk == nullptr) ? 0 : this->m_chunk->count;
+    }
+    this->m_ptr = (this->m_chunk == nullptr) ? nullptr : &this->m_chunk->data[this->m_offset - 1];
+    return *this;
+}
+
+template<typename T>
+typename cslib::ArrayStack<T>::Iterator cslib::ArrayStack<T>::Iterator::operator++(int) {
+    Iterator cpy = *this;
+    ++(*this);
+    return cpy;
+}
+
+template<typename T>
+cslib::ArrayStack<T>::ConstIterator::ConstIterator(const Chunk* p_chunk, size_t p_offset) : m_chunk(p_chunk), m_offset(p_offset) {
+    this->m_ptr = (p_chunk == nullptr) ? nullptr : &p_chunk->data[p_offset - 1];
+}
+
+template<typename T>
+typename cslib::ArrayStack<T>::ConstIterator& cslib::ArrayStack<T>::ConstIterator::operator++() {
+    // Next one down, into the chunk below when this one runs out
+    this->m_offset--;
+    if (this->m_offset == 0) {
+        this->m_chunk = this->m_chunk->below;
+        this->m_offset = (this->m_chunk == nullptr) ? 0 : this->m_chunk->count;
+    }
+    this->m_ptr = (this->m_chunk == nullptr) ? nullptr : &this->m_chunk->data[this->m_offset - 1];
+    return *this;
+}
+
+template<typename T>
+typename cslib::ArrayStack<T>::ConstIterator cslib::ArrayStack<T>::ConstIterator::operator++(int) {
+    ConstIterator cpy = *this;
+    ++(*this);
+    return cpy;
+}
+
+
+#endif
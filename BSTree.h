@@ -12,6 +12,7 @@
 #include "Stack.h"
 #include "Queue.h"
 #include "Vector.h"
+#include "Scratch.h"
 
 namespace cslib {
 
@@ -63,7 +64,88 @@ namespace cslib {
 
     template<typename T>
     class BSTree {
+    protected:
+        /**
+         * @struct BinaryNode
+         * @brief Each node in the tree
+         **/
+        struct BinaryNode {
+            /// The data value that represents the node
+            T data;
+
+            /// The node to the left of this node (will be smaller)
+            BinaryNode* left;
+
+            /// The node to the right of this node (will be bigger)
+            BinaryNode* right;
+
+            /// The node above this one, nullptr for the root
+            BinaryNode* parent;
+
+            /// How many nodes the subtree under this one holds, itself included
+            size_t size;
+        };
+
     public:
+        /**
+         * @class ConstIterator
+         * @brief Walks the tree in order, smallest first, can go forward and back.
+         *
+         * Each step follows the parent pointers, so a whole walk is O(n) and needs no memory.
+         * end() sits past both ends, -- from it gets the biggest value and ++ gets the smallest.
+         * There is no reverse iterator, walk back from last() with -- until it equals end().
+         **/
+        class ConstIterator : public cslib::ConstIterator<BinaryNode> {
+        public:
+            /**
+             * @param p_ptr The pointer of the Const Iterator
+             * @param p_tree The tree it walks, needed to step off end()
+             *
+             * @brief Constructs the Iterator
+             */
+            ConstIterator(const BinaryNode* p_ptr = nullptr, const BSTree<T>* p_tree = nullptr);
+
+            /**
+             * @brief Gets the next bigger value
+             * @return Returns the value that was next
+             */
+            ConstIterator& operator++();
+
+            /**
+             * @brief Gets the next bigger value
+             * @return Returns the value before moving
+             */
+            ConstIterator  operator++(int);
+
+            /**
+             * @brief Gets the next smaller value
+             * @return Returns the value that was before
+             */
+            ConstIterator& operator--();
+
+            /**
+             * @brief Gets the next smaller value
+             * @return Returns the value before moving
+             */
+            ConstIterator  operator--(int);
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            const T& operator* ();
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            const T* operator->();
+
+        protected:
+            /// The tree it walks
+            const BSTree<T>* m_tree;
+        };
+
         /**
          * @brief Constructs the class
          */
@@ -160,6 +242,58 @@ namespace cslib {
          */
         size_t amount() const;
 
+        /**
+         * @param p_index How many values are smaller than the one we want, 0 for the smallest
+         * @brief Gets the value at that place in order, in O(depth)
+         * @return Returns the value
+         */
+        const T& select(size_t p_index) const;
+
+        /**
+         * @param p_key The value we're comparing with, doesn't need to be in the tree
+         * @brief Counts the values smaller than the key, in O(depth)
+         * @return Returns where the key is or would go in order
+         */
+        size_t rank(const T& p_key) const;
+
+        /**
+         * @param p_key The value we're comparing with, doesn't need to be in the tree
+         * @brief Finds the smallest value that isn't smaller than the key
+         * @return Returns a iterator to the node, end() if every value is smaller
+         */
+        ConstIterator lowerBound(const T& p_key) const;
+
+        /**
+         * @param p_key The value we're comparing with, doesn't need to be in the tree
+         * @brief Finds the smallest value bigger than the key, lowerBound(lo) to upperBound(hi) walks lo to hi
+         * @return Returns a iterator to the node, end() if no value is bigger
+         */
+        ConstIterator upperBound(const T& p_key) const;
+
+        /**
+         * @param p_key The value we're comparing with, doesn't need to be in the tree
+         * @brief Finds the biggest value that isn't bigger than the key
+         * @return Returns the value
+         */
+        const T& floor(const T& p_key) const;
+
+        /**
+         * @param p_key The value we're comparing with, doesn't need to be in the tree
+         * @brief Finds the smallest value that isn't smaller than the key
+         * @return Returns the value
+         */
+        const T& ceiling(const T& p_key) const;
+
+        /**
+         * @tparam TF The function type that we're going to play
+         * @param p_low The smallest value we want
+         * @param p_high The value we stop before
+         * @param p_func The function we're going to play on each value between them, in order
+         * @brief Plays the values in [low, high) like ConcurrentSkipList::range(), only going past the nodes that lead to them
+         */
+        template<typename TF>
+        void range(const T& p_low, const T& p_high, TF&& p_func) const;
+
         /**
          * @brief Returns true if there is no data in the tree
          * @return Returns true if tree is empty, false if it has some data
@@ -170,22 +304,114 @@ namespace cslib {
          * @brief Clears the tree of all contents
          */
         void clear();
+
+        /**
+         * @brief Gets the iterator to the smallest value.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator begin() const;
+
+        /**
+         * @brief Gets the iterator to the value after the biggest.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator end() const;
+
+        /**
+         * @brief Gets the iterator to the smallest value.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator cbegin() const;
+
+        /**
+         * @brief Gets the iterator to the value after the biggest.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator cend() const;
+
+        /**
+         * @brief Gets the iterator to the biggest value, walk it with -- until it equals end()
+         * @return Returns a iterator to the node
+         */
+        ConstIterator last() const;
     
     protected:
         /**
-         * @struct BinaryNode
-         * @brief Each node in the tree
-         **/
-        struct BinaryNode {
-            /// The data value that represents the node
-            T data;
+         * @param p_node The root of a subtree
+         * @brief Gets the smallest node of the subtree
+         * @return Returns the node
+         */
+        static BinaryNode* ms_leftmost(BinaryNode* p_node);
 
-            /// The node to the left of this node (will be smaller)
-            BinaryNode* left;
+        /**
+         * @param p_node The root of a subtree
+         * @brief Gets the biggest node of the subtree
+         * @return Returns the node
+         */
+        static BinaryNode* ms_rightmost(BinaryNode* p_node);
 
-            /// The node to the right of this node (will be bigger)
-            BinaryNode* right;
-        };
+        /**
+         * @param p_node The node
+         * @brief Gets the node with the next bigger value
+         * @return Returns the node, nullptr if it was the biggest
+         */
+        static BinaryNode* ms_next(const BinaryNode* p_node);
+
+        /**
+         * @param p_node The node
+         * @brief Gets the node with the next smaller value
+         * @return Returns the node, nullptr if it was the smallest
+         */
+        static BinaryNode* ms_prev(const BinaryNode* p_node);
+
+        /**
+         * @param p_node The root of a subtree, can be nullptr
+         * @brief Gets how many nodes the subtree holds
+         * @return Returns the size, 0 for nullptr
+         */
+        static size_t ms_size(const BinaryNode* p_node);
+
+        /**
+         * @param p_node The node
+         * @brief Sets the size of the node from its children, used once they've moved
+         */
+        static void ms_resize(BinaryNode* p_node);
+
+        /**
+         * @param p_node The lowest node that changed
+         * @param p_amount How many nodes it gained
+         * @brief Adds to the size of the node and of every node above it
+         */
+        static void ms_grow(BinaryNode* p_node, size_t p_amount);
+
+        /**
+         * @param p_node The lowest node that changed
+         * @param p_amount How many nodes it lost
+         * @brief Takes from the size of the node and of every node above it
+         */
+        static void ms_shrink(BinaryNode* p_node, size_t p_amount);
+
+        /**
+         * @param p_key The value we're comparing with
+         * @param p_equal If a node equal to the key counts
+         * @brief Finds the smallest node bigger than the key, or equal to it if asked
+         * @return Returns the node, nullptr if there is none
+         */
+        BinaryNode* m_above(const T& p_key, bool p_equal) const;
+
+        /**
+         * @param p_key The value we're comparing with
+         * @brief Finds the biggest node that isn't bigger than the key
+         * @return Returns the node, nullptr if there is none
+         */
+        BinaryNode* m_floor(const T& p_key) const;
+
+        /**
+         * @param p_node The node being taken out
+         * @param p_child What goes in its place, can be nullptr
+         * @brief Links the child to the parent of the node instead of the node
+         */
+        void m_replace(BinaryNode* p_node, BinaryNode* p_child);
 
         /**
          * @param p_bst The binary search tree we are copying
@@ -200,7 +426,9 @@ namespace cslib {
 
         /**
          * @param p_bst The binary search tree we're adding.
-         * @brief Adds another tree into this tree
+         * @brief Adds another tree into this tree, its values all have to fall between the same two values here.
+         *
+         * The nodes are linked in, not copied, so p_bst has to let go of them afterwards.
          */
         void m_addSubtree(const BSTree<T>& p_bst);
 
@@ -255,7 +483,7 @@ cslib::BSTree<T>::BSTree() : m_root(nullptr) {
 }
 
 template<typename T>
-cslib::BSTree<T>::BSTree(const BSTree<T>& p_bst) {
+cslib::BSTree<T>::BSTree(const BSTree<T>& p_bst) : m_root(nullptr) {
     m_copy(p_bst);
 }
 
@@ -297,71 +525,36 @@ const T& cslib::BSTree<T>::search(const T& p_key) const {
 
 template<typename T>
 T cslib::BSTree<T>::remove(const T& p_key) {
-    // Create node
-    BinaryNode* node = this->m_create(p_key);
+    // Find the node
+    BinaryNode* node = this->m_root;
+    while (node != nullptr) {
+        if (node->data > p_key) {
+            node = node->left;
+        } else if (node->data < p_key) {
+            node = node->right;
+        } else {
+            break;
+        }
+    }
 
-    // If empty
-    if (this->m_root == nullptr) {                
+    if (node == nullptr) {
         throw BSTNodeNotFound();
     }
+    T data = node->data;
 
-    // First we start off at the root and slowly make our way down the tree...
-    BinaryNode* last = this->m_root;
-    BinaryNode* current = this->m_root;
-    while (current != nullptr) {
-        // If the data is equal.
-        if (current->data == p_key) {
-            // Get the left and right of our old 
-            BinaryNode* left = current->left;
-            BinaryNode* right = current->right;
-
-            bool isLeft = (last->left == current);
-            bool isRight = (last->right == current);
-
-            delete current;
-            current = nullptr;
-            
-            // If the data was on the left of the last node
-            if (isLeft) {
-                last->left = left;
-
-                current = last->left;
-                while (current != nullptr) {
-                    last = current;
-                    current = current->right;
-                }
-
-                last->right = right;
-
-                return p_key;
-            }
-
-            // If the data was on the right of the last node
-            else if (isRight) {
-                last->right = right;
-
-                current = last->right;
-                while (current->left != nullptr) {
-                    last = current;
-                    current = current->left;
-                }
-
-                last->left = right;
-            }
-        }
-
-        else if (current->data > p_key) {
-            last = current;
-            current = current->left;
-        }
-
-        else if (current->data < p_key) {
-            last = current;
-            current = current->right;
-        }
+    // With two children, the next bigger value takes its place and that node goes instead
+    if (node->left != nullptr && node->right != nullptr) {
+        BinaryNode* next = ms_leftmost(node->right);
+        node->data = next->data;
+        node = next;
     }
 
-    throw BSTNodeNotFound();
+    // At most one child left, it moves up
+    ms_shrink(node->parent, 1);
+    this->m_replace(node, (node->left != nullptr) ? node->left : node->right);
+    delete node;
+
+    return data;
 }
 
 template<typename T>
@@ -386,7 +579,9 @@ const T& cslib::BSTree<T>::insert(const T& p_key) {
             if (current->left == nullptr) {
                 // Set it
                 current->left = node;
-                return node->data;;
+                node->parent = current;
+                ms_grow(current, 1);
+                return node->data;
             }
             current = current->left;
 
@@ -397,6 +592,8 @@ const T& cslib::BSTree<T>::insert(const T& p_key) {
             if (current->right == nullptr) {
                 // Set it
                 current->right = node;
+                node->parent = current;
+                ms_grow(current, 1);
                 return node->data;
             }
 
@@ -415,51 +612,9 @@ const T& cslib::BSTree<T>::insert(const T& p_key) {
 
 template<typename T> template<typename TF>
 void cslib::BSTree<T>::inorder(TF&& p_func) const {
-    // If empty
-    if (this->m_root == nullptr) {
-        return;
-    }
-    
-    // First, we want to add our root
-    const size_t nodeSize = this->amount();
-    Stack<BinaryNode*> stack;
-    Vector<BinaryNode*> visited(nodeSize);
-
-    stack  .push(this->m_root);
-    visited.push(this->m_root);
-
-    // If the address is in the vector.
-    auto exists = [&](const BinaryNode* p) {
-        for (size_t i = 0; i < visited.size(); i++) {
-            if (visited[i] == p) {
-                return true;
-            }
-        }
-        return false;
-    };
-
-    while (!stack.empty()) {
-        // First we will check if the top of the stack has any left nodes.
-        BinaryNode* node = stack.top();
-
-        // If it does have a left node, we will play that first.
-        if (node->left != nullptr && !exists(node->left)) {
-            stack.push(node->left);
-            visited.push(node->left);
-        }
-
-        // If we do not have antoher node to the left
-        else {
-            // Play "this node"
-            stack.pop();
-            p_func(node->data);
-
-            // Add the right to the stack...
-            if (node->right != nullptr) {
-                stack.push(node->right);
-                visited.push(node->right);
-            }
-        }
+    // Smallest first, each step follows the parents so every edge is walked twice at most
+    for (BinaryNode* node = ms_leftmost(this->m_root); node != nullptr; node = ms_next(node)) {
+        p_func(node->data);
     }
 }
 
@@ -471,7 +626,7 @@ void cslib::BSTree<T>::preorder(TF&& p_func) const {
     }
 
     // Root -> Left -> Right
-    Stack<BinaryNode*> stack;
+    Scratch<BinaryNode*> stack;
     stack.push(this->m_root);
 
     while (!stack.empty()) {
@@ -493,47 +648,34 @@ void cslib::BSTree<T>::preorder(TF&& p_func) const {
 
 template<typename T> template<typename TF>
 void cslib::BSTree<T>::postorder(TF&& p_func) const {
-    // If empty
-    if (this->m_root == nullptr) {
-        return;
-    }
-
-    // Left->Right->Root
-    Stack<BinaryNode*> stack;
-    stack.push(this->m_root);
-
-    Vector<BinaryNode*> visited( this->amount() );
-    visited.push(this->m_root);
-
-    auto exists = [&](const BinaryNode* p) {
-        for (size_t i = 0; i < visited.size(); i++) {
-            if (visited[i] == p) {
-                return true;
+    // Left->Right->Root, where we came from tells us what's left to do
+    BinaryNode* last = nullptr;
+    BinaryNode* node = this->m_root;
+    while (node != nullptr) {
+        // Coming down, go left first, then right
+        if (last == node->parent) {
+            last = node;
+            if (node->left != nullptr) {
+                node = node->left;
+                continue;
+            }
+            if (node->right != nullptr) {
+                node = node->right;
+                continue;
             }
-        }
-        return false;
-    };
-
-    while (!stack.empty()) {
-        BinaryNode* node = stack.top();
-
-        bool goRight = node->right != nullptr && !exists(node->right);
-        bool goLeft = node->left != nullptr && !exists(node->left);
-
-        if (goRight) {
-            stack.push(node->right);
-            visited.push(node->right);
         }
 
-        if (goLeft) {
-            stack.push(node->left);
-            visited.push(node->left);
+        // Back from the left, the right is next
+        else if (last == node->left && node->right != nullptr) {
+            last = node;
+            node = node->right;
+            continue;
         }
 
-        if (!goRight && !goLeft) {
-            node = stack.pop();
-            p_func(node->data);
-        }
+        // Both sides are done
+        p_func(node->data);
+        last = node;
+        node = node->parent;
     }
 }
 
@@ -546,7 +688,7 @@ void cslib::BSTree<T>::depthFirst(TF&& p_func) const {
     }
 
     // Stack based search
-    Stack<BinaryNode*> stack;
+    Scratch<BinaryNode*> stack;
     stack.push(this->m_root);
 
     while (!stack.empty()) {
@@ -574,22 +716,22 @@ void cslib::BSTree<T>::breadthFirst(TF&& p_func) const {
     }
 
     // Queue based search
-    Queue<BinaryNode*> queue;
+    Scratch<BinaryNode*> queue;
 
     // Add the root node.
-    queue.enqueue(this->m_root);
+    queue.push(this->m_root);
     while (!queue.empty()) {
         // Get top node
-        BinaryNode* node = queue.dequeue();
+        BinaryNode* node = queue.popFront();
 
         // Play the function
         p_func(node->data);
 
         if (node->left != nullptr) {
-            queue.enqueue(node->left);
+            queue.push(node->left);
         }
         if (node->right != nullptr) {
-            queue.enqueue(node->right);
+            queue.push(node->right);
         }
     }
 }
@@ -606,7 +748,7 @@ size_t cslib::BSTree<T>::depth() const {
         BinaryNode* node;
     };
 
-    Stack<Depth> stack;
+    Scratch<Depth> stack;
     Depth depth;
     depth.depth = 0;
     depth.node = this->m_root;
@@ -642,36 +784,84 @@ size_t cslib::BSTree<T>::depth() const {
 
 template<typename T>
 size_t cslib::BSTree<T>::amount() const {
-    // Function to calc 
-    size_t n = 0;
+    // The root counts the whole tree
+    return ms_size(this->m_root);
+}
 
-    // Get all nodes via breath first.
-    
-    // If we have no data...
-    if (this->m_root == nullptr) {
-        return 0;
+template<typename T>
+const T& cslib::BSTree<T>::select(size_t p_index) const {
+    if (p_index >= this->amount()) {
+        throw OutOfRange();
     }
 
-    // Queue based search
-    Queue<BinaryNode*> queue;
+    // The left subtree holds everything smaller, skip it and this node when going right
+    BinaryNode* node = this->m_root;
+    while (true) {
+        size_t left = ms_size(node->left);
+        if (p_index < left) {
+            node = node->left;
+        } else if (p_index > left) {
+            p_index -= left + 1;
+            node = node->right;
+        } else {
+            return node->data;
+        }
+    }
+}
 
-    // Add the root node.
-    queue.enqueue(this->m_root);
-    while (!queue.empty()) {
-        // Get top node
-        BinaryNode* node = queue.dequeue();
+template<typename T>
+size_t cslib::BSTree<T>::rank(const T& p_key) const {
+    // Each time we go right, the left subtree and this node were smaller
+    size_t rank = 0;
+    BinaryNode* node = this->m_root;
+    while (node != nullptr) {
+        if (node->data < p_key) {
+            rank += ms_size(node->left) + 1;
+            node = node->right;
+        } else if (node->data > p_key) {
+            node = node->left;
+        } else {
+            return rank + ms_size(node->left);
+        }
+    }
 
-        n++;
+    return rank;
+}
 
-        if (node->left != nullptr) {
-            queue.enqueue(node->left);
-        }
-        if (node->right != nullptr) {
-            queue.enqueue(node->right);
-        }
+template<typename T>
+typename cslib::BSTree<T>::ConstIterator cslib::BSTree<T>::lowerBound(const T& p_key) const {
+    return ConstIterator(this->m_above(p_key, true), this);
+}
+
+template<typename T>
+typename cslib::BSTree<T>::ConstIterator cslib::BSTree<T>::upperBound(const T& p_key) const {
+    return ConstIterator(this->m_above(p_key, false), this);
+}
+
+template<typename T>
+const T& cslib::BSTree<T>::floor(const T& p_key) const {
+    BinaryNode* node = this->m_floor(p_key);
+    if (node == nullptr) {
+        throw BSTNodeNotFound();
     }
+    return node->data;
+}
 
-    return n;
+template<typename T>
+const T& cslib::BSTree<T>::ceiling(const T& p_key) const {
+    BinaryNode* node = this->m_above(p_key, true);
+    if (node == nullptr) {
+        throw BSTNodeNotFound();
+    }
+    return node->data;
+}
+
+template<typename T> template<typename TF>
+void cslib::BSTree<T>::range(const T& p_low, const T& p_high, TF&& p_func) const {
+    // One walk down to the first, then the successors until we reach the high end
+    for (BinaryNode* node = this->m_above(p_low, true); node != nullptr && node->data < p_high; node = ms_next(node)) {
+        p_func(node->data);
+    }
 }
 
 template<typename T>
@@ -684,6 +874,31 @@ void cslib::BSTree<T>::clear() {
     this->m_delete();
 }
 
+template<typename T>
+typename cslib::BSTree<T>::ConstIterator cslib::BSTree<T>::begin() const {
+    return ConstIterator(ms_leftmost(this->m_root), this);
+}
+
+template<typename T>
+typename cslib::BSTree<T>::ConstIterator cslib::BSTree<T>::end() const {
+    return ConstIterator(nullptr, this);
+}
+
+template<typename T>
+typename cslib::BSTree<T>::ConstIterator cslib::BSTree<T>::cbegin() const {
+    return ConstIterator(ms_leftmost(this->m_root), this);
+}
+
+template<typename T>
+typename cslib::BSTree<T>::ConstIterator cslib::BSTree<T>::cend() const {
+    return ConstIterator(nullptr, this);
+}
+
+template<typename T>
+typename cslib::BSTree<T>::ConstIterator cslib::BSTree<T>::last() const {
+    return ConstIterator(ms_rightmost(this->m_root), this);
+}
+
 template<typename T>
 void cslib::BSTree<T>::m_copy(const BSTree<T>& p_bst) {
     // If we have no data...
@@ -691,12 +906,13 @@ void cslib::BSTree<T>::m_copy(const BSTree<T>& p_bst) {
         return;
     }
     
-    // Create the root
+    // Create the root, the copies have the same shape so the sizes come along
     this->m_root = m_create(p_bst.m_root->data);
+    this->m_root->size = p_bst.m_root->size;
 
     // Use a stack to mimic recursion
-    Stack<BinaryNode*> lstack;
-    Stack<BinaryNode*> rstack;
+    Scratch<BinaryNode*> lstack;
+    Scratch<BinaryNode*> rstack;
     lstack.push( this->m_root );
     rstack.push( p_bst.m_root );
 
@@ -710,6 +926,8 @@ void cslib::BSTree<T>::m_copy(const BSTree<T>& p_bst) {
             rstack.push(rnode->left);
             
             lnode->left = m_create(rnode->left->data);
+            lnode->left->parent = lnode;
+            lnode->left->size = rnode->left->size;
             lstack.push(lnode->left);
         }
 
@@ -718,6 +936,8 @@ void cslib::BSTree<T>::m_copy(const BSTree<T>& p_bst) {
             rstack.push(rnode->right);
 
             lnode->right = m_create(rnode->right->data);
+            lnode->right->parent = lnode;
+            lnode->right->size = rnode->right->size;
             lstack.push(lnode->right);
         }
     }
@@ -733,7 +953,7 @@ void cslib::BSTree<T>::m_delete() {
     }
 
     // Queue traversal.
-    Stack<BinaryNode*> stack;
+    Scratch<BinaryNode*> stack;
     if (this->m_root->left != nullptr) {
         stack.push(this->m_root->left);
     }
@@ -771,13 +991,152 @@ typename cslib::BSTree<T>::BinaryNode* cslib::BSTree<T>::m_create(const T& p_key
     node->data = p_key;
     node->left = nullptr;
     node->right = nullptr;
+    node->parent = nullptr;
+    node->size = 1;
     return node;
 }
 
+template<typename T>
+typename cslib::BSTree<T>::BinaryNode* cslib::BSTree<T>::ms_leftmost(BinaryNode* p_node) {
+    if (p_node == nullptr) {
+        return nullptr;
+    }
+    while (p_node->left != nullptr) {
+        p_node = p_node->left;
+    }
+    return p_node;
+}
+
+template<typename T>
+typename cslib::BSTree<T>::BinaryNode* cslib::BSTree<T>::ms_rightmost(BinaryNode* p_node) {
+    if (p_node == nullptr) {
+        return nullptr;
+    }
+    while (p_node->right != nullptr) {
+        p_node = p_node->right;
+    }
+    return p_node;
+}
+
+template<typename T>
+typename cslib::BSTree<T>::BinaryNode* cslib::BSTree<T>::ms_next(const BinaryNode* p_node) {
+    // The smallest on the right
+    if (p_node->right != nullptr) {
+        return ms_leftmost(p_node->right);
+    }
+
+    // Or the first parent we reach from its left
+    BinaryNode* parent = p_node->parent;
+    while (parent != nullptr && parent->right == p_node) {
+        p_node = parent;
+        parent = parent->parent;
+    }
+    return parent;
+}
+
+template<typename T>
+typename cslib::BSTree<T>::BinaryNode* cslib::BSTree<T>::ms_prev(const BinaryNode* p_node) {
+    // The biggest on the left
+    if (p_node->left != nullptr) {
+        return ms_rightmost(p_node->left);
+    }
+
+    // Or the first parent we reach from its right
+    BinaryNode* parent = p_node->parent;
+    while (parent != nullptr && parent->left == p_node) {
+        p_node = parent;
+        parent = parent->parent;
+    }
+    return parent;
+}
+
+template<typename T>
+size_t cslib::BSTree<T>::ms_size(const BinaryNode* p_node) {
+    return (p_node == nullptr) ? 0 : p_node->size;
+}
+
+template<typename T>
+void cslib::BSTree<T>::ms_resize(BinaryNode* p_node) {
+    p_node->size = ms_size(p_node->left) + ms_size(p_node->right) + 1;
+}
+
+template<typename T>
+void cslib::BSTree<T>::ms_grow(BinaryNode* p_node, size_t p_amount) {
+    for (; p_node != nullptr; p_node = p_node->parent) {
+        p_node->size += p_amount;
+    }
+}
+
+template<typename T>
+void cslib::BSTree<T>::ms_shrink(BinaryNode* p_node, size_t p_amount) {
+    for (; p_node != nullptr; p_node = p_node->parent) {
+        p_node->size -= p_amount;
+    }
+}
+
+template<typename T>
+typename cslib::BSTree<T>::BinaryNode* cslib::BSTree<T>::m_above(const T& p_key, bool p_equal) const {
+    // Each node big enough is the best so far, a better one can only be on its left
+    BinaryNode* best = nullptr;
+    BinaryNode* node = this->m_root;
+    while (node != nullptr) {
+        if (node->data > p_key) {
+            best = node;
+            node = node->left;
+        } else if (node->data < p_key) {
+            node = node->right;
+        } else if (p_equal) {
+            return node;
+        } else {
+            node = node->right;
+        }
+    }
+
+    return best;
+}
+
+template<typename T>
+typename cslib::BSTree<T>::BinaryNode* cslib::BSTree<T>::m_floor(const T& p_key) const {
+    // Each node small enough is the best so far, a better one can only be on its right
+    BinaryNode* best = nullptr;
+    BinaryNode* node = this->m_root;
+    while (node != nullptr) {
+        if (node->data < p_key) {
+            best = node;
+            node = node->right;
+        } else if (node->data > p_key) {
+            node = node->left;
+        } else {
+            return node;
+        }
+    }
+
+    return best;
+}
+
+template<typename T>
+void cslib::BSTree<T>::m_replace(BinaryNode* p_node, BinaryNode* p_child) {
+    BinaryNode* parent = p_node->parent;
+    if (parent == nullptr) {
+        this->m_root = p_child;
+    } else if (parent->left == p_node) {
+        parent->left = p_child;
+    } else {
+        parent->right = p_child;
+    }
+
+    if (p_child != nullptr) {
+        p_child->parent = parent;
+    }
+}
+
 template<typename T>
 void cslib::BSTree<T>::m_addSubtree(const BSTree<T>& p_bst) {
     // We're adding the binary tree
     BinaryNode* subtree = p_bst.m_root;
+    if (subtree == nullptr) {
+        return;
+    }
 
     // ... Copy to subtree pointer
 
@@ -792,12 +1151,18 @@ void cslib::BSTree<T>::m_addSubtree(const BSTree<T>& p_bst) {
             // If the node left is nullptr set this to bst
             if (node->left == nullptr) {
                 node->left = subtree;
+                subtree->parent = node;
+                ms_grow(node, subtree->size);
+                return;
             }
             node = node->left;
         } else if (node->data < subtree->data) {
             // If the node right is nullptr set this to bst
             if (node->right == nullptr) {
                 node->right = subtree;
+                subtree->parent = node;
+                ms_grow(node, subtree->size);
+                return;
             }
             node = node->right;
         } else {
@@ -807,4 +1172,55 @@ void cslib::BSTree<T>::m_addSubtree(const BSTree<T>& p_bst) {
 }
 
 
+
+
+
+
+
+
+
+
+
+template<typename T>
+cslib::BSTree<T>::ConstIterator::ConstIterator(const BinaryNode* p_ptr, const BSTree<T>* p_tree) : m_tree(p_tree) {
+    this->m_ptr = p_ptr;
+}
+
+template<typename T>
+const T& cslib::BSTree<T>::ConstIterator::operator*() {
+    return (this->m_ptr->data);
+}
+
+template<typename T>
+const T* cslib::BSTree<T>::ConstIterator::operator->() {
+    return &(this->m_ptr->data);
+}
+
+template<typename T>
+typename cslib::BSTree<T>::ConstIterator& cslib::BSTree<T>::ConstIterator::operator++() {
+    this->m_ptr = (this->m_ptr == nullptr) ? ms_leftmost(this->m_tree->m_root) : ms_next(this->m_ptr);
+    return *this;
+}
+
+template<typename T>
+typename cslib::BSTree<T>::ConstIterator cslib::BSTree<T>::ConstIterator::operator++(int) {
+    ConstIterator cpy = *this;
+    ++(*this);
+    return cpy;
+}
+
+template<typename T>
+typename cslib::BSTree<T>::ConstIterator& cslib::BSTree<T>::ConstIterator::operator--() {
+    this->m_ptr = (this->m_ptr == nullptr) ? ms_rightmost(this->m_tree->m_root) : ms_prev(this->m_ptr);
+    return *this;
+}
+
+template<typename T>
+typename cslib::BSTree<T>::ConstIterator cslib::BSTree<T>::ConstIterator::operator--(int) {
+    ConstIterator cpy = *this;
+    --(*this);
+    return cpy;
+}
+
+
 #endif
\ No newline at end of file
@@ -0,0 +1,327 @@
+/**
+ * @file BlockingQueue.h
+ * @brief Holds the BlockingQueue, a bounded first-in-first out structure that producer and consumer threads wait on.
+ **/
+#ifndef CSBLOCKINGQUEUE_H
+#define CSBLOCKINGQUEUE_H
+
+#include "Universal.h"
+#include "RingBuffer.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace cslib {
+    /**
+     * @class BlockingQueue
+     * @tparam T Type of the data structure.
+     * @brief A First-in-first out data structure behind a lock, with a capacity producers wait on.
+     *
+     * Enqueue waits while the queue is full, so fast producers are held back instead of growing it.
+     * dequeueBatch takes everything waiting, up to a limit, in one trip through the lock, so a consumer
+     * that handles values in batches pays for the lock and the wake up once per batch instead of once
+     * per value. Threads are only notified when someone is actually waiting.
+     *
+     * close() stops new values going in and wakes everyone. Consumers still get what's left, and once
+     * it's drained every dequeue returns straight away with nothing.
+     **/
+    template<typename T>
+    class BlockingQueue {
+    public:
+        /**
+         * @param p_capacity The most values it holds, at least 1
+         *
+         * @brief Constructs an open, empty queue
+         */
+        explicit BlockingQueue(size_t p_capacity);
+
+        /// Copying can't be done safely while others use it
+        BlockingQueue(const BlockingQueue<T>&) = delete;
+        BlockingQueue<T>& operator= (const BlockingQueue<T>&) = delete;
+
+        /**
+         * @brief Gets the most values it holds
+         * @return Returns the capacity
+         */
+        size_t capacity() const;
+
+        /**
+         * @brief Gets the amount of values when we looked
+         * @return Returns the amount of values
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if there was no data in the data structure when we looked.
+         * @return Returns true if empty, false if not.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Returns true once the queue is closed
+         * @return Returns true if closed, false if not.
+         */
+        bool closed() const;
+
+        /**
+         * @param p_data The data that we are putting to the back of the queue.
+         *
+         * @brief Adds value to back of queue, waiting while it's full
+         * @return Returns false if the queue was closed, the value wasn't added
+         */
+        bool enqueue(const T& p_data);
+
+        /**
+         * @param p_data The data that we are putting to the back of the queue.
+         *
+         * @brief Adds value to back of queue if there's room
+         * @return Returns false if the queue was full or closed
+         */
+        bool tryEnqueue(const T& p_data);
+
+        /**
+         * @param p_data The values, the first goes in first
+         * @param p_count How many values
+         *
+         * @brief Adds all the values, as many as fit each time it takes the lock
+         * @return Returns how many were added, less than asked for only if it was closed
+         */
+        size_t enqueueMany(const T* p_data, size_t p_count);
+
+        /**
+         * @param p_data Gets the value from the front
+         *
+         * @brief Takes the front value off, waiting while it's empty
+         * @return Returns false if the queue was closed and nothing was left
+         */
+        bool dequeue(T& p_data);
+
+        /**
+         * @param p_data Gets the value from the front
+         *
+         * @brief Takes the front value off if there is one
+         * @return Returns false if the queue was empty
+         */
+        bool tryDequeue(T& p_data);
+
+        /**
+         * @param p_data Gets the values from the front
+         * @param p_max The most values we want
+         * @param p_timeout How long to wait for the first value
+         *
+         * @brief Waits for at least one value, then takes everything waiting up to the most we want
+         * @return Returns how many were taken, 0 if it timed out or was closed and drained
+         */
+        size_t dequeueBatch(T* p_data, size_t p_max, std::chrono::milliseconds p_timeout);
+
+        /**
+         * @brief Stops values going in and wakes every thread that waits, what's left can still be taken
+         */
+        void close();
+
+    protected:
+        /// Holds the values
+        RingBuffer<T> m_buffer;
+
+        /// The most values it holds
+        size_t m_capacity;
+
+        /// If no more values can go in
+        bool m_closed;
+
+        /// How many producers are waiting for room
+        size_t m_waitingProducers;
+
+        /// How many consumers are waiting for values
+        size_t m_waitingConsumers;
+
+        /// Guards everything above
+        mutable std::mutex m_mutex;
+
+        /// Producers wait here for room
+        std::condition_variable m_notFull;
+
+        /// Consumers wait here for values
+        std::condition_variable m_notEmpty;
+    };
+}
+
+template<typename T>
+cslib::BlockingQueue<T>::BlockingQueue(size_t p_capacity) : m_capacity((p_capacity == 0) ? 1 : p_capacity), m_closed(false), m_waitingProducers(0), m_waitingConsumers(0) {
+    this->m_buffer.reserve(this->m_capacity);
+}
+
+template<typename T>
+size_t cslib::BlockingQueue<T>::capacity() const {
+    return this->m_capacity;
+}
+
+template<typename T>
+size_t cslib::BlockingQueue<T>::size() const {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_buffer.size();
+}
+
+template<typename T>
+bool cslib::BlockingQueue<T>::empty() const {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_buffer.empty();
+}
+
+template<typename T>
+bool cslib::BlockingQueue<T>::closed() const {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_closed;
+}
+
+template<typename T>
+bool cslib::BlockingQueue<T>::enqueue(const T& p_data) {
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    while (!this->m_closed && this->m_buffer.size() == this->m_capacity) {
+        this->m_waitingProducers++;
+        this->m_notFull.wait(lock);
+        this->m_waitingProducers--;
+    }
+    if (this->m_closed) {
+        return false;
+    }
+
+    this->m_buffer.enqueue(p_data);
+    bool wake = (this->m_waitingConsumers > 0);
+    lock.unlock();
+
+    if (wake) {
+        this->m_notEmpty.notify_one();
+    }
+    return true;
+}
+
+template<typename T>
+bool cslib::BlockingQueue<T>::tryEnqueue(const T& p_data) {
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    if (this->m_closed || this->m_buffer.size() == this->m_capacity) {
+        return false;
+    }
+
+    this->m_buffer.enqueue(p_data);
+    bool wake = (this->m_waitingConsumers > 0);
+    lock.unlock();
+
+    if (wake) {
+        this->m_notEmpty.notify_one();
+    }
+    return true;
+}
+
+template<typename T>
+size_t cslib::BlockingQueue<T>::enqueueMany(const T* p_data, size_t p_count) {
+    size_t done = 0;
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    while (done < p_count) {
+        while (!this->m_closed && this->m_buffer.size() == this->m_capacity) {
+            this->m_waitingProducers++;
+            this->m_notFull.wait(lock);
+            this->m_waitingProducers--;
+        }
+        if (this->m_closed) {
+            break;
+        }
+
+        // As many as fit, then let the consumers at them
+        size_t room = this->m_capacity - this->m_buffer.size();
+        size_t count = (p_count - done < room) ? p_count - done : room;
+        this->m_buffer.enqueueMany(p_data + done, count);
+        done += count;
+
+        if (this->m_waitingConsumers > 0) {
+            this->m_notEmpty.notify_all();
+        }
+    }
+    return done;
+}
+
+template<typename T>
+bool cslib::BlockingQueue<T>::dequeue(T& p_data) {
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    while (!this->m_closed && this->m_buffer.empty()) {
+        this->m_waitingConsumers++;
+        this->m_notEmpty.wait(lock);
+        this->m_waitingConsumers--;
+    }
+    if (this->m_buffer.empty()) {
+        return false;
+    }
+
+    p_data = this->m_buffer.dequeue();
+    bool wake = (this->m_waitingProducers > 0);
+    lock.unlock();
+
+    if (wake) {
+        this->m_notFull.notify_one();
+    }
+    return true;
+}
+
+template<typename T>
+bool cslib::BlockingQueue<T>::tryDequeue(T& p_data) {
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    if (this->m_buffer.empty()) {
+        return false;
+    }
+
+    p_data = this->m_buffer.dequeue();
+    bool wake = (this->m_waitingProducers > 0);
+    lock.unlock();
+
+    if (wake) {
+        this->m_notFull.notify_one();
+    }
+    return true;
+}
+
+template<typename T>
+size_t cslib::BlockingQueue<T>::dequeueBatch(T* p_data, size_t p_max, std::chrono::milliseconds p_timeout) {
+    if (p_max == 0) {
+        return 0;
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + p_timeout;
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    while (!this->m_closed && this->m_buffer.empty()) {
+        this->m_waitingConsumers++;
+        std::cv_status status = this->m_notEmpty.wait_until(lock, deadline);
+        this->m_waitingConsumers--;
+        if (status == std::cv_status::timeout) {
+            break;
+        }
+    }
+
+    // Everything waiting in one go
+    size_t count = this->m_buffer.dequeueMany(p_data, p_max);
+    bool wake = (count > 0 && this->m_waitingProducers > 0);
+    lock.unlock();
+
+    if (wake) {
+        // Room for more than one producer, maybe
+        if (count > 1) {
+            this->m_notFull.notify_all();
+        } else {
+            this->m_notFull.notify_one();
+        }
+    }
+    return count;
+}
+
+template<typename T>
+void cslib::BlockingQueue<T>::close() {
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_closed = true;
+    }
+    this->m_notEmpty.notify_all();
+    this->m_notFull.notify_all();
+}
+
+
+#endif
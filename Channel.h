@@ -0,0 +1,430 @@
+/**
+ * @file Channel.h
+ * @brief Holds the Channel, a first-in-first out structure coroutines wait on without holding a thread.
+ **/
+#ifndef CSCHANNEL_H
+#define CSCHANNEL_H
+
+#include "Universal.h"
+#include "Executor.h"
+#include "IntrusiveList.h"
+#include "Queue.h"
+
+#include <coroutine>
+#include <mutex>
+
+namespace cslib {
+    /**
+     * @class Channel
+     * @tparam T Type of the data structure.
+     * @brief A First-in-first out data structure that suspends coroutines instead of blocking threads.
+     *
+     * With a capacity the values wait in a ring buffer and senders only suspend while it's full.
+     * With a capacity of 0 every send waits for a receiver and the value is handed straight over.
+     * Any number of coroutines on any executors can send and receive, a waiting coroutine is
+     * resumed on the executor it was spawned on. The waiters live in the coroutine frames and
+     * are linked into intrusive lists, so waiting never allocates.
+     *
+     * close() stops values going in and resumes everyone waiting. Receivers still get what's
+     * left, and once it's drained every receive finishes straight away with nothing.
+     **/
+    template<typename T>
+    class Channel {
+    protected:
+        /**
+         * @struct Waiter
+         * @brief A suspended coroutine and the value it's sending or receiving
+         **/
+        struct Waiter : public IntrusiveListHook<> {
+            /// The coroutine
+            std::coroutine_handle<> handle;
+            /// Where it's resumed
+            Executor* executor = nullptr;
+            /// The value sent, or where the received one goes
+            T* data = nullptr;
+            /// If the value was sent or received
+            bool ok = false;
+        };
+
+    public:
+        /**
+         * @class SendAwaiter
+         * @brief What co_await on send waits on, gives true once sent and false if closed
+         **/
+        class SendAwaiter {
+        public:
+            /**
+             * @param p_channel The channel
+             * @param p_data The value, copied in
+             *
+             * @brief Constructs the awaiter
+             */
+            SendAwaiter(Channel<T>* p_channel, const T& p_data);
+
+            /// It's linked in place while waiting
+            SendAwaiter(const SendAwaiter&) = delete;
+            SendAwaiter& operator= (const SendAwaiter&) = delete;
+
+            /**
+             * @brief The lock decides, so it never skips suspending
+             * @return Returns false
+             */
+            bool await_ready() const noexcept { return false; }
+
+            /**
+             * @param p_handle The coroutine, spawned on an Executor
+             *
+             * @brief Sends the value if it can, waits if not
+             * @return Returns true if the coroutine waits
+             */
+            template<typename TPromise>
+            bool await_suspend(std::coroutine_handle<TPromise> p_handle);
+
+            /**
+             * @brief Tells if it was sent
+             * @return Returns false if the channel was closed, the value wasn't sent
+             */
+            bool await_resume() const noexcept { return this->m_waiter.ok; }
+
+        protected:
+            /// The channel
+            Channel<T>* m_channel;
+
+            /// The value
+            T m_data;
+
+            /// What the channel links while we wait
+            Waiter m_waiter;
+        };
+
+        /**
+         * @class ReceiveAwaiter
+         * @brief What co_await on receive waits on, gives true once received and false if closed and drained
+         **/
+        class ReceiveAwaiter {
+        public:
+            /**
+             * @param p_channel The channel
+             * @param p_data Where the value goes
+             *
+             * @brief Constructs the awaiter
+             */
+            ReceiveAwaiter(Channel<T>* p_channel, T& p_data);
+
+            /// It's linked in place while waiting
+            ReceiveAwaiter(const ReceiveAwaiter&) = delete;
+            ReceiveAwaiter& operator= (const ReceiveAwaiter&) = delete;
+
+            /**
+             * @brief The lock decides, so it never skips suspending
+             * @return Returns false
+             */
+            bool await_ready() const noexcept { return false; }
+
+            /**
+             * @param p_handle The coroutine, spawned on an Executor
+             *
+             * @brief Receives a value if there is one, waits if not
+             * @return Returns true if the coroutine waits
+             */
+            template<typename TPromise>
+            bool await_suspend(std::coroutine_handle<TPromise> p_handle);
+
+            /**
+             * @brief Tells if a value was received
+             * @return Returns false if the channel was closed and drained, nothing was received
+             */
+            bool await_resume() const noexcept { return this->m_waiter.ok; }
+
+        protected:
+            /// The channel
+            Channel<T>* m_channel;
+
+            /// What the channel links while we wait
+            Waiter m_waiter;
+        };
+
+        /**
+         * @param p_capacity How many values wait without a receiver, 0 hands each one straight over
+         *
+         * @brief Constructs an open, empty channel
+         */
+        explicit Channel(size_t p_capacity = 0);
+
+        /// Copying can't be done safely while others use it
+        Channel(const Channel<T>&) = delete;
+        Channel<T>& operator= (const Channel<T>&) = delete;
+
+        /**
+         * @brief Gets how many values wait without a receiver
+         * @return Returns the capacity
+         */
+        size_t capacity() const;
+
+        /**
+         * @brief Gets the amount of values waiting when we looked
+         * @return Returns the amount of values
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true once the channel is closed
+         * @return Returns true if closed, false if not.
+         */
+        bool closed() const;
+
+        /**
+         * @param p_data The value
+         *
+         * @brief Sends a value, co_await it: bool sent = co_await channel.send(value);
+         * @return Returns the awaiter
+         */
+        SendAwaiter send(const T& p_data);
+
+        /**
+         * @param p_data Where the value goes
+         *
+         * @brief Receives a value, co_await it: bool received = co_await channel.receive(value);
+         * @return Returns the awaiter
+         */
+        ReceiveAwaiter receive(T& p_data);
+
+        /**
+         * @param p_data The value
+         *
+         * @brief Sends a value if a receiver waits or there's room, for code outside of coroutines
+         * @return Returns false if it would have had to wait or the channel was closed
+         */
+        bool trySend(const T& p_data);
+
+        /**
+         * @param p_data Where the value goes
+         *
+         * @brief Receives a value if one is there, for code outside of coroutines
+         * @return Returns false if there was none
+         */
+        bool tryReceive(T& p_data);
+
+        /**
+         * @brief Stops values going in and resumes everyone waiting, what's left can still be received
+         */
+        void close();
+
+    protected:
+        /**
+         * @param p_waiter The sender
+         * @param p_wait If it may wait
+         *
+         * @brief Hands the value to a receiver, puts it in the buffer, or links the sender
+         * @return Returns true if the sender was linked and waits
+         */
+        bool m_send(Waiter& p_waiter, bool p_wait);
+
+        /**
+         * @param p_waiter The receiver
+         * @param p_wait If it may wait
+         *
+         * @brief Takes a value from the buffer or a sender, or links the receiver
+         * @return Returns true if the receiver was linked and waits
+         */
+        bool m_receive(Waiter& p_waiter, bool p_wait);
+
+        /// Values that were sent but not received
+        Queue<T, RingBuffer<T>> m_buffer;
+
+        /// How many values wait without a receiver
+        size_t m_capacity;
+
+        /// If no more values can go in
+        bool m_closed;
+
+        /// Senders waiting for room or a receiver
+        IntrusiveList<Waiter> m_senders;
+
+        /// Receivers waiting for a value
+        IntrusiveList<Waiter> m_receivers;
+
+        /// Guards everything above
+        mutable std::mutex m_mutex;
+    };
+}
+
+template<typename T>
+cslib::Channel<T>::Channel(size_t p_capacity) : m_capacity(p_capacity), m_closed(false) {
+    if (p_capacity > 0) {
+        this->m_buffer.reserve(p_capacity);
+    }
+}
+
+template<typename T>
+size_t cslib::Channel<T>::capacity() const {
+    return this->m_capacity;
+}
+
+template<typename T>
+size_t cslib::Channel<T>::size() const {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_buffer.size();
+}
+
+template<typename T>
+bool cslib::Channel<T>::closed() const {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    return this->m_closed;
+}
+
+template<typename T>
+typename cslib::Channel<T>::SendAwaiter cslib::Channel<T>::send(const T& p_data) {
+    return SendAwaiter(this, p_data);
+}
+
+template<typename T>
+typename cslib::Channel<T>::ReceiveAwaiter cslib::Channel<T>::receive(T& p_data) {
+    return ReceiveAwaiter(this, p_data);
+}
+
+template<typename T>
+bool cslib::Channel<T>::trySend(const T& p_data) {
+    T data = p_data;
+    Waiter waiter;
+    waiter.data = &data;
+    this->m_send(waiter, false);
+    return waiter.ok;
+}
+
+template<typename T>
+bool cslib::Channel<T>::tryReceive(T& p_data) {
+    Waiter waiter;
+    waiter.data = &p_data;
+    this->m_receive(waiter, false);
+    return waiter.ok;
+}
+
+template<typename T>
+void cslib::Channel<T>::close() {
+    IntrusiveList<Waiter> waiting;
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_closed = true;
+
+        // Nobody can send anymore, and receivers only wait while the buffer is empty
+        while (!this->m_senders.empty()) {
+            waiting.pushBack(this->m_senders.popFront());
+        }
+        while (!this->m_receivers.empty()) {
+            waiting.pushBack(this->m_receivers.popFront());
+        }
+    }
+
+    while (!waiting.empty()) {
+        Waiter& waiter = waiting.popFront();
+        waiter.ok = false;
+        waiter.executor->schedule(waiter.handle);
+    }
+}
+
+template<typename T>
+bool cslib::Channel<T>::m_send(Waiter& p_waiter, bool p_wait) {
+    Waiter* wake = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        if (this->m_closed) {
+            p_waiter.ok = false;
+        } else if (!this->m_receivers.empty()) {
+            // Someone waits, so the buffer is empty, hand it straight over
+            wake = &this->m_receivers.popFront();
+            *wake->data = *p_waiter.data;
+            wake->ok = true;
+            p_waiter.ok = true;
+        } else if (this->m_buffer.size() < this->m_capacity) {
+            this->m_buffer.enqueue(*p_waiter.data);
+            p_waiter.ok = true;
+        } else if (p_wait) {
+            // The waiter may be resumed as soon as we unlock, so don't touch it after
+            this->m_senders.pushBack(p_waiter);
+            return true;
+        } else {
+            p_waiter.ok = false;
+        }
+    }
+
+    if (wake != nullptr) {
+        wake->executor->schedule(wake->handle);
+    }
+    return false;
+}
+
+template<typename T>
+bool cslib::Channel<T>::m_receive(Waiter& p_waiter, bool p_wait) {
+    Waiter* wake = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        if (!this->m_buffer.empty()) {
+            *p_waiter.data = this->m_buffer.dequeue();
+            p_waiter.ok = true;
+
+            // Room for the first sender that waits
+            if (!this->m_senders.empty()) {
+                wake = &this->m_senders.popFront();
+                this->m_buffer.enqueue(*wake->data);
+                wake->ok = true;
+            }
+        } else if (!this->m_senders.empty()) {
+            // Nothing buffered, take it straight from the sender
+            wake = &this->m_senders.popFront();
+            *p_waiter.data = *wake->data;
+            wake->ok = true;
+            p_waiter.ok = true;
+        } else if (!this->m_closed && p_wait) {
+            // The waiter may be resumed as soon as we unlock, so don't touch it after
+            this->m_receivers.pushBack(p_waiter);
+            return true;
+        } else {
+            p_waiter.ok = false;
+        }
+    }
+
+    if (wake != nullptr) {
+        wake->executor->schedule(wake->handle);
+    }
+    return false;
+}
+
+
+
+
+
+
+
+
+
+
+
+template<typename T>
+cslib::Channel<T>::SendAwaiter::SendAwaiter(Channel<T>* p_channel, const T& p_data) : m_channel(p_channel), m_data(p_data) {
+    this->m_waiter.data = &this->m_data;
+}
+
+template<typename T>
+template<typename TPromise>
+bool cslib::Channel<T>::SendAwaiter::await_suspend(std::coroutine_handle<TPromise> p_handle) {
+    this->m_waiter.handle = p_handle;
+    this->m_waiter.executor = p_handle.promise().executor;
+    return this->m_channel->m_send(this->m_waiter, true);
+}
+
+template<typename T>
+cslib::Channel<T>::ReceiveAwaiter::ReceiveAwaiter(Channel<T>* p_channel, T& p_data) : m_channel(p_channel) {
+    this->m_waiter.data = &p_data;
+}
+
+template<typename T>
+template<typename TPromise>
+bool cslib::Channel<T>::ReceiveAwaiter::await_suspend(std::coroutine_handle<TPromise> p_handle) {
+    this->m_waiter.handle = p_handle;
+    this->m_waiter.executor = p_handle.promise().executor;
+    return this->m_channel->m_receive(this->m_waiter, true);
+}
+
+
+#endif
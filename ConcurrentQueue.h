@@ -0,0 +1,303 @@
+/**
+ * @file ConcurrentQueue.h
+ * @brief Holds the ConcurrentQueue, an unbounded first-in-first out structure many threads can use without locks.
+ **/
+#ifndef CSCONCURRENTQUEUE_H
+#define CSCONCURRENTQUEUE_H
+
+#include "Universal.h"
+#include "Epoch.h"
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+/// How many freed nodes a thread keeps for its next enqueues.
+#define CONCURRENTQUEUE_CACHE_MAX 256
+
+namespace cslib {
+    /**
+     * @class ConcurrentQueue
+     * @tparam T Type of the data structure.
+     * @brief A lock free First-in-first out data structure without a capacity, a Michael-Scott queue.
+     *
+     * The head always points at a dummy node, the front value sits in the node after it. Enqueue
+     * links a node after the last one with a compare and exchange, then swings the tail to it, and
+     * anyone who finds the tail lagging swings it on for them. Dequeue swings the head on, the node
+     * it moves to becomes the new dummy, and the old dummy is retired through Epoch.
+     *
+     * Once Epoch frees a node it goes into a cache on the freeing thread instead of back to the
+     * system, so a steady stream of enqueues and dequeues mostly reuses nodes.
+     **/
+    template<typename T>
+    class ConcurrentQueue {
+    protected:
+        /**
+         * @structure Node
+         * @brief The node of some sort of data
+         **/
+        struct Node {
+            /// The node behind, or the next cached node once it's freed
+            std::atomic<Node*> next;
+            /// Where the data goes, nothing is in it while the node is the dummy
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+        /**
+         * @struct Cache
+         * @brief The freed nodes of one thread, left alone by thread exit so Epoch can use it until the end
+         **/
+        struct Cache {
+            /// The first cached node
+            Node* head;
+            /// How many are cached
+            size_t count;
+            /// If the thread set up its holder
+            bool registered;
+            /// If the thread is finishing, nodes are deleted rather than cached
+            bool closed;
+        };
+
+        /**
+         * @class CacheHolder
+         * @brief Deletes the cached nodes when the thread finishes
+         **/
+        class CacheHolder {
+        public:
+            CacheHolder(Cache& p_cache) : m_cache(p_cache) {}
+
+            ~CacheHolder() {
+                while (this->m_cache.head != nullptr) {
+                    Node* next = this->m_cache.head->next.load(std::memory_order_relaxed);
+                    delete this->m_cache.head;
+                    this->m_cache.head = next;
+                }
+                this->m_cache.count = 0;
+                this->m_cache.closed = true;
+            }
+
+        private:
+            /// The cache
+            Cache& m_cache;
+        };
+
+    public:
+        /**
+         * @brief Constructs an empty queue
+         */
+        ConcurrentQueue();
+
+        /**
+         * @brief Frees every node, nobody can be using it
+         */
+        ~ConcurrentQueue();
+
+        /// Copying can't be done safely while others use it
+        ConcurrentQueue(const ConcurrentQueue<T>&) = delete;
+        ConcurrentQueue<T>& operator= (const ConcurrentQueue<T>&) = delete;
+
+        /**
+         * @brief Returns true if there was no data in the data structure when we looked.
+         * @return Returns true if empty, false if not.
+         */
+        bool empty() const;
+
+        /**
+         * @param p_data The data that we are putting to the back of the queue.
+         *
+         * @brief Adds value to back of queue.
+         */
+        void enqueue(const T& p_data);
+
+        /**
+         * @param p_data Gets the value from the front
+         *
+         * @brief Takes the front value off if there is one
+         * @return Returns false if the queue was empty
+         */
+        bool tryDequeue(T& p_data);
+
+        /**
+         * @brief Takes the front value off.
+         * @return Returns the value that just got dequeued.
+         */
+        T dequeue();
+
+    protected:
+        /**
+         * @brief Gets a node from this thread's cache, or a new one
+         * @return Returns the node, its next is nullptr and it holds no data
+         */
+        static Node* ms_create();
+
+        /**
+         * @param p_node The node we're freeing, the type is erased for Epoch
+         *
+         * @brief Puts the node in this thread's cache, or deletes it if the cache is full
+         */
+        static void ms_recycle(void* p_node);
+
+        /**
+         * @brief Gets this thread's cache
+         * @return Returns the cache
+         */
+        static Cache& ms_cache();
+
+        /// The dummy, the front value is in the node after it
+        alignas(64) std::atomic<Node*> m_head;
+
+        /// The last node, or one behind it
+        alignas(64) std::atomic<Node*> m_tail;
+    };
+}
+
+template<typename T>
+cslib::ConcurrentQueue<T>::ConcurrentQueue() : m_head(nullptr), m_tail(nullptr) {
+    Node* dummy = ms_create();
+    this->m_head.store(dummy, std::memory_order_relaxed);
+    this->m_tail.store(dummy, std::memory_order_relaxed);
+}
+
+template<typename T>
+cslib::ConcurrentQueue<T>::~ConcurrentQueue() {
+    // Only the dummy holds no data
+    Node* node = this->m_head.load(std::memory_order_acquire);
+    Node* next = node->next.load(std::memory_order_acquire);
+    delete node;
+
+    while (next != nullptr) {
+        node = next;
+        next = node->next.load(std::memory_order_acquire);
+        reinterpret_cast<T*>(node->storage)->~T();
+        delete node;
+    }
+}
+
+template<typename T>
+bool cslib::ConcurrentQueue<T>::empty() const {
+    EpochGuard guard;
+    return (this->m_head.load(std::memory_order_acquire)->next.load(std::memory_order_acquire) == nullptr);
+}
+
+template<typename T>
+void cslib::ConcurrentQueue<T>::enqueue(const T& p_data) {
+    Node* node = ms_create();
+    try {
+        new (node->storage) T(p_data);
+    } catch (...) {
+        ms_recycle(node);
+        throw;
+    }
+
+    EpochGuard guard;
+    while (true) {
+        Node* tail = this->m_tail.load(std::memory_order_acquire);
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (tail != this->m_tail.load(std::memory_order_acquire)) {
+            continue;
+        }
+
+        if (next != nullptr) {
+            // The tail is lagging, move it on for whoever linked that
+            this->m_tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (tail->next.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed)) {
+            // It's in, if this fails somebody already moved the tail for us
+            this->m_tail.compare_exchange_strong(tail, node, std::memory_order_release, std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+template<typename T>
+bool cslib::ConcurrentQueue<T>::tryDequeue(T& p_data) {
+    // Set the cache up now, not while the thread is finishing and Epoch frees what we retire
+    ms_cache();
+
+    EpochGuard guard;
+    while (true) {
+        Node* head = this->m_head.load(std::memory_order_acquire);
+        Node* tail = this->m_tail.load(std::memory_order_acquire);
+        Node* next = head->next.load(std::memory_order_acquire);
+        if (head != this->m_head.load(std::memory_order_acquire)) {
+            continue;
+        }
+
+        if (next == nullptr) {
+            return false;
+        }
+
+        if (head == tail) {
+            // Don't let the head pass the tail, move the tail on first
+            this->m_tail.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (this->m_head.compare_exchange_weak(head, next, std::memory_order_acquire, std::memory_order_relaxed)) {
+            // The value is ours alone now, next became the dummy
+            T* value = reinterpret_cast<T*>(next->storage);
+            p_data = std::move(*value);
+            value->~T();
+
+            // Others might still be reading the old dummy
+            Epoch::retire(head, ms_recycle);
+            return true;
+        }
+    }
+}
+
+template<typename T>
+T cslib::ConcurrentQueue<T>::dequeue() {
+    T data;
+    if (!this->tryDequeue(data)) {
+        throw OutOfRange();
+    }
+    return data;
+}
+
+template<typename T>
+typename cslib::ConcurrentQueue<T>::Node* cslib::ConcurrentQueue<T>::ms_create() {
+    Cache& cache = ms_cache();
+
+    Node* node = cache.head;
+    if (node != nullptr) {
+        cache.head = node->next.load(std::memory_order_relaxed);
+        cache.count--;
+    } else {
+        node = new Node;
+    }
+
+    node->next.store(nullptr, std::memory_order_relaxed);
+    return node;
+}
+
+template<typename T>
+void cslib::ConcurrentQueue<T>::ms_recycle(void* p_node) {
+    Node* node = static_cast<Node*>(p_node);
+    Cache& cache = ms_cache();
+
+    if (cache.closed || cache.count >= CONCURRENTQUEUE_CACHE_MAX) {
+        delete node;
+        return;
+    }
+
+    node->next.store(cache.head, std::memory_order_relaxed);
+    cache.head = node;
+    cache.count++;
+}
+
+template<typename T>
+typename cslib::ConcurrentQueue<T>::Cache& cslib::ConcurrentQueue<T>::ms_cache() {
+    // Has no destructor, so Epoch can still reach it while other thread locals are torn down
+    thread_local Cache cache = { nullptr, 0, false, false };
+    if (!cache.registered) {
+        cache.registered = true;
+        thread_local CacheHolder holder(cache);
+    }
+    return cache;
+}
+
+
+#endif
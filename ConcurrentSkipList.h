@@ -0,0 +1,686 @@
+/**
+ * @file ConcurrentSkipList.h
+ * @brief Holds the ConcurrentSkipList, an ordered map many threads can use at once without locks.
+ **/
+#ifndef CSCONCURRENTSKIPLIST_H
+#define CSCONCURRENTSKIPLIST_H
+
+#include "Universal.h"
+#include "Epoch.h"
+
+#include <atomic>
+#include <new>
+
+/// The most levels a node can have, a quarter of the nodes go up each level.
+#define CONCURRENTSKIPLIST_MAX_LEVEL 16
+
+namespace cslib {
+    /**
+     * @class ConcurrentSkipList
+     * @tparam K Type of the keys, ordered by operator<.
+     * @tparam V Type of the values.
+     * @brief An ordered map where insert, find and erase are lock free.
+     *
+     * Every node is in the bottom level list and in some of the lists above it. A node is erased
+     * by marking the low bit of its next pointers, top level first, after which any thread that
+     * walks past it unlinks it. Unlinked nodes are freed through Epoch once nobody can reach them.
+     *
+     * A value can't be changed after it is inserted, erase and insert again instead. The destructor
+     * and copying aren't thread safe.
+     **/
+    template<typename K, typename V>
+    class ConcurrentSkipList {
+    protected:
+        /**
+         * @structure Node
+         * @brief The node, its next pointers follow it in memory
+         **/
+        struct alignas(std::atomic<uintptr_t>) Node {
+            /// The key
+            K key;
+            /// The value
+            V value;
+            /// How many levels it is in
+            int height;
+            /// The inserter and the eraser both let go of it before it's retired
+            std::atomic<int> owners;
+
+            /**
+             * @brief Gets the next pointers, the low bit marks the node as erased
+             * @return Returns the first of height pointers
+             */
+            std::atomic<uintptr_t>* next() const { return reinterpret_cast<std::atomic<uintptr_t>*>(const_cast<Node*>(this) + 1); }
+        };
+
+    public:
+        /**
+         * @class ConstIterator
+         * @brief Walks the keys in order, keeps the thread pinned while it lives.
+         **/
+        class ConstIterator : public cslib::ConstIterator<Node> {
+        public:
+            /**
+             * @param p_ptr The node we're on
+             *
+             * @brief Constructs the iterator and pins the thread
+             */
+            ConstIterator(const Node* p_ptr = nullptr);
+
+            /**
+             * @brief Copies the iterator, pinning again
+             */
+            ConstIterator(const ConstIterator& p_it);
+
+            /**
+             * @brief Copies the iterator
+             * @return Returns this iterator
+             */
+            ConstIterator& operator= (const ConstIterator& p_it);
+
+            /**
+             * @brief Unpins the thread
+             */
+            ~ConstIterator();
+
+            /**
+             * @brief Gets the next iterator, skipping erased nodes
+             * @return Returns the value that was next
+             */
+            ConstIterator& operator++();
+
+            /**
+             * @brief Gets the key at the location
+             * @return Gets the key that this iterator represents
+             */
+            const K& key();
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            const V& operator* ();
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            const V* operator->();
+        };
+
+        /**
+         * @brief Constructs an empty list
+         */
+        ConcurrentSkipList();
+
+        /**
+         * @brief Copies the list, nobody can be changing it
+         */
+        ConcurrentSkipList(const ConcurrentSkipList<K, V>& p_list);
+
+        /**
+         * @brief Copies the list, nobody can be changing either.
+         * @return Returns "this" data structure
+         */
+        ConcurrentSkipList<K, V>& operator= (const ConcurrentSkipList<K, V>& p_list);
+
+        /**
+         * @brief Frees every node, nobody can be using it
+         */
+        ~ConcurrentSkipList();
+
+        /**
+         * @brief Gets the amount of keys, only exact while nobody is changing it
+         * @return Returns the amount of keys
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if there is no data in the data structure.
+         * @return True if empty, false if at least one item.
+         */
+        bool empty() const;
+
+        /**
+         * @param p_key The key
+         * @param p_value The value
+         *
+         * @brief Adds the key if it isn't there
+         * @return Returns false if the key was already there
+         */
+        bool insert(const K& p_key, const V& p_value);
+
+        /**
+         * @param p_key The key we're looking for
+         * @param p_value Gets a copy of the value if found
+         *
+         * @brief Looks for the key
+         * @return Returns true if found
+         */
+        bool find(const K& p_key, V& p_value) const;
+
+        /**
+         * @param p_key The key we're looking for
+         *
+         * @brief Tests if the key is there
+         * @return Returns true if found
+         */
+        bool contains(const K& p_key) const;
+
+        /**
+         * @param p_key The key we're erasing
+         *
+         * @brief Erases the key
+         * @return Returns false if it wasn't there
+         */
+        bool erase(const K& p_key);
+
+        /**
+         * @tparam F Called as f(const K&, const V&)
+         * @param p_from The first key we want
+         * @param p_to The key we stop before
+         * @param p_visit Called for each key in order
+         *
+         * @brief Visits the keys in [p_from, p_to), the same as the tree and Map range()
+         * @return Returns how many were visited
+         */
+        template<typename F>
+        size_t range(const K& p_from, const K& p_to, F p_visit) const;
+
+        /**
+         * @brief Gets the iterator to the smallest key.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator cbegin() const;
+
+        /**
+         * @param p_key The key
+         *
+         * @brief Gets the iterator to the first key that isn't less than p_key.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator lowerBound(const K& p_key) const;
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator cend() const;
+
+    protected:
+        /**
+         * @param p_link A next pointer
+         *
+         * @brief Gets the node the pointer points at, without the mark
+         * @return Returns the node
+         */
+        static Node* ms_node(uintptr_t p_link);
+
+        /**
+         * @param p_link A next pointer
+         *
+         * @brief Tests if the pointer is marked
+         * @return Returns true if the node owning it is erased
+         */
+        static bool ms_marked(uintptr_t p_link);
+
+        /**
+         * @param p_pred The node, nullptr for the head
+         * @param p_level The level
+         *
+         * @brief Gets the next pointer of a node or the head
+         * @return Returns the pointer
+         */
+        std::atomic<uintptr_t>& m_next(Node* p_pred, int p_level) const;
+
+        /**
+         * @param p_key The key
+         * @param p_preds Gets the last node before the key on every level, nullptr for the head
+         * @param p_succs Gets the first node not before the key on every level
+         *
+         * @brief Finds where the key goes, unlinking erased nodes it walks past
+         * @return Returns true if the key is there
+         */
+        bool m_find(const K& p_key, Node** p_preds, Node** p_succs) const;
+
+        /**
+         * @param p_key The key
+         *
+         * @brief Walks down to the first node not less than the key without changing anything
+         * @return Returns the node, nullptr if none
+         */
+        const Node* m_lowerBound(const K& p_key) const;
+
+        /**
+         * @param p_key The key
+         * @param p_value The value
+         * @param p_height How many levels
+         *
+         * @brief Creates a node
+         * @return Returns the new node
+         */
+        static Node* ms_create(const K& p_key, const V& p_value, int p_height);
+
+        /**
+         * @param p_node The node we're freeing, the type is erased for Epoch
+         *
+         * @brief Frees the node
+         */
+        static void ms_destroy(void* p_node);
+
+        /**
+         * @param p_node The node
+         *
+         * @brief Lets go of the node, the last one to do so retires it
+         */
+        static void ms_release(Node* p_node);
+
+        /**
+         * @brief Picks how many levels a new node goes in
+         * @return Returns between 1 and CONCURRENTSKIPLIST_MAX_LEVEL
+         */
+        static int ms_height();
+
+        /**
+         * @brief Frees every node
+         */
+        void m_clear();
+
+        /// The next pointers of the head
+        mutable std::atomic<uintptr_t> m_head[CONCURRENTSKIPLIST_MAX_LEVEL];
+
+        /// The amount of keys
+        std::atomic<size_t> m_size;
+    };
+}
+
+template<typename K, typename V>
+cslib::ConcurrentSkipList<K, V>::ConcurrentSkipList() : m_size(0) {
+    for (int i = 0; i < CONCURRENTSKIPLIST_MAX_LEVEL; i++) {
+        this->m_head[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+template<typename K, typename V>
+cslib::ConcurrentSkipList<K, V>::ConcurrentSkipList(const ConcurrentSkipList<K, V>& p_list) : ConcurrentSkipList() {
+    *this = p_list;
+}
+
+template<typename K, typename V>
+cslib::ConcurrentSkipList<K, V>& cslib::ConcurrentSkipList<K, V>::operator= (const ConcurrentSkipList<K, V>& p_list) {
+    if (this != &p_list) {
+        this->m_clear();
+        for (ConstIterator it = p_list.cbegin(); it != p_list.cend(); ++it) {
+            this->insert(it.key(), *it);
+        }
+    }
+    return *this;
+}
+
+template<typename K, typename V>
+cslib::ConcurrentSkipList<K, V>::~ConcurrentSkipList() {
+    this->m_clear();
+}
+
+template<typename K, typename V>
+size_t cslib::ConcurrentSkipList<K, V>::size() const {
+    return this->m_size.load(std::memory_order_relaxed);
+}
+
+template<typename K, typename V>
+bool cslib::ConcurrentSkipList<K, V>::empty() const {
+    return (this->size() == 0);
+}
+
+template<typename K, typename V>
+bool cslib::ConcurrentSkipList<K, V>::insert(const K& p_key, const V& p_value) {
+    EpochGuard guard;
+    Node* preds[CONCURRENTSKIPLIST_MAX_LEVEL];
+    Node* succs[CONCURRENTSKIPLIST_MAX_LEVEL];
+    Node* node = nullptr;
+    int height = ms_height();
+
+    // Link it into the bottom, that's when it's in the list
+    while (true) {
+        if (this->m_find(p_key, preds, succs)) {
+            if (node != nullptr) {
+                ms_destroy(node);
+            }
+            return false;
+        }
+
+        if (node == nullptr) {
+            node = ms_create(p_key, p_value, height);
+        }
+        for (int i = 0; i < height; i++) {
+            node->next()[i].store(reinterpret_cast<uintptr_t>(succs[i]), std::memory_order_relaxed);
+        }
+
+        uintptr_t expected = reinterpret_cast<uintptr_t>(succs[0]);
+        if (this->m_next(preds[0], 0).compare_exchange_strong(expected, reinterpret_cast<uintptr_t>(node), std::memory_order_seq_cst)) {
+            break;
+        }
+    }
+    this->m_size.fetch_add(1, std::memory_order_relaxed);
+
+    // Then the levels above, giving up if somebody starts erasing it
+    for (int i = 1; i < height; i++) {
+        while (true) {
+            // Point it at the latest successor unless it is being erased
+            uintptr_t next = node->next()[i].load(std::memory_order_seq_cst);
+            if (ms_marked(next)) {
+                break;
+            }
+            if (ms_node(next) != succs[i] && !node->next()[i].compare_exchange_strong(next, reinterpret_cast<uintptr_t>(succs[i]), std::memory_order_seq_cst)) {
+                break;
+            }
+
+            uintptr_t expected = reinterpret_cast<uintptr_t>(succs[i]);
+            if (this->m_next(preds[i], i).compare_exchange_strong(expected, reinterpret_cast<uintptr_t>(node), std::memory_order_seq_cst)) {
+                break;
+            }
+
+            // Something changed, find where it goes again
+            if (!this->m_find(p_key, preds, succs) || succs[0] != node) {
+                break;
+            }
+        }
+
+        // It might have been erased while we linked, then we might be the last to see it
+        if (ms_marked(node->next()[i].load(std::memory_order_seq_cst))) {
+            this->m_find(p_key, preds, succs);
+            break;
+        }
+    }
+
+    ms_release(node);
+    return true;
+}
+
+template<typename K, typename V>
+bool cslib::ConcurrentSkipList<K, V>::find(const K& p_key, V& p_value) const {
+    EpochGuard guard;
+    const Node* node = this->m_lowerBound(p_key);
+    if (node == nullptr || p_key < node->key) {
+        return false;
+    }
+
+    p_value = node->value;
+    return true;
+}
+
+template<typename K, typename V>
+bool cslib::ConcurrentSkipList<K, V>::contains(const K& p_key) const {
+    EpochGuard guard;
+    const Node* node = this->m_lowerBound(p_key);
+    return (node != nullptr && !(p_key < node->key));
+}
+
+template<typename K, typename V>
+bool cslib::ConcurrentSkipList<K, V>::erase(const K& p_key) {
+    EpochGuard guard;
+    Node* preds[CONCURRENTSKIPLIST_MAX_LEVEL];
+    Node* succs[CONCURRENTSKIPLIST_MAX_LEVEL];
+
+    if (!this->m_find(p_key, preds, succs)) {
+        return false;
+    }
+    Node* node = succs[0];
+
+    // Mark the levels above, nobody links past it on them anymore
+    for (int i = node->height - 1; i > 0; i--) {
+        uintptr_t next = node->next()[i].load(std::memory_order_seq_cst);
+        while (!ms_marked(next)) {
+            node->next()[i].compare_exchange_weak(next, next | 1, std::memory_order_seq_cst);
+        }
+    }
+
+    // Whoever marks the bottom erased it
+    uintptr_t next = node->next()[0].load(std::memory_order_seq_cst);
+    while (true) {
+        if (ms_marked(next)) {
+            return false;
+        }
+        if (node->next()[0].compare_exchange_weak(next, next | 1, std::memory_order_seq_cst)) {
+            break;
+        }
+    }
+    this->m_size.fetch_sub(1, std::memory_order_relaxed);
+
+    // Unlink it everywhere
+    this->m_find(p_key, preds, succs);
+    ms_release(node);
+    return true;
+}
+
+template<typename K, typename V>
+template<typename F>
+size_t cslib::ConcurrentSkipList<K, V>::range(const K& p_from, const K& p_to, F p_visit) const {
+    size_t count = 0;
+    for (ConstIterator it = this->lowerBound(p_from); it != this->cend() && it.key() < p_to; ++it) {
+        p_visit(it.key(), *it);
+        count++;
+    }
+    return count;
+}
+
+template<typename K, typename V>
+typename cslib::ConcurrentSkipList<K, V>::ConstIterator cslib::ConcurrentSkipList<K, V>::cbegin() const {
+    // Pin first so the node can't go while we step onto it
+    ConstIterator it;
+    const Node* node = ms_node(this->m_head[0].load(std::memory_order_seq_cst));
+    while (node != nullptr && ms_marked(node->next()[0].load(std::memory_order_seq_cst))) {
+        node = ms_node(node->next()[0].load(std::memory_order_seq_cst));
+    }
+    it = ConstIterator(node);
+    return it;
+}
+
+template<typename K, typename V>
+typename cslib::ConcurrentSkipList<K, V>::ConstIterator cslib::ConcurrentSkipList<K, V>::lowerBound(const K& p_key) const {
+    ConstIterator it;
+    it = ConstIterator(this->m_lowerBound(p_key));
+    return it;
+}
+
+template<typename K, typename V>
+typename cslib::ConcurrentSkipList<K, V>::ConstIterator cslib::ConcurrentSkipList<K, V>::cend() const {
+    return ConstIterator(nullptr);
+}
+
+template<typename K, typename V>
+typename cslib::ConcurrentSkipList<K, V>::Node* cslib::ConcurrentSkipList<K, V>::ms_node(uintptr_t p_link) {
+    return reinterpret_cast<Node*>(p_link & ~(uintptr_t)1);
+}
+
+template<typename K, typename V>
+bool cslib::ConcurrentSkipList<K, V>::ms_marked(uintptr_t p_link) {
+    return ((p_link & 1) != 0);
+}
+
+template<typename K, typename V>
+std::atomic<uintptr_t>& cslib::ConcurrentSkipList<K, V>::m_next(Node* p_pred, int p_level) const {
+    return (p_pred == nullptr) ? this->m_head[p_level] : p_pred->next()[p_level];
+}
+
+template<typename K, typename V>
+bool cslib::ConcurrentSkipList<K, V>::m_find(const K& p_key, Node** p_preds, Node** p_succs) const {
+retry:
+    Node* pred = nullptr;
+    for (int level = CONCURRENTSKIPLIST_MAX_LEVEL - 1; level >= 0; level--) {
+        Node* curr = ms_node(this->m_next(pred, level).load(std::memory_order_seq_cst));
+        while (curr != nullptr) {
+            uintptr_t next = curr->next()[level].load(std::memory_order_seq_cst);
+
+            // Unlink erased nodes, start over if the node before got erased too
+            if (ms_marked(next)) {
+                uintptr_t expected = reinterpret_cast<uintptr_t>(curr);
+                if (!this->m_next(pred, level).compare_exchange_strong(expected, next & ~(uintptr_t)1, std::memory_order_seq_cst)) {
+                    goto retry;
+                }
+                curr = ms_node(next);
+                continue;
+            }
+
+            if (!(curr->key < p_key)) {
+                break;
+            }
+            pred = curr;
+            curr = ms_node(next);
+        }
+
+        p_preds[level] = pred;
+        p_succs[level] = curr;
+    }
+
+    return (p_succs[0] != nullptr && !(p_key < p_succs[0]->key));
+}
+
+template<typename K, typename V>
+const typename cslib::ConcurrentSkipList<K, V>::Node* cslib::ConcurrentSkipList<K, V>::m_lowerBound(const K& p_key) const {
+    // Like find, but steps over erased nodes instead of unlinking them
+    Node* pred = nullptr;
+    Node* curr = nullptr;
+    for (int level = CONCURRENTSKIPLIST_MAX_LEVEL - 1; level >= 0; level--) {
+        curr = ms_node(this->m_next(pred, level).load(std::memory_order_seq_cst));
+        while (curr != nullptr) {
+            uintptr_t next = curr->next()[level].load(std::memory_order_seq_cst);
+            if (ms_marked(next) || curr->key < p_key) {
+                if (!ms_marked(next)) {
+                    pred = curr;
+                }
+                curr = ms_node(next);
+                continue;
+            }
+            break;
+        }
+    }
+    return curr;
+}
+
+template<typename K, typename V>
+typename cslib::ConcurrentSkipList<K, V>::Node* cslib::ConcurrentSkipList<K, V>::ms_create(const K& p_key, const V& p_value, int p_height) {
+    // The next pointers go right after the node
+    void* memory = ::operator new(sizeof(Node) + sizeof(std::atomic<uintptr_t>) * p_height);
+    Node* node = nullptr;
+    try {
+        node = new (memory) Node{ p_key, p_value, p_height, {} };
+    } catch (...) {
+        ::operator delete(memory);
+        throw;
+    }
+
+    node->owners.store(2, std::memory_order_relaxed);
+    for (int i = 0; i < p_height; i++) {
+        new (&node->next()[i]) std::atomic<uintptr_t>(0);
+    }
+    return node;
+}
+
+template<typename K, typename V>
+void cslib::ConcurrentSkipList<K, V>::ms_destroy(void* p_node) {
+    Node* node = static_cast<Node*>(p_node);
+    node->~Node();
+    ::operator delete(p_node);
+}
+
+template<typename K, typename V>
+void cslib::ConcurrentSkipList<K, V>::ms_release(Node* p_node) {
+    if (p_node->owners.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        Epoch::retire(p_node, ms_destroy);
+    }
+}
+
+template<typename K, typename V>
+int cslib::ConcurrentSkipList<K, V>::ms_height() {
+    // Xorshift per thread, two bits per level
+    thread_local uint64_t seed = 0x9E3779B97F4A7C15ull ^ reinterpret_cast<uintptr_t>(&seed);
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    int height = 1;
+    uint64_t bits = seed;
+    while (height < CONCURRENTSKIPLIST_MAX_LEVEL && (bits & 3) == 0) {
+        height++;
+        bits >>= 2;
+    }
+    return height;
+}
+
+template<typename K, typename V>
+void cslib::ConcurrentSkipList<K, V>::m_clear() {
+    // Erased nodes are already with Epoch, everything else is on the bottom
+    Node* node = ms_node(this->m_head[0].load(std::memory_order_acquire));
+    while (node != nullptr) {
+        uintptr_t next = node->next()[0].load(std::memory_order_relaxed);
+        if (!ms_marked(next)) {
+            ms_destroy(node);
+        }
+        node = ms_node(next);
+    }
+
+    for (int i = 0; i < CONCURRENTSKIPLIST_MAX_LEVEL; i++) {
+        this->m_head[i].store(0, std::memory_order_relaxed);
+    }
+    this->m_size.store(0, std::memory_order_relaxed);
+}
+
+
+
+
+
+
+
+
+
+
+
+template<typename K, typename V>
+cslib::ConcurrentSkipList<K, V>::ConstIterator::ConstIterator(const Node* p_ptr) {
+    Epoch::pin();
+    this->m_ptr = p_ptr;
+}
+
+template<typename K, typename V>
+cslib::ConcurrentSkipList<K, V>::ConstIterator::ConstIterator(const ConstIterator& p_it) : cslib::ConstIterator<Node>(p_it.m_ptr) {
+    // Each copy holds its own pin
+    Epoch::pin();
+}
+
+template<typename K, typename V>
+typename cslib::ConcurrentSkipList<K, V>::ConstIterator& cslib::ConcurrentSkipList<K, V>::ConstIterator::operator= (const ConstIterator& p_it) {
+    this->m_ptr = p_it.m_ptr;
+    return *this;
+}
+
+template<typename K, typename V>
+cslib::ConcurrentSkipList<K, V>::ConstIterator::~ConstIterator() {
+    Epoch::unpin();
+}
+
+template<typename K, typename V>
+typename cslib::ConcurrentSkipList<K, V>::ConstIterator& cslib::ConcurrentSkipList<K, V>::ConstIterator::operator++() {
+    // Skip the ones erased since
+    do {
+        this->m_ptr = ms_node(this->m_ptr->next()[0].load(std::memory_order_seq_cst));
+    } while (this->m_ptr != nullptr && ms_marked(this->m_ptr->next()[0].load(std::memory_order_seq_cst)));
+    return *this;
+}
+
+template<typename K, typename V>
+const K& cslib::ConcurrentSkipList<K, V>::ConstIterator::key() {
+    return this->m_ptr->key;
+}
+
+template<typename K, typename V>
+const V& cslib::ConcurrentSkipList<K, V>::ConstIterator::operator*() {
+    return this->m_ptr->value;
+}
+
+template<typename K, typename V>
+const V* cslib::ConcurrentSkipList<K, V>::ConstIterator::operator->() {
+    return &(this->m_ptr->value);
+}
+
+
+#endif
@@ -0,0 +1,313 @@
+/**
+ * @file ConcurrentStack.h
+ * @brief Holds the ConcurrentStack, a last-in-first out structure many threads can use without locks.
+ **/
+#ifndef CSCONCURRENTSTACK_H
+#define CSCONCURRENTSTACK_H
+
+#include "Universal.h"
+#include "Epoch.h"
+#include "Stack.h"
+
+#include <atomic>
+
+/// How many slots pushes and pops can meet in when the top is contended.
+#define CONCURRENTSTACK_ELIMINATION_SLOTS 8
+
+/// How many times a push waits in a slot for a pop before taking its value back.
+#define CONCURRENTSTACK_ELIMINATION_SPINS 128
+
+namespace cslib {
+    /**
+     * @class ConcurrentStack
+     * @tparam T Type of the data structure.
+     * @brief A lock free Last-in-first out data structure, a Treiber stack with elimination.
+     *
+     * Push and pop swap the top with a compare and exchange. Popped nodes are retired through
+     * Epoch, so a node can't be freed and reused while another thread still holds it, which is
+     * what would otherwise let the top be swapped under a stale next pointer (ABA).
+     *
+     * When the exchange fails, a push leaves its node in a random elimination slot for a moment
+     * and a pop looks in one. If they meet, they cancel out without touching the top at all.
+     **/
+    template<typename T>
+    class ConcurrentStack {
+    protected:
+        /**
+         * @structure Node
+         * @brief The node of some sort of data
+         **/
+        struct Node {
+            /// Actual data.
+            T data;
+            /// The node under.
+            Node* next;
+        };
+
+        /**
+         * @struct Slot
+         * @brief Where a push waits for a pop, one cache line each
+         **/
+        struct alignas(64) Slot {
+            /// The node waiting, nullptr if none
+            std::atomic<Node*> node{ nullptr };
+        };
+
+    public:
+        /**
+         * @brief Constructs an empty stack
+         */
+        ConcurrentStack();
+
+        /**
+         * @brief Frees every node, nobody can be using it
+         */
+        ~ConcurrentStack();
+
+        /// Copying can't be done safely while others use it
+        ConcurrentStack(const ConcurrentStack<T>&) = delete;
+        ConcurrentStack<T>& operator= (const ConcurrentStack<T>&) = delete;
+
+        /**
+         * @brief Returns true if there was no data in the data structure when we looked.
+         * @return True if empty, false if at least one item.
+         */
+        bool empty() const;
+
+        /**
+         * @param p_data The data we are adding to the top of the stack.
+         *
+         * @brief Adds the parameter into the top of the stack
+         */
+        void push(const T& p_data);
+
+        /**
+         * @param p_data Gets the popped value
+         *
+         * @brief Removes the top value from the stack if there is one.
+         * @return Returns false if the stack was empty
+         */
+        bool tryPop(T& p_data);
+
+        /**
+         * @brief Removes the top value from the stack.
+         * @return Gives the popped value back
+         */
+        T pop();
+
+        /**
+         * @brief Gets how many push and pop pairs met in the elimination slots
+         * @return Returns the amount
+         */
+        size_t eliminated() const;
+
+    protected:
+        /**
+         * @param p_node The node we're pushing
+         *
+         * @brief Tries once to put the node on top
+         * @return Returns false if another thread got there first
+         */
+        bool m_tryPush(Node* p_node);
+
+        /**
+         * @param p_node Gets the node we popped, nullptr if the stack was empty
+         *
+         * @brief Tries once to take the top node off, the thread must be pinned
+         * @return Returns false if another thread got there first
+         */
+        bool m_tryPop(Node*& p_node);
+
+        /**
+         * @param p_node The node we're pushing
+         *
+         * @brief Waits in a slot for a pop to take the node
+         * @return Returns true if a pop took it
+         */
+        bool m_eliminatePush(Node* p_node);
+
+        /**
+         * @brief Looks in a slot for a waiting push
+         * @return Returns the node we took, nullptr if none
+         */
+        Node* m_eliminatePop();
+
+        /**
+         * @brief Picks a slot at random, per thread
+         * @return Returns the slot
+         */
+        Slot& m_slot();
+
+        /**
+         * @param p_node The node we're freeing, the type is erased for Epoch
+         *
+         * @brief Frees the node
+         */
+        static void ms_destroy(void* p_node);
+
+        /// The top of the stack
+        alignas(64) std::atomic<Node*> m_top;
+
+        /// Where pushes and pops meet
+        Slot m_slots[CONCURRENTSTACK_ELIMINATION_SLOTS];
+
+        /// How many pairs met
+        std::atomic<size_t> m_eliminated;
+    };
+}
+
+template<typename T>
+cslib::ConcurrentStack<T>::ConcurrentStack() : m_top(nullptr), m_eliminated(0) {
+
+}
+
+template<typename T>
+cslib::ConcurrentStack<T>::~ConcurrentStack() {
+    Node* node = this->m_top.load(std::memory_order_acquire);
+    while (node != nullptr) {
+        Node* next = node->next;
+        delete node;
+        node = next;
+    }
+}
+
+template<typename T>
+bool cslib::ConcurrentStack<T>::empty() const {
+    return (this->m_top.load(std::memory_order_acquire) == nullptr);
+}
+
+template<typename T>
+void cslib::ConcurrentStack<T>::push(const T& p_data) {
+    Node* node = nullptr;
+    try {
+        node = new Node{ p_data, nullptr };
+    } catch (const std::bad_alloc&) {
+        throw StackOverflow();
+    }
+
+    // Back off into a slot whenever the top is fought over
+    while (!this->m_tryPush(node)) {
+        if (this->m_eliminatePush(node)) {
+            return;
+        }
+    }
+}
+
+template<typename T>
+bool cslib::ConcurrentStack<T>::tryPop(T& p_data) {
+    EpochGuard guard;
+    while (true) {
+        Node* node = nullptr;
+        if (this->m_tryPop(node)) {
+            if (node == nullptr) {
+                return false;
+            }
+
+            // Others might still be reading its next pointer
+            p_data = node->data;
+            Epoch::retire(node, ms_destroy);
+            return true;
+        }
+
+        // A push handed it straight to us, nobody else ever saw it
+        node = this->m_eliminatePop();
+        if (node != nullptr) {
+            p_data = node->data;
+            delete node;
+            return true;
+        }
+    }
+}
+
+template<typename T>
+T cslib::ConcurrentStack<T>::pop() {
+    T data;
+    if (!this->tryPop(data)) {
+        throw StackUnderflow();
+    }
+    return data;
+}
+
+template<typename T>
+size_t cslib::ConcurrentStack<T>::eliminated() const {
+    return this->m_eliminated.load(std::memory_order_relaxed);
+}
+
+template<typename T>
+bool cslib::ConcurrentStack<T>::m_tryPush(Node* p_node) {
+    Node* top = this->m_top.load(std::memory_order_relaxed);
+    p_node->next = top;
+    return this->m_top.compare_exchange_weak(top, p_node, std::memory_order_release, std::memory_order_relaxed);
+}
+
+template<typename T>
+bool cslib::ConcurrentStack<T>::m_tryPop(Node*& p_node) {
+    Node* top = this->m_top.load(std::memory_order_acquire);
+    if (top == nullptr) {
+        p_node = nullptr;
+        return true;
+    }
+
+    // Safe to read while we're pinned, even if it was just popped
+    Node* next = top->next;
+    if (this->m_top.compare_exchange_weak(top, next, std::memory_order_acquire, std::memory_order_relaxed)) {
+        p_node = top;
+        return true;
+    }
+    return false;
+}
+
+template<typename T>
+bool cslib::ConcurrentStack<T>::m_eliminatePush(Node* p_node) {
+    Slot& slot = this->m_slot();
+    Node* expected = nullptr;
+    if (!slot.node.compare_exchange_strong(expected, p_node, std::memory_order_release, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    // Wait for a pop to take it
+    for (int i = 0; i < CONCURRENTSTACK_ELIMINATION_SPINS; i++) {
+        if (slot.node.load(std::memory_order_acquire) != p_node) {
+            this->m_eliminated.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    // Take it back, unless a pop beat us to it
+    expected = p_node;
+    if (slot.node.compare_exchange_strong(expected, nullptr, std::memory_order_acquire, std::memory_order_relaxed)) {
+        return false;
+    }
+    this->m_eliminated.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+template<typename T>
+typename cslib::ConcurrentStack<T>::Node* cslib::ConcurrentStack<T>::m_eliminatePop() {
+    Slot& slot = this->m_slot();
+    for (int i = 0; i < CONCURRENTSTACK_ELIMINATION_SPINS / 4; i++) {
+        Node* node = slot.node.load(std::memory_order_acquire);
+        if (node != nullptr && slot.node.compare_exchange_strong(node, nullptr, std::memory_order_acquire, std::memory_order_relaxed)) {
+            return node;
+        }
+    }
+    return nullptr;
+}
+
+template<typename T>
+typename cslib::ConcurrentStack<T>::Slot& cslib::ConcurrentStack<T>::m_slot() {
+    // Xorshift per thread
+    thread_local uint32_t seed = 2463534242u ^ (uint32_t)reinterpret_cast<uintptr_t>(&seed);
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    return this->m_slots[seed % CONCURRENTSTACK_ELIMINATION_SLOTS];
+}
+
+template<typename T>
+void cslib::ConcurrentStack<T>::ms_destroy(void* p_node) {
+    delete static_cast<Node*>(p_node);
+}
+
+
+#endif
@@ -0,0 +1,666 @@
+/**
+ * @file Deque.h
+ * @brief Holds the Deque, a double ended queue kept in fixed size blocks.
+ **/
+#ifndef CSDEQUE_H
+#define CSDEQUE_H
+
+#include "Universal.h"
+
+#include <new>
+#include <string.h>
+#include <utility>
+
+/// Roughly how many bytes a block of values takes.
+#define DEQUE_BLOCK_BYTES 512
+
+/// How many block pointers the map starts with.
+#define DEQUE_MAP_MIN 8
+
+namespace cslib {
+    /**
+     * @class Deque
+     * @tparam T Type of the data structure.
+     * @brief A double ended queue, values can go on and off both ends and be read by index.
+     *
+     * The values sit in fixed size blocks and a map keeps the blocks in order. Only the map is ever
+     * copied when it grows, the values stay where they are, so references to them stay valid while
+     * values are pushed. A block that empties is kept as a spare, so going back and forth over a
+     * block edge doesn't allocate every time.
+     **/
+    template<typename T>
+    class Deque {
+    protected:
+        /**
+         * @param p_count The most values we want in a block
+         *
+         * @brief Rounds down to a power of two, at least 16
+         * @return Returns the power of two
+         */
+        static constexpr size_t ms_blockSize(size_t p_count, size_t p_power = 16) {
+            return (p_power * 2 > p_count) ? p_power : ms_blockSize(p_count, p_power * 2);
+        }
+
+    public:
+        /// How many values fit in a block
+        static constexpr size_t BLOCK_SIZE = ms_blockSize(DEQUE_BLOCK_BYTES / sizeof(T));
+
+        /**
+         * @class Iterator
+         * @brief Walks the deque from the front to the back.
+         **/
+        class Iterator : public cslib::Iterator<T> {
+        public:
+            /**
+             * @param p_block Where the block we're in is in the map
+             * @param p_offset The index in the block
+             * @param p_left How many values there are from here to the back, 0 for the end
+             *
+             * @brief Constructs the Iterator
+             */
+            Iterator(T** p_block = nullptr, size_t p_offset = 0, size_t p_left = 0);
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            Iterator& operator++();
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value before moving
+             */
+            Iterator  operator++(int);
+
+        private:
+            /// Where the block we're in is in the map
+            T** m_block;
+            /// The index in the block
+            size_t m_offset;
+            /// How many values are left, this one included
+            size_t m_left;
+        };
+
+        /**
+         * @class ConstIterator
+         * @brief Walks the deque from the front to the back.
+         **/
+        class ConstIterator : public cslib::ConstIterator<T> {
+        public:
+            /**
+             * @param p_block Where the block we're in is in the map
+             * @param p_offset The index in the block
+             * @param p_left How many values there are from here to the back, 0 for the end
+             *
+             * @brief Constructs the Iterator
+             */
+            ConstIterator(T* const* p_block = nullptr, size_t p_offset = 0, size_t p_left = 0);
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            ConstIterator& operator++();
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value before moving
+             */
+            ConstIterator  operator++(int);
+
+        private:
+            /// Where the block we're in is in the map
+            T* const* m_block;
+            /// The index in the block
+            size_t m_offset;
+            /// How many values are left, this one included
+            size_t m_left;
+        };
+
+        /**
+         * @brief Constructs the class, nothing is allocated until the first push
+         */
+        Deque();
+
+        /**
+         * @brief Deep copies the deque
+         */
+        Deque(const Deque<T>& p_deque);
+
+        /**
+         * @brief Deep copies the deque.
+         * @return Returns "this" data structure
+         */
+        Deque<T>& operator= (const Deque<T>& p_deque);
+
+        /**
+         * @brief Destroys the class
+         */
+        ~Deque();
+
+        /**
+         * @brief Gets the amount of values, O(1)
+         * @return Returns the amount of values
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if the data structure is empty
+         * @return Returns true if empty, false if not.
+         */
+        bool empty() const;
+
+        /**
+         * @param p_index The index from the front
+         *
+         * @brief Gets a value by index, O(1)
+         * @return Returns the value
+         */
+        T& operator[](size_t p_index);
+
+        /**
+         * @param p_index The index from the front
+         *
+         * @brief Gets a value by index, O(1)
+         * @return Returns the value
+         */
+        const T& operator[](size_t p_index) const;
+
+        /**
+         * @brief Gets the front value
+         * @return Returns the front value
+         */
+        T& front();
+
+        /**
+         * @brief Gets the front value
+         * @return Returns the front value
+         */
+        const T& front() const;
+
+        /**
+         * @brief Gets the back value
+         * @return Returns the back value
+         */
+        T& back();
+
+        /**
+         * @brief Gets the back value
+         * @return Returns the back value
+         */
+        const T& back() const;
+
+        /**
+         * @param p_data The data we're adding
+         *
+         * @brief Adds the value to the front
+         * @return Returns the value that was just placed in.
+         */
+        T& pushFront(const T& p_data);
+
+        /**
+         * @param p_data The data we're adding
+         *
+         * @brief Adds the value to the back
+         * @return Returns the value that was just placed in.
+         */
+        T& pushBack(const T& p_data);
+
+        /**
+         * @brief Takes the front value off
+         * @return Returns the value that was at the front
+         */
+        T popFront();
+
+        /**
+         * @brief Takes the back value off
+         * @return Returns the value that was at the back
+         */
+        T popBack();
+
+        /**
+         * @brief Removes every value, keeps one block
+         */
+        void clear();
+
+        /**
+         * @brief Gets the iterator to the front of the data structure.
+         * @return Returns a iterator to the value
+         */
+        Iterator begin();
+
+        /**
+         * @brief Gets the iterator to the front of the data structure.
+         * @return Returns a iterator to the value
+         */
+        ConstIterator cbegin() const;
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the value
+         */
+        Iterator end();
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the value
+         */
+        ConstIterator cend() const;
+
+    protected:
+        /**
+         * @param p_index The index from the front, must be in range
+         *
+         * @brief Finds the value
+         * @return Returns the value
+         */
+        T* m_at(size_t p_index) const;
+
+        /**
+         * @brief Gets a block, the spare if there is one
+         * @return Returns the block, raw memory
+         */
+        T* m_block();
+
+        /**
+         * @param p_block The block, nothing is in it anymore
+         *
+         * @brief Keeps the block as the spare or frees it
+         */
+        void m_release(T* p_block);
+
+        /**
+         * @brief Centers the block pointers so both ends have room, in a map twice as big only if over half of it is used
+         */
+        void m_grow();
+
+        /**
+         * @brief Gets how many blocks hold values, at least the first
+         * @return Returns the amount
+         */
+        size_t m_used() const;
+
+        /// The blocks in order, nullptr where there are none
+        T** m_map;
+
+        /// How many block pointers fit in the map
+        size_t m_mapSize;
+
+        /// Where the front block is in the map
+        size_t m_first;
+
+        /// Where the front value is in the front block
+        size_t m_head;
+
+        /// The amount of values
+        size_t m_size;
+
+        /// An empty block kept for the next push past a block edge
+        T* m_spare;
+    };
+}
+
+template<typename T>
+cslib::Deque<T>::Deque() : m_map(nullptr), m_mapSize(0), m_first(0), m_head(0), m_size(0), m_spare(nullptr) {
+
+}
+
+template<typename T>
+cslib::Deque<T>::Deque(const Deque<T>& p_deque) : m_map(nullptr), m_mapSize(0), m_first(0), m_head(0), m_size(0), m_spare(nullptr) {
+    *this = p_deque;
+}
+
+template<typename T>
+cslib::Deque<T>& cslib::Deque<T>::operator= (const Deque<T>& p_deque) {
+    if (this == &p_deque) {
+        return *this;
+    }
+
+    this->clear();
+    for (ConstIterator it = p_deque.cbegin(); it != p_deque.cend(); ++it) {
+        this->pushBack(*it);
+    }
+    return *this;
+}
+
+template<typename T>
+cslib::Deque<T>::~Deque() {
+    this->clear();
+    for (size_t i = 0; i < this->m_mapSize; i++) {
+        ::operator delete(this->m_map[i], std::align_val_t(alignof(T)));
+    }
+    ::operator delete(this->m_spare, std::align_val_t(alignof(T)));
+    delete[] this->m_map;
+}
+
+template<typename T>
+size_t cslib::Deque<T>::size() const {
+    return this->m_size;
+}
+
+template<typename T>
+bool cslib::Deque<T>::empty() const {
+    return (this->m_size == 0);
+}
+
+template<typename T>
+T& cslib::Deque<T>::operator[](size_t p_index) {
+    if (p_index >= this->m_size) {
+        throw OutOfRange();
+    }
+    return *this->m_at(p_index);
+}
+
+template<typename T>
+const T& cslib::Deque<T>::operator[](size_t p_index) const {
+    if (p_index >= this->m_size) {
+        throw OutOfRange();
+    }
+    return *this->m_at(p_index);
+}
+
+template<typename T>
+T& cslib::Deque<T>::front() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return *this->m_at(0);
+}
+
+template<typename T>
+const T& cslib::Deque<T>::front() const {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return *this->m_at(0);
+}
+
+template<typename T>
+T& cslib::Deque<T>::back() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return *this->m_at(this->m_size - 1);
+}
+
+template<typename T>
+const T& cslib::Deque<T>::back() const {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return *this->m_at(this->m_size - 1);
+}
+
+template<typename T>
+T& cslib::Deque<T>::pushFront(const T& p_data) {
+    // Step back into the block before, making it if needed
+    if (this->m_map == nullptr || this->m_head == 0) {
+        if (this->m_map == nullptr || this->m_first == 0) {
+            this->m_grow();
+        }
+        if (this->m_head == 0) {
+            if (this->m_map[this->m_first - 1] == nullptr) {
+                this->m_map[this->m_first - 1] = this->m_block();
+            }
+            this->m_first--;
+            this->m_head = BLOCK_SIZE;
+        }
+    }
+
+    T* value = new (&this->m_map[this->m_first][this->m_head - 1]) T(p_data);
+    this->m_head--;
+    this->m_size++;
+    return *value;
+}
+
+template<typename T>
+T& cslib::Deque<T>::pushBack(const T& p_data) {
+    size_t end = this->m_head + this->m_size;
+    if (this->m_map == nullptr || this->m_first + end / BLOCK_SIZE >= this->m_mapSize) {
+        this->m_grow();
+        end = this->m_head + this->m_size;
+    }
+
+    T*& block = this->m_map[this->m_first + end / BLOCK_SIZE];
+    if (block == nullptr) {
+        block = this->m_block();
+    }
+
+    T* value = new (&block[end % BLOCK_SIZE]) T(p_data);
+    this->m_size++;
+    return *value;
+}
+
+template<typename T>
+T cslib::Deque<T>::popFront() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+
+    T* value = &this->m_map[this->m_first][this->m_head];
+    T temp = std::move(*value);
+    value->~T();
+
+    this->m_head++;
+    this->m_size--;
+
+    // Done with the front block, unless it's the only one
+    if (this->m_head == BLOCK_SIZE) {
+        if (this->m_size == 0) {
+            this->m_head = 0;
+        } else {
+            this->m_release(this->m_map[this->m_first]);
+            this->m_map[this->m_first] = nullptr;
+            this->m_first++;
+            this->m_head = 0;
+        }
+    }
+    return temp;
+}
+
+template<typename T>
+T cslib::Deque<T>::popBack() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+
+    T* value = this->m_at(this->m_size - 1);
+    T temp = std::move(*value);
+    value->~T();
+    this->m_size--;
+
+    // Done with the back block, unless it's the front one
+    size_t end = this->m_head + this->m_size;
+    if (end % BLOCK_SIZE == 0 && end > 0) {
+        T*& block = this->m_map[this->m_first + end / BLOCK_SIZE];
+        this->m_release(block);
+        block = nullptr;
+    }
+    return temp;
+}
+
+template<typename T>
+void cslib::Deque<T>::clear() {
+    while (!this->empty()) {
+        this->popBack();
+    }
+}
+
+template<typename T>
+typename cslib::Deque<T>::Iterator cslib::Deque<T>::begin() {
+    if (this->empty()) {
+        return Iterator();
+    }
+    return Iterator(&this->m_map[this->m_first], this->m_head, this->m_size);
+}
+
+template<typename T>
+typename cslib::Deque<T>::ConstIterator cslib::Deque<T>::cbegin() const {
+    if (this->empty()) {
+        return ConstIterator();
+    }
+    return ConstIterator(&this->m_map[this->m_first], this->m_head, this->m_size);
+}
+
+template<typename T>
+typename cslib::Deque<T>::Iterator cslib::Deque<T>::end() {
+    return Iterator();
+}
+
+template<typename T>
+typename cslib::Deque<T>::ConstIterator cslib::Deque<T>::cend() const {
+    return ConstIterator();
+}
+
+template<typename T>
+T* cslib::Deque<T>::m_at(size_t p_index) const {
+    size_t position = this->m_head + p_index;
+    return &this->m_map[this->m_first + position / BLOCK_SIZE][position % BLOCK_SIZE];
+}
+
+template<typename T>
+T* cslib::Deque<T>::m_block() {
+    if (this->m_spare != nullptr) {
+        T* block = this->m_spare;
+        this->m_spare = nullptr;
+        return block;
+    }
+    return static_cast<T*>(::operator new(sizeof(T) * BLOCK_SIZE, std::align_val_t(alignof(T))));
+}
+
+template<typename T>
+void cslib::Deque<T>::m_release(T* p_block) {
+    if (this->m_spare == nullptr) {
+        this->m_spare = p_block;
+        return;
+    }
+    ::operator delete(p_block, std::align_val_t(alignof(T)));
+}
+
+template<typename T>
+void cslib::Deque<T>::m_grow() {
+    // The first push makes a map with one block in the middle, half full either way
+    if (this->m_map == nullptr) {
+        this->m_map = new T*[DEQUE_MAP_MIN]();
+        this->m_mapSize = DEQUE_MAP_MIN;
+        this->m_first = DEQUE_MAP_MIN / 2;
+        this->m_head = BLOCK_SIZE / 2;
+        this->m_map[this->m_first] = this->m_block();
+        return;
+    }
+
+    // Blocks left outside the ones in use would be lost when they move
+    size_t used = this->m_used();
+    for (size_t i = 0; i < this->m_mapSize; i++) {
+        if ((i < this->m_first || i >= this->m_first + used) && this->m_map[i] != nullptr) {
+            this->m_release(this->m_map[i]);
+            this->m_map[i] = nullptr;
+        }
+    }
+
+    // A window sliding one way only needs moving back to the middle, not a bigger map
+    if (used <= this->m_mapSize / 2) {
+        size_t first = (this->m_mapSize - used) / 2;
+        memmove(this->m_map + first, this->m_map + this->m_first, used * sizeof(T*));
+        for (size_t i = 0; i < this->m_mapSize; i++) {
+            if (i < first || i >= first + used) {
+                this->m_map[i] = nullptr;
+            }
+        }
+        this->m_first = first;
+        return;
+    }
+
+    size_t mapSize = this->m_mapSize * 2;
+    while (mapSize < used + 2) {
+        mapSize *= 2;
+    }
+
+    T** map = new T*[mapSize]();
+    size_t first = (mapSize - used) / 2;
+    for (size_t i = 0; i < used; i++) {
+        map[first + i] = this->m_map[this->m_first + i];
+    }
+
+    delete[] this->m_map;
+    this->m_map = map;
+    this->m_mapSize = mapSize;
+    this->m_first = first;
+}
+
+template<typename T>
+size_t cslib::Deque<T>::m_used() const {
+    size_t end = this->m_head + this->m_size;
+    return (end == 0) ? 1 : (end + BLOCK_SIZE - 1) / BLOCK_SIZE;
+}
+
+
+
+
+
+
+
+
+
+
+
+template<typename T>
+cslib::Deque<T>::Iterator::Iterator(T** p_block, size_t p_offset, size_t p_left) : m_block(p_block), m_offset(p_offset), m_left(p_left) {
+    this->m_ptr = (p_left == 0) ? nullptr : &(*p_block)[p_offset];
+}
+
+template<typename T>
+typename cslib::Deque<T>::Iterator& cslib::Deque<T>::Iterator::operator++() {
+    this->m_left--;
+    if (this->m_left == 0) {
+        this->m_ptr = nullptr;
+        return *this;
+    }
+
+    this->m_offset++;
+    if (this->m_offset == BLOCK_SIZE) {
+        this->m_block++;
+        this->m_offset = 0;
+    }
+    this->m_ptr = &(*this->m_block)[this->m_offset];
+    return *this;
+}
+
+template<typename T>
+typename cslib::Deque<T>::Iterator cslib::Deque<T>::Iterator::operator++(int) {
+    Iterator cpy = *this;
+    ++(*this);
+    return cpy;
+}
+
+template<typename T>
+cslib::Deque<T>::ConstIterator::ConstIterator(T* const* p_block, size_t p_offset, size_t p_left) : m_block(p_block), m_offset(p_offset), m_left(p_left) {
+    this->m_ptr = (p_left == 0) ? nullptr : &(*p_block)[p_offset];
+}
+
+template<typename T>
+typename cslib::Deque<T>::ConstIterator& cslib::Deque<T>::ConstIterator::operator++() {
+    this->m_left--;
+    if (this->m_left == 0) {
+        this->m_ptr = nullptr;
+        return *this;
+    }
+
+    this->m_offset++;
+    if (this->m_offset == BLOCK_SIZE) {
+        this->m_block++;
+        this->m_offset = 0;
+    }
+    this->m_ptr = &(*this->m_block)[this->m_offset];
+    return *this;
+}
+
+template<typename T>
+typename cslib::Deque<T>::ConstIterator cslib::Deque<T>::ConstIterator::operator++(int) {
+    ConstIterator cpy = *this;
+    ++(*this);
+    return cpy;
+}
+
+
+#endif
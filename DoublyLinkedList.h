@@ -0,0 +1,776 @@
+/**
+ * @file DoublyLinkedList.h
+ * @brief Holds the DoublyLinkedList data structure, nodes linked both ways.
+ **/
+#ifndef CSDOUBLYLINKEDLIST_H
+#define CSDOUBLYLINKEDLIST_H
+
+#include "Universal.h"
+#include "NodePool.h"
+#include "LinkedList.h"
+
+namespace cslib {
+    /**
+     * @class DoublyLinkedList
+     * @tparam T Type of the data structure.
+     * @brief A list where every node knows the one before and after, removing a known node is O(1).
+     **/
+    template<typename T>
+    class DoublyLinkedList {
+    protected:
+        /**
+         * @structure Node
+         * @brief The node of some sort of data
+         **/
+        struct Node {
+            /// Actual data.
+            T data;
+            /// The next node.
+            Node* next;
+            /// The node before.
+            Node* prev;
+        };
+
+    public:
+        /**
+         * @class Iterator
+         * @brief The iterator for a doubly linked list, can go forward and back.
+         *
+         * end() and rend() are the same place, -- from it gets the back and ++ gets the front.
+         **/
+        class Iterator : public cslib::Iterator<Node> {
+        public:
+            /**
+             * @param p_ptr The pointer of the Iterator
+             * @param p_list The list it walks, needed to step off end()
+             *
+             * @brief Constructs the Iterator
+             */
+            Iterator(Node* p_ptr = nullptr, const DoublyLinkedList<T>* p_list = nullptr);
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            Iterator& operator++();
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value before moving
+             */
+            Iterator  operator++(int);
+
+            /**
+             * @brief Gets the iterator before
+             * @return Returns the value that was before
+             */
+            Iterator& operator--();
+
+            /**
+             * @brief Gets the iterator before
+             * @return Returns the value before moving
+             */
+            Iterator  operator--(int);
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            T& operator* ();
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            T* operator->();
+
+        protected:
+            /// The list it walks
+            const DoublyLinkedList<T>* m_list;
+
+            friend class DoublyLinkedList<T>;
+        };
+
+        /**
+         * @class ConstIterator
+         * @brief The iterator for a doubly linked list, can go forward and back.
+         *
+         * cend() and crend() are the same place, -- from it gets the back and ++ gets the front.
+         **/
+        class ConstIterator : public cslib::ConstIterator<Node> {
+        public:
+            /**
+             * @param p_ptr The pointer of the Const Iterator
+             * @param p_list The list it walks, needed to step off cend()
+             *
+             * @brief Constructs the Iterator
+             */
+            ConstIterator(const Node* p_ptr = nullptr, const DoublyLinkedList<T>* p_list = nullptr);
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            ConstIterator& operator++();
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value before moving
+             */
+            ConstIterator  operator++(int);
+
+            /**
+             * @brief Gets the iterator before
+             * @return Returns the value that was before
+             */
+            ConstIterator& operator--();
+
+            /**
+             * @brief Gets the iterator before
+             * @return Returns the value before moving
+             */
+            ConstIterator  operator--(int);
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            const T& operator* ();
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            const T* operator->();
+
+        protected:
+            /// The list it walks
+            const DoublyLinkedList<T>* m_list;
+        };
+
+        /**
+         * @brief Constructs the class
+         */
+        DoublyLinkedList();
+
+        /**
+         * @brief Deep copies the list
+         */
+        DoublyLinkedList(const DoublyLinkedList<T>& p_list);
+
+        /**
+         * @brief Deep copies the list.
+         * @return Returns "this" data structure
+         */
+        DoublyLinkedList<T>& operator= (const DoublyLinkedList<T>& p_list);
+
+        /**
+         * @brief Destroys the class
+         */
+        ~DoublyLinkedList();
+
+        /**
+         * @brief Gets the size of the list
+         * @return Returns the amount of values in the list
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if there is no data in the data structure.
+         * @return True if empty, false if at least one item.
+         */
+        bool empty() const;
+
+        /**
+         * @param p_index The index of the node we wish
+         *
+         * @brief Gets an index of a value, walking from whichever end is closer.
+         * @return Returns the value in the correct node.
+         */
+        T& operator[](size_t p_index);
+
+        /**
+         * @param p_index The index of the node we wish
+         *
+         * @brief Gets an index of a value, walking from whichever end is closer.
+         * @return Returns the value in the correct node.
+         */
+        const T& operator[](size_t p_index) const;
+
+        /**
+         * @brief Gets the first value
+         * @return Returns the first value
+         */
+        T& front();
+
+        /**
+         * @brief Gets the last value
+         * @return Returns the last value
+         */
+        T& back();
+
+        /**
+         * @param p_data The data we are adding
+         *
+         * @brief Adds the value to the far end.
+         * @return Returns the value just inserted.
+         */
+        T& append(const T& p_data);
+
+        /**
+         * @param p_data The data we are adding
+         *
+         * @brief Adds the value to the front.
+         * @return Returns the value just inserted.
+         */
+        T& prepend(const T& p_data);
+
+        /**
+         * @param p_data The data we are adding
+         * @param p_index The index we are inserting into.
+         *
+         * @brief Adds the value to the index given (p_index)
+         * @return Returns the value just inserted.
+         */
+        T& insert(const T& p_data, size_t p_index);
+
+        /**
+         * @param p_it The iterator we are inserting in front of, end() appends
+         * @param p_data The data we are adding
+         *
+         * @brief Adds the value before the iterator in O(1), throws OutOfRange if it is from another list
+         * @return Returns an iterator to the value just inserted.
+         */
+        Iterator insert(Iterator p_it, const T& p_data);
+
+        /**
+         * @param p_index The index we are removing
+         *
+         * @brief Deletes the index given
+         * @return Returns the value just removed.
+         */
+        T remove(size_t p_index);
+
+        /**
+         * @param p_it The iterator of the node we are removing, it is no longer valid after
+         *
+         * @brief Deletes the node the iterator is on in O(1), throws OutOfRange on end() or if it is from another list
+         * @return Returns the value just removed.
+         */
+        T remove(Iterator p_it);
+
+        /**
+         * @brief Removes the first value
+         * @return Returns the value just removed.
+         */
+        T popFront();
+
+        /**
+         * @brief Removes the last value
+         * @return Returns the value just removed.
+         */
+        T popBack();
+
+        /**
+         * @brief Gets the iterator to the front of the data structure.
+         * @return Returns a iterator to the node
+         */
+        Iterator begin();
+
+        /**
+         * @brief Gets the iterator to the front of the data structure.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator cbegin() const;
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the node
+         */
+        Iterator end();
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator cend() const;
+
+        /**
+         * @brief Gets the iterator to the back, walk it with -- until it equals rend()
+         * @return Returns a iterator to the last node
+         */
+        Iterator rbegin();
+
+        /**
+         * @brief Gets the iterator to the back, walk it with -- until it equals crend()
+         * @return Returns a iterator to the last node
+         */
+        ConstIterator crbegin() const;
+
+        /**
+         * @brief Gets the iterator to the value before the front of the data structure.
+         * @return Returns a iterator to the node
+         */
+        Iterator rend();
+
+        /**
+         * @brief Gets the iterator to the value before the front of the data structure.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator crend() const;
+
+    protected:
+        /**
+         * @param p_list The list to copy into "this"
+         *
+         * @brief Copies the right hand into this data structure.
+         */
+        void m_copy(const DoublyLinkedList<T>& p_list);
+
+        /**
+         * @param p_data The data we're copying
+         *
+         * @brief Creates the node
+         * @return Returns the new node
+         */
+        Node* m_create(const T& p_data);
+
+        /**
+         * @param p_node The node we're destroying
+         *
+         * @brief Destroys the node and gives it back to its pool
+         */
+        void m_destroy(Node* p_node);
+
+        /**
+         * @brief Destroys every node
+         */
+        void m_clear();
+
+        /**
+         * @param p_node The node we're adding
+         * @param p_next The node it goes in front of, nullptr for the back
+         *
+         * @brief Links the node in
+         */
+        void m_link(Node* p_node, Node* p_next);
+
+        /**
+         * @param p_node The node we're taking out
+         *
+         * @brief Unlinks the node, doesn't destroy it
+         */
+        void m_unlink(Node* p_node);
+
+        /**
+         * @param p_index The index we are retrieving
+         *
+         * @brief Gets the pointer of the node at the location.
+         * @return Returns a pointer to the node
+         */
+        Node* m_at(size_t p_index) const;
+
+        /// The front of the list
+        Node* m_data;
+
+        /// The back of the list
+        Node* m_last;
+
+        /// The amount of nodes
+        size_t m_size;
+
+        /// Where new nodes come from, made when the first node is
+        NodePool<Node>* m_pool;
+    };
+}
+
+template<typename T>
+cslib::DoublyLinkedList<T>::DoublyLinkedList() : m_data(nullptr), m_last(nullptr), m_size(0), m_pool(nullptr) {
+
+}
+
+template<typename T>
+cslib::DoublyLinkedList<T>::DoublyLinkedList(const DoublyLinkedList<T>& p_list) : m_data(nullptr), m_last(nullptr), m_size(0), m_pool(nullptr) {
+    this->m_copy(p_list);
+}
+
+template<typename T>
+cslib::DoublyLinkedList<T>& cslib::DoublyLinkedList<T>::operator= (const DoublyLinkedList<T>& p_list) {
+    if (this != &p_list) {
+        this->m_clear();
+        this->m_copy(p_list);
+    }
+    return *this;
+}
+
+template<typename T>
+cslib::DoublyLinkedList<T>::~DoublyLinkedList() {
+    // Delete all and let go of the pool
+    this->m_clear();
+    if (this->m_pool != nullptr) {
+        this->m_pool->release();
+    }
+}
+
+template<typename T>
+size_t cslib::DoublyLinkedList<T>::size() const {
+    return this->m_size;
+}
+
+template<typename T>
+bool cslib::DoublyLinkedList<T>::empty() const {
+    return (this->m_data == nullptr);
+}
+
+template<typename T>
+T& cslib::DoublyLinkedList<T>::operator[](size_t p_index) {
+    return this->m_at(p_index)->data;
+}
+
+template<typename T>
+const T& cslib::DoublyLinkedList<T>::operator[](size_t p_index) const {
+    return this->m_at(p_index)->data;
+}
+
+template<typename T>
+T& cslib::DoublyLinkedList<T>::front() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_data->data;
+}
+
+template<typename T>
+T& cslib::DoublyLinkedList<T>::back() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_last->data;
+}
+
+template<typename T>
+T& cslib::DoublyLinkedList<T>::append(const T& p_data) {
+    Node* node = this->m_create(p_data);
+    this->m_link(node, nullptr);
+    return node->data;
+}
+
+template<typename T>
+T& cslib::DoublyLinkedList<T>::prepend(const T& p_data) {
+    Node* node = this->m_create(p_data);
+    this->m_link(node, this->m_data);
+    return node->data;
+}
+
+template<typename T>
+T& cslib::DoublyLinkedList<T>::insert(const T& p_data, size_t p_index) {
+    // Bound check
+    if (p_index > this->m_size) {
+        throw OutOfRange();
+    }
+
+    // Find the node we go in front of
+    Node* next = (p_index == this->m_size) ? nullptr : this->m_at(p_index);
+    Node* node = this->m_create(p_data);
+    this->m_link(node, next);
+    return node->data;
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::Iterator cslib::DoublyLinkedList<T>::insert(Iterator p_it, const T& p_data) {
+    // Linking next to another list's node would tangle both lists
+    if (p_it.m_list != this) {
+        throw OutOfRange();
+    }
+
+    Node* node = this->m_create(p_data);
+    this->m_link(node, p_it.m_ptr);
+    return Iterator(node, this);
+}
+
+template<typename T>
+T cslib::DoublyLinkedList<T>::remove(size_t p_index) {
+    Node* node = this->m_at(p_index);
+    this->m_unlink(node);
+
+    T temp = node->data;
+    this->m_destroy(node);
+    return temp;
+}
+
+template<typename T>
+T cslib::DoublyLinkedList<T>::remove(Iterator p_it) {
+    Node* node = p_it.m_ptr;
+    if (node == nullptr || p_it.m_list != this) {
+        throw OutOfRange();
+    }
+    this->m_unlink(node);
+
+    T temp = node->data;
+    this->m_destroy(node);
+    return temp;
+}
+
+template<typename T>
+T cslib::DoublyLinkedList<T>::popFront() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->remove(Iterator(this->m_data, this));
+}
+
+template<typename T>
+T cslib::DoublyLinkedList<T>::popBack() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->remove(Iterator(this->m_last, this));
+}
+
+template<typename T>
+void cslib::DoublyLinkedList<T>::m_copy(const DoublyLinkedList<T>& p_list) {
+    for (const Node* node = p_list.m_data; node != nullptr; node = node->next) {
+        this->append(node->data);
+    }
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::Node* cslib::DoublyLinkedList<T>::m_create(const T& p_data) {
+    // Get the pool the first time we need it
+    if (this->m_pool == nullptr) {
+        this->m_pool = NodePool<Node>::create();
+    }
+
+    // Creates a new node in memory from the pool
+    Node* memory = nullptr;
+    try {
+        memory = this->m_pool->allocate();
+        Node* node = new (memory) Node{ p_data, nullptr, nullptr };
+        return node;
+    } catch (std::exception&) {
+        if (memory != nullptr) {
+            NodePool<Node>::deallocate(memory);
+        }
+        throw LinkedListNodeCantCreate();
+    }
+}
+
+template<typename T>
+void cslib::DoublyLinkedList<T>::m_destroy(Node* p_node) {
+    p_node->~Node();
+    NodePool<Node>::deallocate(p_node);
+}
+
+template<typename T>
+void cslib::DoublyLinkedList<T>::m_clear() {
+    Node* node = this->m_data;
+    while (node != nullptr) {
+        Node* next = node->next;
+        this->m_destroy(node);
+        node = next;
+    }
+
+    this->m_data = nullptr;
+    this->m_last = nullptr;
+    this->m_size = 0;
+}
+
+template<typename T>
+void cslib::DoublyLinkedList<T>::m_link(Node* p_node, Node* p_next) {
+    // The node before is whatever was before next, or the last
+    Node* prev = (p_next == nullptr) ? this->m_last : p_next->prev;
+
+    p_node->prev = prev;
+    p_node->next = p_next;
+
+    if (prev == nullptr) {
+        this->m_data = p_node;
+    } else {
+        prev->next = p_node;
+    }
+
+    if (p_next == nullptr) {
+        this->m_last = p_node;
+    } else {
+        p_next->prev = p_node;
+    }
+
+    this->m_size++;
+}
+
+template<typename T>
+void cslib::DoublyLinkedList<T>::m_unlink(Node* p_node) {
+    // Join the neighbours together
+    if (p_node->prev == nullptr) {
+        this->m_data = p_node->next;
+    } else {
+        p_node->prev->next = p_node->next;
+    }
+
+    if (p_node->next == nullptr) {
+        this->m_last = p_node->prev;
+    } else {
+        p_node->next->prev = p_node->prev;
+    }
+
+    this->m_size--;
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::Node* cslib::DoublyLinkedList<T>::m_at(size_t p_index) const {
+    // Check if valid relation
+    if (p_index >= this->m_size) {
+        throw OutOfRange();
+    }
+
+    // Walk from the front
+    if (p_index < this->m_size / 2) {
+        Node* node = this->m_data;
+        for (size_t i = 0; i < p_index; i++) {
+            node = node->next;
+        }
+        return node;
+    }
+
+    // Walk from the back
+    Node* node = this->m_last;
+    for (size_t i = this->m_size - 1; i > p_index; i--) {
+        node = node->prev;
+    }
+    return node;
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::Iterator cslib::DoublyLinkedList<T>::begin() {
+    return Iterator(this->m_data, this);
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::ConstIterator cslib::DoublyLinkedList<T>::cbegin() const {
+    return ConstIterator(this->m_data, this);
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::Iterator cslib::DoublyLinkedList<T>::end() {
+    return Iterator(nullptr, this);
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::ConstIterator cslib::DoublyLinkedList<T>::cend() const {
+    return ConstIterator(nullptr, this);
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::Iterator cslib::DoublyLinkedList<T>::rbegin() {
+    return Iterator(this->m_last, this);
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::ConstIterator cslib::DoublyLinkedList<T>::crbegin() const {
+    return ConstIterator(this->m_last, this);
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::Iterator cslib::DoublyLinkedList<T>::rend() {
+    return Iterator(nullptr, this);
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::ConstIterator cslib::DoublyLinkedList<T>::crend() const {
+    return ConstIterator(nullptr, this);
+}
+
+
+
+
+
+
+
+
+
+
+
+template<typename T>
+cslib::DoublyLinkedList<T>::Iterator::Iterator(Node* p_ptr, const DoublyLinkedList<T>* p_list) : m_list(p_list) {
+    this->m_ptr = p_ptr;
+}
+
+template<typename T>
+T& cslib::DoublyLinkedList<T>::Iterator::operator*() {
+    return (this->m_ptr->data);
+}
+
+template<typename T>
+T* cslib::DoublyLinkedList<T>::Iterator::operator->() {
+    return &(this->m_ptr->data);
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::Iterator& cslib::DoublyLinkedList<T>::Iterator::operator++() {
+    this->m_ptr = (this->m_ptr == nullptr) ? this->m_list->m_data : this->m_ptr->next;
+    return *this;
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::Iterator cslib::DoublyLinkedList<T>::Iterator::operator++(int) {
+    Iterator cpy = *this;
+    this->m_ptr = (this->m_ptr == nullptr) ? this->m_list->m_data : this->m_ptr->next;
+    return cpy;
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::Iterator& cslib::DoublyLinkedList<T>::Iterator::operator--() {
+    this->m_ptr = (this->m_ptr == nullptr) ? this->m_list->m_last : this->m_ptr->prev;
+    return *this;
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::Iterator cslib::DoublyLinkedList<T>::Iterator::operator--(int) {
+    Iterator cpy = *this;
+    this->m_ptr = (this->m_ptr == nullptr) ? this->m_list->m_last : this->m_ptr->prev;
+    return cpy;
+}
+
+template<typename T>
+cslib::DoublyLinkedList<T>::ConstIterator::ConstIterator(const Node* p_ptr, const DoublyLinkedList<T>* p_list) : m_list(p_list) {
+    this->m_ptr = p_ptr;
+}
+
+template<typename T>
+const T& cslib::DoublyLinkedList<T>::ConstIterator::operator*() {
+    return (this->m_ptr->data);
+}
+
+template<typename T>
+const T* cslib::DoublyLinkedList<T>::ConstIterator::operator->() {
+    return &(this->m_ptr->data);
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::ConstIterator& cslib::DoublyLinkedList<T>::ConstIterator::operator++() {
+    this->m_ptr = (this->m_ptr == nullptr) ? this->m_list->m_data : this->m_ptr->next;
+    return *this;
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::ConstIterator cslib::DoublyLinkedList<T>::ConstIterator::operator++(int) {
+    ConstIterator cpy = *this;
+    this->m_ptr = (this->m_ptr == nullptr) ? this->m_list->m_data : this->m_ptr->next;
+    return cpy;
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::ConstIterator& cslib::DoublyLinkedList<T>::ConstIterator::operator--() {
+    this->m_ptr = (this->m_ptr == nullptr) ? this->m_list->m_last : this->m_ptr->prev;
+    return *this;
+}
+
+template<typename T>
+typename cslib::DoublyLinkedList<T>::ConstIterator cslib::DoublyLinkedList<T>::ConstIterator::operator--(int) {
+    ConstIterator cpy = *this;
+    this->m_ptr = (this->m_ptr == nullptr) ? this->m_list->m_last : this->m_ptr->prev;
+    return cpy;
+}
+
+
+#endif
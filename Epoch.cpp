@@ -0,0 +1,160 @@
+#include "Epoch.h"
+
+#include <new>
+
+std::atomic<uint64_t> cslib::Epoch::ms_epoch{ 0 };
+std::atomic<cslib::Epoch::Record*> cslib::Epoch::ms_records{ nullptr };
+
+namespace cslib {
+    /**
+     * @class EpochHolder
+     * @brief Owns the record of a thread and gives it up when the thread finishes
+     **/
+    class EpochHolder {
+    public:
+        /// The record of the thread
+        Epoch::Record* record = nullptr;
+
+        ~EpochHolder() {
+            if (this->record == nullptr) {
+                return;
+            }
+
+            // Free what we can, the next owner inherits the rest
+            Epoch::ms_free(this->record);
+            this->record->nesting = 0;
+            this->record->state.store(0, std::memory_order_release);
+            this->record->owned.store(false, std::memory_order_release);
+        }
+    };
+}
+
+void cslib::Epoch::pin() {
+    Record* record = ms_local();
+    if (record->nesting++ > 0) {
+        return;
+    }
+
+    // Publish the epoch we saw, the others can't move past it until we unpin
+    uint64_t epoch = ms_epoch.load(std::memory_order_seq_cst);
+    record->state.store((epoch << 1) | 1, std::memory_order_seq_cst);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+void cslib::Epoch::unpin() {
+    Record* record = ms_local();
+    if (--record->nesting > 0) {
+        return;
+    }
+    record->state.store(0, std::memory_order_release);
+}
+
+void cslib::Epoch::retire(void* p_ptr, Deleter p_deleter) {
+    Record* record = ms_local();
+
+    // Grow the list if needed, dropping what was freed
+    if (record->count == record->capacity) {
+        size_t waiting = record->count - record->first;
+        size_t capacity = (record->capacity == 0) ? EPOCH_COLLECT_THRESHOLD : record->capacity;
+        if (waiting * 2 > capacity) {
+            capacity *= 2;
+        }
+
+        Retired* retired = new Retired[capacity];
+        for (size_t i = 0; i < waiting; i++) {
+            retired[i] = record->retired[record->first + i];
+        }
+        delete[] record->retired;
+        record->retired = retired;
+        record->capacity = capacity;
+        record->first = 0;
+        record->count = waiting;
+    }
+
+    record->retired[record->count] = Retired{ p_ptr, p_deleter, ms_epoch.load(std::memory_order_seq_cst) };
+    record->count++;
+
+    if (record->count % EPOCH_COLLECT_THRESHOLD == 0) {
+        ms_free(record);
+    }
+}
+
+void cslib::Epoch::collect() {
+    ms_free(ms_local());
+}
+
+size_t cslib::Epoch::pending() {
+    Record* record = ms_local();
+    return record->count - record->first;
+}
+
+cslib::Epoch::Record* cslib::Epoch::ms_local() {
+    thread_local EpochHolder holder;
+    if (holder.record != nullptr) {
+        return holder.record;
+    }
+
+    // Take a record somebody gave up
+    for (Record* record = ms_records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        bool owned = false;
+        if (!record->owned.load(std::memory_order_relaxed) && record->owned.compare_exchange_strong(owned, true, std::memory_order_acquire)) {
+            holder.record = record;
+            return record;
+        }
+    }
+
+    // Otherwise add a new one to the front
+    Record* record = new Record();
+    record->owned.store(true, std::memory_order_relaxed);
+    Record* head = ms_records.load(std::memory_order_relaxed);
+    do {
+        record->next = head;
+    } while (!ms_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+
+    holder.record = record;
+    return record;
+}
+
+uint64_t cslib::Epoch::ms_advance() {
+    uint64_t epoch = ms_epoch.load(std::memory_order_seq_cst);
+
+    // Everybody pinned has to be in this epoch
+    for (Record* record = ms_records.load(std::memory_order_acquire); record != nullptr; record = record->next) {
+        uint64_t state = record->state.load(std::memory_order_seq_cst);
+        if ((state & 1) != 0 && (state >> 1) != epoch) {
+            return epoch;
+        }
+    }
+
+    // Somebody else might have moved it on already, either way it moved
+    ms_epoch.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst);
+    return ms_epoch.load(std::memory_order_seq_cst);
+}
+
+void cslib::Epoch::ms_free(Record* p_record) {
+    uint64_t epoch = ms_advance();
+
+    // Two epochs on, nobody pinned can still see it. They were retired in order, so
+    // stop at the first that is too new rather than looking at the whole list.
+    while (p_record->first < p_record->count) {
+        Retired& retired = p_record->retired[p_record->first];
+        if (retired.epoch + 2 > epoch) {
+            break;
+        }
+        retired.deleter(retired.ptr);
+        p_record->first++;
+    }
+
+    if (p_record->first == p_record->count) {
+        p_record->first = 0;
+        p_record->count = 0;
+    }
+}
+
+cslib::EpochGuard::EpochGuard() {
+    Epoch::pin();
+}
+
+cslib::EpochGuard::~EpochGuard() {
+    Epoch::unpin();
+}
@@ -0,0 +1,147 @@
+/**
+ * @file Epoch.h
+ * @brief Holds epoch based reclamation, frees memory once no thread can still be reading it.
+ **/
+#ifndef CSEPOCH_H
+#define CSEPOCH_H
+
+#include "Universal.h"
+
+#include <atomic>
+
+/// How many retired pointers a thread holds before it tries to free some.
+#define EPOCH_COLLECT_THRESHOLD 64
+
+namespace cslib {
+    /**
+     * @class Epoch
+     * @brief Lets lock free structures free nodes that other threads might still be reading.
+     *
+     * A thread pins itself before touching shared nodes and unpins once it holds no pointers
+     * into them. A node is retired once it can't be reached anymore and is freed after the
+     * global epoch has moved on twice, when every thread that could have seen it has unpinned.
+     * Pins nest, and a thread's leftovers are handed to the next thread that takes its record.
+     **/
+    class Epoch {
+    public:
+        /// Frees a retired pointer
+        typedef void(*Deleter)(void*);
+
+        /**
+         * @brief Pins the calling thread to the current epoch
+         */
+        static void pin();
+
+        /**
+         * @brief Unpins the calling thread, its pointers into shared nodes are no longer safe
+         */
+        static void unpin();
+
+        /**
+         * @param p_ptr The memory, already unreachable from the structure
+         * @param p_deleter How to free it
+         *
+         * @brief Frees the memory once no pinned thread can still be reading it
+         */
+        static void retire(void* p_ptr, Deleter p_deleter);
+
+        /**
+         * @brief Tries to move the epoch on and frees what this thread can
+         */
+        static void collect();
+
+        /**
+         * @brief Gets how many retired pointers this thread is still holding
+         * @return Returns the amount
+         */
+        static size_t pending();
+
+    private:
+        /**
+         * @struct Retired
+         * @brief A pointer waiting to be freed
+         **/
+        struct Retired {
+            /// The memory
+            void* ptr;
+            /// How to free it
+            Deleter deleter;
+            /// The epoch it was retired in
+            uint64_t epoch;
+        };
+
+        /**
+         * @struct Record
+         * @brief What a thread shows the others, records are reused and never freed
+         **/
+        struct Record {
+            /// The epoch the thread is pinned to shifted by one, the low bit is set while pinned
+            std::atomic<uint64_t> state{ 0 };
+            /// If a thread owns this record
+            std::atomic<bool> owned{ false };
+            /// The next record
+            Record* next = nullptr;
+            /// How deep the pins are
+            size_t nesting = 0;
+            /// Pointers waiting to be freed, oldest first
+            Retired* retired = nullptr;
+            /// The first one not freed yet
+            size_t first = 0;
+            /// One past the last one waiting
+            size_t count = 0;
+            /// Room for waiting pointers
+            size_t capacity = 0;
+        };
+
+        /**
+         * @brief Gets the record of the calling thread, taking one the first time
+         * @return Returns the record
+         */
+        static Record* ms_local();
+
+        /**
+         * @brief Moves the global epoch on if every pinned thread has seen it
+         * @return Returns the global epoch afterwards
+         */
+        static uint64_t ms_advance();
+
+        /**
+         * @param p_record The record whose pointers we're freeing
+         *
+         * @brief Frees the retired pointers that nobody can reach
+         */
+        static void ms_free(Record* p_record);
+
+        friend class EpochHolder;
+
+        /// The global epoch
+        static std::atomic<uint64_t> ms_epoch;
+
+        /// Every record ever made
+        static std::atomic<Record*> ms_records;
+    };
+
+    /**
+     * @class EpochGuard
+     * @brief Pins the thread for as long as it lives
+     **/
+    class EpochGuard {
+    public:
+        /**
+         * @brief Pins the calling thread
+         */
+        EpochGuard();
+
+        /**
+         * @brief Unpins the calling thread
+         */
+        ~EpochGuard();
+
+        /// Guards belong to one scope
+        EpochGuard(const EpochGuard&) = delete;
+        EpochGuard& operator= (const EpochGuard&) = delete;
+    };
+}
+
+
+#endif
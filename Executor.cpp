@@ -0,0 +1,121 @@
+#include "Executor.h"
+
+cslib::Task cslib::Task::promise_type::get_return_object() {
+    return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+}
+
+cslib::Task::Task(std::coroutine_handle<promise_type> p_handle) : m_handle(p_handle) {
+
+}
+
+cslib::Task::Task(Task&& p_task) noexcept : m_handle(p_task.m_handle) {
+    p_task.m_handle = nullptr;
+}
+
+cslib::Task::~Task() {
+    if (this->m_handle) {
+        this->m_handle.destroy();
+    }
+}
+
+cslib::Executor::~Executor() {
+
+}
+
+void cslib::Executor::spawn(Task p_task) {
+    std::coroutine_handle<Task::promise_type> handle = p_task.m_handle;
+    p_task.m_handle = nullptr;
+
+    handle.promise().executor = this;
+    this->schedule(handle);
+}
+
+void cslib::LoopExecutor::schedule(std::coroutine_handle<> p_handle) {
+    std::lock_guard<std::mutex> lock(this->m_mutex);
+    this->m_ready.enqueue(p_handle);
+}
+
+size_t cslib::LoopExecutor::run() {
+    size_t resumed = 0;
+    while (true) {
+        std::coroutine_handle<> handle;
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            if (this->m_ready.empty()) {
+                return resumed;
+            }
+            handle = this->m_ready.dequeue();
+        }
+
+        handle.resume();
+        resumed++;
+    }
+}
+
+cslib::ThreadPoolExecutor::ThreadPoolExecutor(size_t p_threads) : m_running(0), m_stopping(false) {
+    if (p_threads == 0) {
+        p_threads = std::thread::hardware_concurrency();
+    }
+    this->m_threadCount = (p_threads == 0) ? 1 : p_threads;
+
+    this->m_threads = new std::thread[this->m_threadCount];
+    for (size_t i = 0; i < this->m_threadCount; i++) {
+        this->m_threads[i] = std::thread(&ThreadPoolExecutor::m_work, this);
+    }
+}
+
+cslib::ThreadPoolExecutor::~ThreadPoolExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_stopping = true;
+    }
+    this->m_notEmpty.notify_all();
+
+    for (size_t i = 0; i < this->m_threadCount; i++) {
+        this->m_threads[i].join();
+    }
+    delete[] this->m_threads;
+}
+
+void cslib::ThreadPoolExecutor::schedule(std::coroutine_handle<> p_handle) {
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_ready.enqueue(p_handle);
+    }
+    this->m_notEmpty.notify_one();
+}
+
+size_t cslib::ThreadPoolExecutor::threads() const {
+    return this->m_threadCount;
+}
+
+void cslib::ThreadPoolExecutor::wait() {
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    while (!this->m_ready.empty() || this->m_running > 0) {
+        this->m_idle.wait(lock);
+    }
+}
+
+void cslib::ThreadPoolExecutor::m_work() {
+    std::unique_lock<std::mutex> lock(this->m_mutex);
+    while (true) {
+        while (!this->m_stopping && this->m_ready.empty()) {
+            this->m_notEmpty.wait(lock);
+        }
+        if (this->m_ready.empty()) {
+            return;
+        }
+
+        std::coroutine_handle<> handle = this->m_ready.dequeue();
+        this->m_running++;
+        lock.unlock();
+
+        handle.resume();
+
+        lock.lock();
+        this->m_running--;
+        if (this->m_running == 0 && this->m_ready.empty()) {
+            this->m_idle.notify_all();
+        }
+    }
+}
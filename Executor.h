@@ -0,0 +1,222 @@
+/**
+ * @file Executor.h
+ * @brief Holds the executors that run coroutines, one that runs them on the calling thread and one with a pool of threads.
+ **/
+#ifndef CSEXECUTOR_H
+#define CSEXECUTOR_H
+
+#include "Universal.h"
+#include "Queue.h"
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace cslib {
+    class Executor;
+
+    /**
+     * @class Task
+     * @brief What a coroutine run on an Executor returns, it starts once spawned and frees itself when it finishes.
+     *
+     * A coroutine that returns Task doesn't run until it's handed to Executor::spawn. It knows the
+     * executor it was spawned on, so whatever it waits on, like a Channel, resumes it there.
+     **/
+    class Task {
+    public:
+        /**
+         * @struct promise_type
+         * @brief What the compiler keeps in the coroutine frame
+         **/
+        struct promise_type {
+            /// The executor it runs on, set when spawned
+            Executor* executor = nullptr;
+
+            /**
+             * @brief Gets the Task the caller sees
+             * @return Returns the Task
+             */
+            Task get_return_object();
+
+            /**
+             * @brief Waits to be spawned
+             * @return Returns that it always suspends
+             */
+            std::suspend_always initial_suspend() noexcept { return {}; }
+
+            /**
+             * @brief Lets the frame free itself when the coroutine is done
+             * @return Returns that it never suspends
+             */
+            std::suspend_never final_suspend() noexcept { return {}; }
+
+            /**
+             * @brief Nothing is returned
+             */
+            void return_void() {}
+
+            /**
+             * @brief Nobody is left to catch it, so it ends the program
+             */
+            void unhandled_exception() { std::terminate(); }
+        };
+
+        /**
+         * @param p_handle The coroutine
+         *
+         * @brief Constructs the task
+         */
+        explicit Task(std::coroutine_handle<promise_type> p_handle);
+
+        /**
+         * @param p_task The task we're taking over
+         *
+         * @brief Takes over the coroutine, the other task is left with none
+         */
+        Task(Task&& p_task) noexcept;
+
+        /**
+         * @brief Frees the coroutine if it was never spawned
+         */
+        ~Task();
+
+        /// A coroutine runs once
+        Task(const Task&) = delete;
+        Task& operator= (const Task&) = delete;
+
+    protected:
+        /// The coroutine, nullptr once spawned
+        std::coroutine_handle<promise_type> m_handle;
+
+        friend class Executor;
+    };
+
+    /**
+     * @class Executor
+     * @brief Runs coroutines that are ready to go on.
+     **/
+    class Executor {
+    public:
+        virtual ~Executor();
+
+        /**
+         * @param p_handle The coroutine
+         *
+         * @brief Queues a suspended coroutine to be resumed, safe from any thread
+         */
+        virtual void schedule(std::coroutine_handle<> p_handle) = 0;
+
+        /**
+         * @param p_task The coroutine, not started yet
+         *
+         * @brief Starts a coroutine here, it also resumes here after waiting
+         */
+        void spawn(Task p_task);
+    };
+
+    /**
+     * @class LoopExecutor
+     * @brief Runs coroutines on the thread that calls run, nothing runs in between.
+     **/
+    class LoopExecutor : public Executor {
+    public:
+        /**
+         * @param p_handle The coroutine
+         *
+         * @brief Queues a suspended coroutine to be resumed by run
+         */
+        void schedule(std::coroutine_handle<> p_handle) override;
+
+        /**
+         * @brief Resumes coroutines until none are ready, the rest are waiting on something
+         * @return Returns how many times a coroutine was resumed
+         */
+        size_t run();
+
+    protected:
+        /// Coroutines ready to be resumed
+        Queue<std::coroutine_handle<>, RingBuffer<std::coroutine_handle<>>> m_ready;
+
+        /// Guards the queue, other threads may schedule
+        std::mutex m_mutex;
+    };
+
+    /**
+     * @class ThreadPoolExecutor
+     * @brief Runs coroutines on a fixed set of threads that share one queue.
+     *
+     * Many coroutines share a few threads, a coroutine waiting on a Channel holds no thread.
+     * The threads finish what's ready and stop when the executor is destroyed.
+     **/
+    class ThreadPoolExecutor : public Executor {
+    public:
+        /**
+         * @param p_threads How many threads, 0 for one per hardware thread
+         *
+         * @brief Constructs the executor and starts its threads
+         */
+        explicit ThreadPoolExecutor(size_t p_threads = 0);
+
+        /**
+         * @brief Runs what's ready and joins the threads, coroutines still waiting are never resumed
+         */
+        ~ThreadPoolExecutor();
+
+        /// The threads are running on it
+        ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+        ThreadPoolExecutor& operator= (const ThreadPoolExecutor&) = delete;
+
+        /**
+         * @param p_handle The coroutine
+         *
+         * @brief Queues a suspended coroutine for the next free thread
+         */
+        void schedule(std::coroutine_handle<> p_handle) override;
+
+        /**
+         * @brief Gets how many threads run coroutines
+         * @return Returns the amount of threads
+         */
+        size_t threads() const;
+
+        /**
+         * @brief Waits until no coroutine is ready or running, the rest are done or waiting on something
+         */
+        void wait();
+
+    protected:
+        /**
+         * @brief What each thread runs until the executor stops
+         */
+        void m_work();
+
+        /// Coroutines ready to be resumed
+        Queue<std::coroutine_handle<>, RingBuffer<std::coroutine_handle<>>> m_ready;
+
+        /// The threads
+        std::thread* m_threads;
+
+        /// How many threads
+        size_t m_threadCount;
+
+        /// How many coroutines are being resumed right now
+        size_t m_running;
+
+        /// If the threads should stop once nothing is ready
+        bool m_stopping;
+
+        /// Guards everything above
+        std::mutex m_mutex;
+
+        /// Threads wait here for coroutines
+        std::condition_variable m_notEmpty;
+
+        /// wait() waits here for everything to settle
+        std::condition_variable m_idle;
+    };
+}
+
+
+#endif
@@ -344,7 +344,7 @@ void cslib::Graph<T>::remove(size_t p_index) {
         if (current != nullptr) {
             // Remove all mentions of this node, in this node's connections
             LinkedList<size_t>& cons = current->connections;
-            Queue<size_t> indexes;
+            Queue<size_t, RingBuffer<size_t>> indexes;
 
             // Add all indexes into the queue
             size_t i = 0;
@@ -464,7 +464,7 @@ void cslib::Graph<T>::depthFirst(size_t p_start, TF&& p_func) const {
     BSTree<size_t> visited;
     visited.insert(p_start);
 
-    Stack<size_t> stack;
+    Stack<size_t, ArrayStack<size_t>> stack;
     stack.push(p_start);
 
     while (!stack.empty()) {
@@ -501,7 +501,7 @@ void cslib::Graph<T>::breadthFirst(size_t p_start, TF&& p_func) const {
     BSTree<size_t> visited;
     visited.insert(p_start);
 
-    Queue<size_t> queue;
+    Queue<size_t, RingBuffer<size_t>> queue;
     queue.enqueue(p_start);
 
     while (!queue.empty()) {
@@ -0,0 +1,5 @@
+#include "IntrusiveList.h"
+
+const char* cslib::IntrusiveListHookInUse::what() const throw() {
+    return "Intrusive List hook is in use!";
+}
\ No newline at end of file
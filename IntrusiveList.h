@@ -0,0 +1,501 @@
+/**
+ * @file IntrusiveList.h
+ * @brief Holds the IntrusiveList, a list whose links live inside the objects it holds.
+ **/
+#ifndef CSINTRUSIVELIST_H
+#define CSINTRUSIVELIST_H
+
+#include "Universal.h"
+
+namespace cslib {
+    /**
+     * @class IntrusiveListHookInUse
+     * @brief Gets thrown when an object is linked twice or removed from a list it isn't in.
+     **/
+    class IntrusiveListHookInUse : public Exception {
+    public:
+        const char* what() const throw();
+    };
+
+    /**
+     * @struct IntrusiveListHook
+     * @tparam Tag Lets one object sit in several lists, one hook per tag.
+     * @brief Derive from this to be put in an IntrusiveList, the list never allocates.
+     **/
+    template<typename Tag = void>
+    struct IntrusiveListHook {
+        /// The next hook
+        IntrusiveListHook* next = nullptr;
+
+        /// The hook before
+        IntrusiveListHook* prev = nullptr;
+
+        /// The list we're in, nullptr if in none
+        const void* list = nullptr;
+
+        /**
+         * @brief Tests if the object is in a list
+         * @return Returns true if linked
+         */
+        bool linked() const { return (this->list != nullptr); }
+    };
+
+    /**
+     * @class IntrusiveList
+     * @tparam T Type held, must derive from IntrusiveListHook<Tag>.
+     * @tparam Tag Which of the object's hooks this list uses.
+     * @brief A doubly linked list that links the caller's objects in place.
+     *
+     * The list doesn't own what it holds, objects must outlive their membership
+     * and are only unlinked when the list is destroyed.
+     **/
+    template<typename T, typename Tag = void>
+    class IntrusiveList {
+    protected:
+        /// The hook this list links through
+        typedef IntrusiveListHook<Tag> Hook;
+
+    public:
+        /**
+         * @class Iterator
+         * @brief The iterator for an intrusive list, can go forward and back.
+         *
+         * end() is the same place on both sides, -- from it gets the back and ++ gets the front.
+         **/
+        class Iterator : public cslib::Iterator<Hook> {
+        public:
+            /**
+             * @param p_ptr The pointer of the Iterator
+             * @param p_list The list it walks, needed to step off end()
+             *
+             * @brief Constructs the Iterator
+             */
+            Iterator(Hook* p_ptr = nullptr, const IntrusiveList<T, Tag>* p_list = nullptr);
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            Iterator& operator++();
+
+            /**
+             * @brief Gets the iterator before
+             * @return Returns the value that was before
+             */
+            Iterator& operator--();
+
+            /**
+             * @brief Gets the object at the location
+             * @return Gets the object that this iterator represents
+             */
+            T& operator* ();
+
+            /**
+             * @brief Gets the object at the location
+             * @return Gets the object that this iterator represents
+             */
+            T* operator->();
+
+        protected:
+            /// The list it walks
+            const IntrusiveList<T, Tag>* m_list;
+        };
+
+        /**
+         * @brief Constructs an empty list
+         */
+        IntrusiveList();
+
+        /**
+         * @brief Unlinks everything, the objects aren't touched otherwise
+         */
+        ~IntrusiveList();
+
+        /// Objects can only be in one list per hook
+        IntrusiveList(const IntrusiveList<T, Tag>&) = delete;
+        IntrusiveList<T, Tag>& operator= (const IntrusiveList<T, Tag>&) = delete;
+
+        /**
+         * @brief Gets the size of the list
+         * @return Returns the amount of objects in the list
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if there is no data in the data structure.
+         * @return True if empty, false if at least one item.
+         */
+        bool empty() const;
+
+        /**
+         * @param p_object The object we're testing
+         *
+         * @brief Tests if the object is in this list, O(1)
+         * @return Returns true if it is
+         */
+        bool contains(const T& p_object) const;
+
+        /**
+         * @brief Gets the first object
+         * @return Returns the first object
+         */
+        T& front();
+
+        /**
+         * @brief Gets the last object
+         * @return Returns the last object
+         */
+        T& back();
+
+        /**
+         * @param p_object The object we're linking, can't be in a list already
+         *
+         * @brief Links the object in at the front
+         */
+        void pushFront(T& p_object);
+
+        /**
+         * @param p_object The object we're linking, can't be in a list already
+         *
+         * @brief Links the object in at the back
+         */
+        void pushBack(T& p_object);
+
+        /**
+         * @brief Unlinks the first object
+         * @return Returns the object just unlinked
+         */
+        T& popFront();
+
+        /**
+         * @brief Unlinks the last object
+         * @return Returns the object just unlinked
+         */
+        T& popBack();
+
+        /**
+         * @param p_object The object we're unlinking, must be in this list
+         *
+         * @brief Unlinks the object in O(1)
+         */
+        void remove(T& p_object);
+
+        /**
+         * @param p_object The object we're moving, must be in this list
+         *
+         * @brief Moves the object to the front, like marking it most recently used
+         */
+        void moveToFront(T& p_object);
+
+        /**
+         * @param p_object The object we're moving, must be in this list
+         *
+         * @brief Moves the object to the back
+         */
+        void moveToBack(T& p_object);
+
+        /**
+         * @brief Unlinks every object
+         */
+        void clear();
+
+        /**
+         * @brief Gets the iterator to the front of the data structure.
+         * @return Returns a iterator to the object
+         */
+        Iterator begin();
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the object
+         */
+        Iterator end();
+
+        /**
+         * @brief Gets the iterator to the back, walk it with -- until it equals end()
+         * @return Returns a iterator to the last object
+         */
+        Iterator rbegin();
+
+    protected:
+        /**
+         * @param p_object The object
+         *
+         * @brief Gets the hook of the object that this list uses
+         * @return Returns the hook
+         */
+        static Hook* ms_hook(T& p_object);
+
+        /**
+         * @param p_hook The hook
+         *
+         * @brief Gets the object the hook is part of
+         * @return Returns the object
+         */
+        static T& ms_object(Hook* p_hook);
+
+        /**
+         * @param p_hook The hook we're adding, not linked
+         * @param p_next The hook it goes in front of, nullptr for the back
+         *
+         * @brief Links the hook in
+         */
+        void m_link(Hook* p_hook, Hook* p_next);
+
+        /**
+         * @param p_hook The hook we're taking out, must be in this list
+         *
+         * @brief Unlinks the hook
+         */
+        void m_unlink(Hook* p_hook);
+
+        /// The front of the list
+        Hook* m_data;
+
+        /// The back of the list
+        Hook* m_last;
+
+        /// The amount of objects
+        size_t m_size;
+    };
+}
+
+template<typename T, typename Tag>
+cslib::IntrusiveList<T, Tag>::IntrusiveList() : m_data(nullptr), m_last(nullptr), m_size(0) {
+
+}
+
+template<typename T, typename Tag>
+cslib::IntrusiveList<T, Tag>::~IntrusiveList() {
+    this->clear();
+}
+
+template<typename T, typename Tag>
+size_t cslib::IntrusiveList<T, Tag>::size() const {
+    return this->m_size;
+}
+
+template<typename T, typename Tag>
+bool cslib::IntrusiveList<T, Tag>::empty() const {
+    return (this->m_data == nullptr);
+}
+
+template<typename T, typename Tag>
+bool cslib::IntrusiveList<T, Tag>::contains(const T& p_object) const {
+    return (static_cast<const Hook&>(p_object).list == this);
+}
+
+template<typename T, typename Tag>
+T& cslib::IntrusiveList<T, Tag>::front() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return ms_object(this->m_data);
+}
+
+template<typename T, typename Tag>
+T& cslib::IntrusiveList<T, Tag>::back() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return ms_object(this->m_last);
+}
+
+template<typename T, typename Tag>
+void cslib::IntrusiveList<T, Tag>::pushFront(T& p_object) {
+    Hook* hook = ms_hook(p_object);
+    if (hook->linked()) {
+        throw IntrusiveListHookInUse();
+    }
+    this->m_link(hook, this->m_data);
+}
+
+template<typename T, typename Tag>
+void cslib::IntrusiveList<T, Tag>::pushBack(T& p_object) {
+    Hook* hook = ms_hook(p_object);
+    if (hook->linked()) {
+        throw IntrusiveListHookInUse();
+    }
+    this->m_link(hook, nullptr);
+}
+
+template<typename T, typename Tag>
+T& cslib::IntrusiveList<T, Tag>::popFront() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    Hook* hook = this->m_data;
+    this->m_unlink(hook);
+    return ms_object(hook);
+}
+
+template<typename T, typename Tag>
+T& cslib::IntrusiveList<T, Tag>::popBack() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    Hook* hook = this->m_last;
+    this->m_unlink(hook);
+    return ms_object(hook);
+}
+
+template<typename T, typename Tag>
+void cslib::IntrusiveList<T, Tag>::remove(T& p_object) {
+    if (!this->contains(p_object)) {
+        throw IntrusiveListHookInUse();
+    }
+    this->m_unlink(ms_hook(p_object));
+}
+
+template<typename T, typename Tag>
+void cslib::IntrusiveList<T, Tag>::moveToFront(T& p_object) {
+    if (!this->contains(p_object)) {
+        throw IntrusiveListHookInUse();
+    }
+
+    Hook* hook = ms_hook(p_object);
+    if (hook != this->m_data) {
+        this->m_unlink(hook);
+        this->m_link(hook, this->m_data);
+    }
+}
+
+template<typename T, typename Tag>
+void cslib::IntrusiveList<T, Tag>::moveToBack(T& p_object) {
+    if (!this->contains(p_object)) {
+        throw IntrusiveListHookInUse();
+    }
+
+    Hook* hook = ms_hook(p_object);
+    if (hook != this->m_last) {
+        this->m_unlink(hook);
+        this->m_link(hook, nullptr);
+    }
+}
+
+template<typename T, typename Tag>
+void cslib::IntrusiveList<T, Tag>::clear() {
+    // Leave every hook as if it was never linked
+    Hook* hook = this->m_data;
+    while (hook != nullptr) {
+        Hook* next = hook->next;
+        hook->next = nullptr;
+        hook->prev = nullptr;
+        hook->list = nullptr;
+        hook = next;
+    }
+
+    this->m_data = nullptr;
+    this->m_last = nullptr;
+    this->m_size = 0;
+}
+
+template<typename T, typename Tag>
+typename cslib::IntrusiveList<T, Tag>::Iterator cslib::IntrusiveList<T, Tag>::begin() {
+    return Iterator(this->m_data, this);
+}
+
+template<typename T, typename Tag>
+typename cslib::IntrusiveList<T, Tag>::Iterator cslib::IntrusiveList<T, Tag>::end() {
+    return Iterator(nullptr, this);
+}
+
+template<typename T, typename Tag>
+typename cslib::IntrusiveList<T, Tag>::Iterator cslib::IntrusiveList<T, Tag>::rbegin() {
+    return Iterator(this->m_last, this);
+}
+
+template<typename T, typename Tag>
+typename cslib::IntrusiveList<T, Tag>::Hook* cslib::IntrusiveList<T, Tag>::ms_hook(T& p_object) {
+    return static_cast<Hook*>(&p_object);
+}
+
+template<typename T, typename Tag>
+T& cslib::IntrusiveList<T, Tag>::ms_object(Hook* p_hook) {
+    return *static_cast<T*>(p_hook);
+}
+
+template<typename T, typename Tag>
+void cslib::IntrusiveList<T, Tag>::m_link(Hook* p_hook, Hook* p_next) {
+    // The hook before is whatever was before next, or the last
+    Hook* prev = (p_next == nullptr) ? this->m_last : p_next->prev;
+
+    p_hook->prev = prev;
+    p_hook->next = p_next;
+    p_hook->list = this;
+
+    if (prev == nullptr) {
+        this->m_data = p_hook;
+    } else {
+        prev->next = p_hook;
+    }
+
+    if (p_next == nullptr) {
+        this->m_last = p_hook;
+    } else {
+        p_next->prev = p_hook;
+    }
+
+    this->m_size++;
+}
+
+template<typename T, typename Tag>
+void cslib::IntrusiveList<T, Tag>::m_unlink(Hook* p_hook) {
+    // Join the neighbours together
+    if (p_hook->prev == nullptr) {
+        this->m_data = p_hook->next;
+    } else {
+        p_hook->prev->next = p_hook->next;
+    }
+
+    if (p_hook->next == nullptr) {
+        this->m_last = p_hook->prev;
+    } else {
+        p_hook->next->prev = p_hook->prev;
+    }
+
+    p_hook->next = nullptr;
+    p_hook->prev = nullptr;
+    p_hook->list = nullptr;
+    this->m_size--;
+}
+
+
+
+
+
+
+
+
+
+
+
+template<typename T, typename Tag>
+cslib::IntrusiveList<T, Tag>::Iterator::Iterator(Hook* p_ptr, const IntrusiveList<T, Tag>* p_list) : m_list(p_list) {
+    this->m_ptr = p_ptr;
+}
+
+template<typename T, typename Tag>
+T& cslib::IntrusiveList<T, Tag>::Iterator::operator*() {
+    return ms_object(this->m_ptr);
+}
+
+template<typename T, typename Tag>
+T* cslib::IntrusiveList<T, Tag>::Iterator::operator->() {
+    return &ms_object(this->m_ptr);
+}
+
+template<typename T, typename Tag>
+typename cslib::IntrusiveList<T, Tag>::Iterator& cslib::IntrusiveList<T, Tag>::Iterator::operator++() {
+    this->m_ptr = (this->m_ptr == nullptr) ? this->m_list->m_data : this->m_ptr->next;
+    return *this;
+}
+
+template<typename T, typename Tag>
+typename cslib::IntrusiveList<T, Tag>::Iterator& cslib::IntrusiveList<T, Tag>::Iterator::operator--() {
+    this->m_ptr = (this->m_ptr == nullptr) ? this->m_list->m_last : this->m_ptr->prev;
+    return *this;
+}
+
+
+#endif
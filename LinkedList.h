@@ -6,6 +6,7 @@
 #define CSLINKEDLIST_H
 
 #include "Universal.h"
+#include "NodePool.h"
 
 namespace cslib {
     /**
@@ -30,15 +31,29 @@ namespace cslib {
      * @class LinkedList
      * @tparam T Type of the data structure.
      * @brief A list of values held in a line, insertions/removals can be made quickly.
+     *
+     * Indexing a non-const list moves a cursor, so walking it forward by index doesn't start
+     * from the front each time. Const access only reads the cursor, so const readers can share
+     * a list across threads.
+     *
+     * A list made with the pool shared by the thread has to be changed and destroyed on that
+     * thread, its nodes go back to a free list nothing else guards.
      **/
     template<typename T>
     class LinkedList {
     public:
         /**
-         * @brief Constructs the class
+         * @brief Constructs the class, nodes come from a pool owned by this list
          */
         LinkedList();
 
+        /**
+         * @param p_sharedPool If true nodes come from the pool shared by the thread, the list then stays on this thread
+         *
+         * @brief Constructs the class, picking where nodes come from
+         */
+        explicit LinkedList(bool p_sharedPool);
+
         /**
          * @brief Deep copies the LinkedList
          */
@@ -56,7 +71,7 @@ namespace cslib {
         ~LinkedList();
 
         /**
-         * @brief Gets the size of the Linked List
+         * @brief Gets the size of the Linked List, kept as nodes are added and removed
          * @return Returns the size of the linked list, functions like a vector.
          */
         size_t size() const;
@@ -110,6 +125,55 @@ namespace cslib {
          */
         T remove(size_t p_index);
 
+        /**
+         * @brief Reverses the order of the nodes in place, nothing is allocated
+         */
+        void reverse();
+
+        /**
+         * @param p_index The index in "this" the nodes go in front of
+         * @param p_other The list we're taking the nodes from, can't be "this"
+         * @param p_first The index of the first node we're taking
+         * @param p_count How many nodes we're taking
+         *
+         * @brief Moves a range of nodes from the other list, no values are copied
+         */
+        void splice(size_t p_index, LinkedList<T>& p_other, size_t p_first, size_t p_count);
+
+        /**
+         * @param p_index The index in "this" the nodes go in front of
+         * @param p_other The list we're taking every node from, can't be "this"
+         *
+         * @brief Moves all of the other list into this one, no values are copied
+         */
+        void splice(size_t p_index, LinkedList<T>& p_other);
+
+        /**
+         * @param p_index The index of the first node that moves
+         * @param p_tail The list the nodes are appended to, can't be "this"
+         *
+         * @brief Moves the nodes from the index onwards to the end of the other list
+         */
+        void split(size_t p_index, LinkedList<T>& p_tail);
+
+        /**
+         * @param p_other A sorted list, left empty afterwards
+         *
+         * @brief Merges the other sorted list into this sorted one, equal values keep this list's first
+         */
+        void merge(LinkedList<T>& p_other);
+
+        /**
+         * @brief Sorts with operator<, stable, relinks nodes instead of copying values
+         */
+        void sort();
+
+        /**
+         * @brief Gets the counters of the pool the nodes come from
+         * @return Returns the counters, all zero if no node was made yet
+         */
+        NodePoolStats poolStats() const;
+
     protected:
         /**
          * @structure Node
@@ -137,10 +201,35 @@ namespace cslib {
          */
         Node* m_create(const T& p_data);
 
+        /**
+         * @param p_node The node we're destroying
+         *
+         * @brief Destroys the node and gives it back to its pool
+         */
+        void m_destroy(Node* p_node);
+
+        /**
+         * @brief Destroys every node
+         */
+        void m_clear();
+
+        /**
+         * @param p_node The node we're adding
+         *
+         * @brief Links the node in front of the first node
+         */
+        void m_pushFront(Node* p_node);
+
+        /**
+         * @brief Unlinks the first node without destroying it
+         * @return Returns the node we unlinked
+         */
+        Node* m_popFront();
+
         /**
          * @param p_index The index we are retrieving
          *
-         * @brief Gets the pointer of the node at the location.
+         * @brief Gets the pointer of the node at the location, walking from the cursor when it is behind and moving it there.
          * @return Returns a pointer to the node
          */
         Node* m_at(size_t p_index);
@@ -148,16 +237,78 @@ namespace cslib {
         /**
          * @param p_index The index we are retrieving
          *
-         * @brief Gets the pointer of the node at the location.
+         * @brief Gets the pointer of the node at the location, reads the cursor but never moves it so const readers don't race.
          * @return Returns a pointer to the node
          */
         const Node* m_at(size_t p_index) const;
 
+        /**
+         * @param p_index The index we are retrieving, before the last
+         * @param p_last Gets the node before it, nullptr for the front
+         *
+         * @brief Walks to the index from the cursor if it is behind, otherwise from the front
+         * @return Returns a pointer to the node
+         */
+        Node* m_walk(size_t p_index, Node*& p_last) const;
+
+        /**
+         * @brief Forgets the cursor, used when the node under it might be gone
+         */
+        void m_resetCursor();
+
+        /**
+         * @param p_index The index the chain goes in front of
+         * @param p_first The first node of the chain
+         * @param p_last The last node of the chain
+         * @param p_count How many nodes are in the chain
+         *
+         * @brief Links a chain of nodes in
+         */
+        void m_attach(size_t p_index, Node* p_first, Node* p_last, size_t p_count);
+
+        /**
+         * @param p_node The first node of a run
+         *
+         * @brief Finds the end of the sorted run that starts at the node
+         * @return Returns the last node of the run
+         */
+        static Node* ms_run(Node* p_node);
+
+        /**
+         * @param p_left The first sorted chain, ended by nullptr
+         * @param p_right The second sorted chain, ended by nullptr
+         * @param p_leftLast The last node of the first chain
+         * @param p_rightLast The last node of the second chain
+         * @param p_last Gets the last node of the result
+         *
+         * @brief Merges two sorted chains into one
+         * @return Returns the first node of the result
+         */
+        static Node* ms_merge(Node* p_left, Node* p_leftLast, Node* p_right, Node* p_rightLast, Node*& p_last);
+
         /// The front of the LinkedList
         Node* m_data;
         
         /// The last of the LinkedList
         Node* m_last;
+
+        /// Where new nodes come from, made when the first node is
+        NodePool<Node>* m_pool;
+
+        /// If the pool is the one shared by the thread
+        bool m_sharedPool;
+
+        /// The amount of nodes
+        size_t m_size;
+
+        /// The last node we walked to, or nullptr, only moved by non-const access
+        Node* m_cursor;
+
+        /// The node before the cursor, or nullptr if we don't know it
+        Node* m_cursorLast;
+
+        /// The index of the cursor
+        size_t m_cursorIndex;
     public:
         /**
          * @class Iterator
@@ -285,55 +436,41 @@ namespace cslib {
 }
 
 template<typename T>
-cslib::LinkedList<T>::LinkedList() : m_data(nullptr), m_last(nullptr) {
+cslib::LinkedList<T>::LinkedList() : m_data(nullptr), m_last(nullptr), m_pool(nullptr), m_sharedPool(false), m_size(0), m_cursor(nullptr), m_cursorLast(nullptr), m_cursorIndex(0) {
 
 }
 
 template<typename T>
-cslib::LinkedList<T>::LinkedList(const LinkedList<T>& p_ll) {
+cslib::LinkedList<T>::LinkedList(bool p_sharedPool) : m_data(nullptr), m_last(nullptr), m_pool(nullptr), m_sharedPool(p_sharedPool), m_size(0), m_cursor(nullptr), m_cursorLast(nullptr), m_cursorIndex(0) {
+
+}
+
+template<typename T>
+cslib::LinkedList<T>::LinkedList(const LinkedList<T>& p_ll) : m_data(nullptr), m_last(nullptr), m_pool(nullptr), m_sharedPool(p_ll.m_sharedPool), m_size(0), m_cursor(nullptr), m_cursorLast(nullptr), m_cursorIndex(0) {
     m_copy(p_ll);
 }
 
 template<typename T>
 cslib::LinkedList<T>& cslib::LinkedList<T>::operator= (const LinkedList<T>& p_ll) {
-    m_copy(p_ll);
+    if (this != &p_ll) {
+        m_clear();
+        m_copy(p_ll);
+    }
     return *this;
 }
 
 template<typename T>
 cslib::LinkedList<T>::~LinkedList() {
-    // Delete all and refocus
-    Node* node = this->m_data;
-    if (node == nullptr) {
-        return;
-    }
-    while (node->next != nullptr) {
-        Node* todo = node;
-        node = node->next;
-
-        delete todo;
+    // Delete all and let go of the pool
+    m_clear();
+    if (this->m_pool != nullptr) {
+        this->m_pool->release();
     }
 }
 
 template<typename T>
 size_t cslib::LinkedList<T>::size() const {
-    // If nothing exists...
-    if (m_data == nullptr) {
-        return 0;
-    }
-
-    // This will be incremented
-    size_t i = 1;
-
-    // Until we are the end 
-    Node* node = this->m_data;
-    while (node->next != nullptr) {
-        node = node->next;
-        i++;
-    }
-
-    // Return the size
-    return i;
+    return this->m_size;
 }
 
 template<typename T>
@@ -344,7 +481,7 @@ T& cslib::LinkedList<T>::operator[](size_t p_index) {
 
 template<typename T>
 const T& cslib::LinkedList<T>::operator[](size_t p_index) const {
-    Node* node = this->m_at(p_index);
+    const Node* node = this->m_at(p_index);
     return node->data;
 }
 
@@ -365,15 +502,14 @@ T& cslib::LinkedList<T>::append(const T& p_data) {
         this->m_last = this->m_last->next;
     }
     
+    this->m_size++;
     return node->data;
 }
 
 template<typename T>
 T& cslib::LinkedList<T>::insert(const T& p_data, size_t p_index) {
-    // Get size and create new node
-    const size_t n = this->size();
-
     // Bound check
+    const size_t n = this->m_size;
     if (p_index > n) {
         throw OutOfRange();
     }
@@ -388,35 +524,18 @@ T& cslib::LinkedList<T>::insert(const T& p_data, size_t p_index) {
 
     // If we want to insert at the start
     if (p_index == 0) {
-        // Get current start
-        Node* next = this->m_data;
-        node->next = next;
-
-        // If the data is nullptr
-        if (this->m_data == nullptr) {
-            this->m_last = next;
-        }
-        this->m_data = node;
+        this->m_pushFront(node);
         return node->data;
     }
 
-    // Otherwise, we will iterate until we get to the one we want
-    size_t i = 1;
-    Node* last = this->m_data;
-    while (i != p_index) {
-        // IF bounds are bad
-        if (i < p_index && (last == nullptr || last->next == nullptr)) {
-            throw OutOfRange();
-        }
-
-        last = last->next;
-        i++;
-    }
+    // Otherwise find the node before, the cursor is left on it
+    Node* last = this->m_at(p_index - 1);
 
     // Add to last node
     Node* after = last->next;
     last->next = node;
     node->next = after;
+    this->m_size++;
 
     return node->data;
 
@@ -441,55 +560,184 @@ void cslib::LinkedList<T>::swap(size_t p_left, size_t p_right) {
 
 template<typename T>
 T cslib::LinkedList<T>::remove(size_t p_index) {
-    // Check fi we're empty
-    if (this->m_data == nullptr) {
+    // Check if we're in range
+    if (p_index >= this->m_size) {
         throw OutOfRange();
     }
 
     // If we're removing the first...
     if (p_index == 0) {
         // Delete the first node and replace it with the one after.
-        Node* delNode = this->m_data;
-        Node* aftNode = nullptr;
-        if (delNode->next != nullptr) {
-            aftNode = delNode->next;
-        }
-
+        Node* delNode = this->m_popFront();
         T temp = delNode->data;
-        delete delNode;
-
-        this->m_data = aftNode;
-
+        this->m_destroy(delNode);
         return temp;
     }
     
-    // Loop until we get a good node
-    Node* last = this->m_data;
+    // Find the node before, the cursor is left on it
+    Node* last = this->m_at(p_index - 1);
+    Node* node = last->next;
+    Node* after = node->next;
+
+    T temp = node->data;
+    this->m_destroy(node);
+    this->m_size--;
+
+    last->next = after;
+    if (after == nullptr) {
+        this->m_last = last;
+    }
+    return temp;
+}
+
+template<typename T>
+void cslib::LinkedList<T>::reverse() {
+    // Point every node back at the one before it
+    Node* last = nullptr;
     Node* node = this->m_data;
-    size_t i = 0;
-    while (i < p_index) {
+    this->m_last = node;
+    while (node != nullptr) {
+        Node* next = node->next;
+        node->next = last;
         last = node;
-        node = node->next;
+        node = next;
+    }
 
-        if (node == nullptr) {
-            throw OutOfRange();
-        }
+    this->m_data = last;
+    this->m_resetCursor();
+}
 
-        i++;
+template<typename T>
+void cslib::LinkedList<T>::splice(size_t p_index, LinkedList<T>& p_other, size_t p_first, size_t p_count) {
+    // Can't take from ourselves
+    if (&p_other == this) {
+        throw LinkedListException();
     }
 
-    Node* after = node->next;
-    T temp = node->data;
-    delete node;
-    
+    // Bound check
+    if (p_index > this->m_size || p_first > p_other.m_size || p_count > p_other.m_size - p_first) {
+        throw OutOfRange();
+    }
+
+    if (p_count == 0) {
+        return;
+    }
+
+    // Find the chain, the cursor walks us from before to the last of it
+    Node* before = (p_first == 0) ? nullptr : p_other.m_at(p_first - 1);
+    Node* first = (before == nullptr) ? p_other.m_data : before->next;
+    Node* last = p_other.m_at(p_first + p_count - 1);
+    Node* after = last->next;
+
+    // Cut it out of the other
+    if (before == nullptr) {
+        p_other.m_data = after;
+    } else {
+        before->next = after;
+    }
     if (after == nullptr) {
+        p_other.m_last = before;
+    }
+    p_other.m_size -= p_count;
+    p_other.m_resetCursor();
+
+    this->m_attach(p_index, first, last, p_count);
+}
+
+template<typename T>
+void cslib::LinkedList<T>::splice(size_t p_index, LinkedList<T>& p_other) {
+    this->splice(p_index, p_other, 0, p_other.m_size);
+}
+
+template<typename T>
+void cslib::LinkedList<T>::split(size_t p_index, LinkedList<T>& p_tail) {
+    if (p_index > this->m_size) {
+        throw OutOfRange();
+    }
+    p_tail.splice(p_tail.m_size, *this, p_index, this->m_size - p_index);
+}
+
+template<typename T>
+void cslib::LinkedList<T>::merge(LinkedList<T>& p_other) {
+    if (&p_other == this || p_other.m_data == nullptr) {
+        return;
+    }
+
+    Node* last = nullptr;
+    if (this->m_data == nullptr) {
+        this->m_data = p_other.m_data;
+        last = p_other.m_last;
+    } else {
+        this->m_data = ms_merge(this->m_data, this->m_last, p_other.m_data, p_other.m_last, last);
+    }
+
+    this->m_last = last;
+    this->m_size += p_other.m_size;
+    this->m_resetCursor();
+
+    // The nodes are all ours now
+    p_other.m_data = nullptr;
+    p_other.m_last = nullptr;
+    p_other.m_size = 0;
+    p_other.m_resetCursor();
+}
+
+template<typename T>
+void cslib::LinkedList<T>::sort() {
+    if (this->m_size < 2) {
+        return;
+    }
+
+    // Merge neighbouring runs until there is only one
+    size_t runs = 0;
+    do {
+        Node* first = nullptr;
+        Node* last = nullptr;
+        Node* node = this->m_data;
+        runs = 0;
+
+        while (node != nullptr) {
+            // Cut out the left run
+            Node* left = node;
+            Node* leftLast = ms_run(left);
+            Node* right = leftLast->next;
+            leftLast->next = nullptr;
+
+            // And the right one if there is one
+            Node* merged = left;
+            Node* mergedLast = leftLast;
+            if (right != nullptr) {
+                Node* rightLast = ms_run(right);
+                node = rightLast->next;
+                rightLast->next = nullptr;
+                merged = ms_merge(left, leftLast, right, rightLast, mergedLast);
+            } else {
+                node = nullptr;
+            }
+
+            // Add onto what we've done
+            if (first == nullptr) {
+                first = merged;
+            } else {
+                last->next = merged;
+            }
+            last = mergedLast;
+            runs++;
+        }
+
+        this->m_data = first;
         this->m_last = last;
-        last->next = nullptr;
-        return temp;
+    } while (runs > 1);
+
+    this->m_resetCursor();
+}
+
+template<typename T>
+cslib::NodePoolStats cslib::LinkedList<T>::poolStats() const {
+    if (this->m_pool == nullptr) {
+        return NodePoolStats();
     }
-    
-    last->next = after;
-    return temp;
+    return this->m_pool->stats();
 }
 
 template<typename T>
@@ -501,6 +749,7 @@ void cslib::LinkedList<T>::m_copy(const LinkedList<T>& p_ll) {
     if (n == 0) {
         this->m_data = nullptr;
         this->m_last = nullptr;
+        this->m_size = 0;
         return;
     }
 
@@ -530,71 +779,235 @@ void cslib::LinkedList<T>::m_copy(const LinkedList<T>& p_ll) {
     }
     
     this->m_last = next;
+    this->m_size = n;
 }
 
 template<typename T>
 typename cslib::LinkedList<T>::Node* cslib::LinkedList<T>::m_create(const T& p_data) {
-    // Creates a new node 
+    // Get the pool the first time we need it
+    if (this->m_pool == nullptr) {
+        this->m_pool = (this->m_sharedPool) ? NodePool<Node>::local() : NodePool<Node>::create();
+    }
+
+    // Creates a new node in memory from the pool
+    Node* memory = nullptr;
     try {
-        Node* node = new Node();
-        node->data = p_data;
-        node->next = nullptr;
+        memory = this->m_pool->allocate();
+        Node* node = new (memory) Node{ p_data, nullptr };
         return node;
     } catch (std::exception&) {
+        if (memory != nullptr) {
+            NodePool<Node>::deallocate(memory);
+        }
         throw LinkedListNodeCantCreate();
     }
 }
 
 template<typename T>
-typename cslib::LinkedList<T>::Node* cslib::LinkedList<T>::m_at(size_t p_index) {
-    // For each
-    size_t i = 0;
-    size_t n = this->size();
+void cslib::LinkedList<T>::m_destroy(Node* p_node) {
+    // Nodes go back to the pool they came from, which might not be ours
+    p_node->~Node();
+    NodePool<Node>::deallocate(p_node);
+}
 
-    // Check if valid relation
-    if (p_index >= n) {
-        throw OutOfRange();
+template<typename T>
+void cslib::LinkedList<T>::m_clear() {
+    Node* node = this->m_data;
+    while (node != nullptr) {
+        Node* next = node->next;
+        this->m_destroy(node);
+        node = next;
     }
 
-    // Get the element at
+    this->m_data = nullptr;
+    this->m_last = nullptr;
+    this->m_size = 0;
+    this->m_resetCursor();
+}
+
+template<typename T>
+void cslib::LinkedList<T>::m_pushFront(Node* p_node) {
+    p_node->next = this->m_data;
+    this->m_data = p_node;
+    if (this->m_last == nullptr) {
+        this->m_last = p_node;
+    }
+    this->m_size++;
+
+    // Everything moved one along
+    if (this->m_cursor != nullptr) {
+        this->m_cursorIndex++;
+        if (this->m_cursorIndex == 1) {
+            this->m_cursorLast = p_node;
+        }
+    }
+}
+
+template<typename T>
+typename cslib::LinkedList<T>::Node* cslib::LinkedList<T>::m_popFront() {
     Node* node = this->m_data;
-    while (i < n) {
-        // IF equal at position
-        if (i == p_index) {
-            return node;
+    this->m_data = node->next;
+    if (this->m_data == nullptr) {
+        this->m_last = nullptr;
+    }
+    this->m_size--;
+
+    // Everything moved one back
+    if (this->m_cursor == node) {
+        this->m_resetCursor();
+    } else if (this->m_cursor != nullptr) {
+        this->m_cursorIndex--;
+        if (this->m_cursorLast == node) {
+            this->m_cursorLast = nullptr;
         }
+    }
 
-        node = node->next;
-        i++;
+    return node;
+}
+
+template<typename T>
+void cslib::LinkedList<T>::m_resetCursor() {
+    this->m_cursor = nullptr;
+    this->m_cursorLast = nullptr;
+    this->m_cursorIndex = 0;
+}
+
+template<typename T>
+void cslib::LinkedList<T>::m_attach(size_t p_index, Node* p_first, Node* p_last, size_t p_count) {
+    // Find the nodes on both sides
+    Node* before = (p_index == 0) ? nullptr : this->m_at(p_index - 1);
+    Node* after = (before == nullptr) ? this->m_data : before->next;
+
+    p_last->next = after;
+    if (before == nullptr) {
+        this->m_data = p_first;
+    } else {
+        before->next = p_first;
+    }
+    if (after == nullptr) {
+        this->m_last = p_last;
     }
 
-    throw OutOfRange();
+    this->m_size += p_count;
+    this->m_resetCursor();
 }
 
 template<typename T>
-typename const cslib::LinkedList<T>::Node* cslib::LinkedList<T>::m_at(size_t p_index) const {
-    // For each
-    size_t i = 0;
-    size_t n = this->size();
+typename cslib::LinkedList<T>::Node* cslib::LinkedList<T>::ms_run(Node* p_node) {
+    while (p_node->next != nullptr && !(p_node->next->data < p_node->data)) {
+        p_node = p_node->next;
+    }
+    return p_node;
+}
+
+template<typename T>
+typename cslib::LinkedList<T>::Node* cslib::LinkedList<T>::ms_merge(Node* p_left, Node* p_leftLast, Node* p_right, Node* p_rightLast, Node*& p_last) {
+    // Where the next node gets linked
+    Node* first = nullptr;
+    Node** link = &first;
+
+    // Take from the left unless the right is smaller, keeps it stable
+    while (p_left != nullptr && p_right != nullptr) {
+        if (p_right->data < p_left->data) {
+            *link = p_right;
+            p_right = p_right->next;
+        } else {
+            *link = p_left;
+            p_left = p_left->next;
+        }
+        link = &((*link)->next);
+    }
 
+    // The rest is already in order
+    if (p_left != nullptr) {
+        *link = p_left;
+        p_last = p_leftLast;
+    } else {
+        *link = p_right;
+        p_last = p_rightLast;
+    }
+    return first;
+}
+
+template<typename T>
+typename cslib::LinkedList<T>::Node* cslib::LinkedList<T>::m_at(size_t p_index) {
     // Check if valid relation
-    if (p_index >= n) {
+    if (p_index >= this->m_size) {
         throw OutOfRange();
     }
 
-    // Get the element at
-    const Node* node = this->m_data;
-    while (i < n) {
-        // IF equal at position
-        if (i == p_index) {
-            return node;
+    // The last is always known
+    if (p_index == this->m_size - 1) {
+        return this->m_last;
+    }
+
+    // Right on, or one behind the cursor
+    if (this->m_cursor != nullptr) {
+        if (p_index == this->m_cursorIndex) {
+            return this->m_cursor;
         }
+        if (p_index + 1 == this->m_cursorIndex && this->m_cursorLast != nullptr) {
+            this->m_cursor = this->m_cursorLast;
+            this->m_cursorLast = nullptr;
+            this->m_cursorIndex = p_index;
+            return this->m_cursor;
+        }
+    }
+
+    // Remember where we are
+    Node* last = nullptr;
+    Node* node = this->m_walk(p_index, last);
+    this->m_cursor = node;
+    this->m_cursorLast = last;
+    this->m_cursorIndex = p_index;
+    return node;
+}
+
+template<typename T>
+const typename cslib::LinkedList<T>::Node* cslib::LinkedList<T>::m_at(size_t p_index) const {
+    // Check if valid relation
+    if (p_index >= this->m_size) {
+        throw OutOfRange();
+    }
+
+    // The last is always known
+    if (p_index == this->m_size - 1) {
+        return this->m_last;
+    }
+
+    // Right on, or one behind the cursor
+    if (this->m_cursor != nullptr) {
+        if (p_index == this->m_cursorIndex) {
+            return this->m_cursor;
+        }
+        if (p_index + 1 == this->m_cursorIndex && this->m_cursorLast != nullptr) {
+            return this->m_cursorLast;
+        }
+    }
 
+    Node* last = nullptr;
+    return this->m_walk(p_index, last);
+}
+
+template<typename T>
+typename cslib::LinkedList<T>::Node* cslib::LinkedList<T>::m_walk(size_t p_index, Node*& p_last) const {
+    // Start from the cursor if it is behind, otherwise from the front
+    size_t i = 0;
+    Node* node = this->m_data;
+    p_last = nullptr;
+    if (this->m_cursor != nullptr && this->m_cursorIndex < p_index) {
+        i = this->m_cursorIndex;
+        node = this->m_cursor;
+    }
+
+    // Get the element at
+    while (i < p_index) {
+        p_last = node;
         node = node->next;
         i++;
     }
 
-    throw OutOfRange();
+    return node;
 }
 
 template<typename T>
@@ -698,23 +1111,7 @@ typename cslib::LinkedList<T>::ConstIterator cslib::LinkedList<T>::ConstIterator
 
 template<typename T>
 void cslib::LinkedList_reverse(cslib::LinkedList<T>& p_ll) {
-    // Create an array
-    const size_t n = p_ll.size();
-    T* arr = new T[n];
-
-    // Add to array
-    size_t i = 0;
-    for (auto it = p_ll.begin(); it != p_ll.end(); ++it) {
-        arr[i] = (*it);
-        i++;
-    }
-
-    // Now we will put this into the other
-    i = n - 1;
-    for (auto it = p_ll.begin(); it != p_ll.end(); ++it) {
-        (*it) = arr[i];
-        i--;
-    }
+    p_ll.reverse();
 }
 
 template<typename T>
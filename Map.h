@@ -89,6 +89,20 @@ namespace cslib {
          **/
         size_t size() const;
 
+        /**
+         * @param p_index How many keys are smaller than the one we want, 0 for the smallest
+         * @brief Gets the key at that place in order, in O(log n)
+         * @return Returns the key
+         **/
+        const T1& select(size_t p_index) const;
+
+        /**
+         * @param p_key The key we're comparing with, doesn't need to be in the map
+         * @brief Counts the keys smaller than the key, in O(log n)
+         * @return Returns where the key is or would go in order
+         **/
+        size_t rank(const T1& p_key) const;
+
         /**
          * @brief Returns a vector full of keys
          **/
@@ -99,6 +113,65 @@ namespace cslib {
          **/
         Vector<const T2&> values() const;
 
+        /// Walks the map in key order, each value holds the key and its data
+        typedef typename AVLTree<MapNode<T1, T2>>::ConstIterator ConstIterator;
+
+        /**
+         * @brief Gets the iterator to the smallest key.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator begin() const;
+
+        /**
+         * @brief Gets the iterator to the value after the biggest key.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator end() const;
+
+        /**
+         * @brief Gets the iterator to the biggest key, walk it with -- until it equals end()
+         * @return Returns a iterator to the node
+         */
+        ConstIterator last() const;
+
+        /**
+         * @param p_key The key we're comparing with, doesn't need to be in the map
+         * @brief Finds the smallest key that isn't smaller than the key
+         * @return Returns a iterator to the node, end() if every key is smaller
+         **/
+        ConstIterator lowerBound(const T1& p_key) const;
+
+        /**
+         * @param p_key The key we're comparing with, doesn't need to be in the map
+         * @brief Finds the smallest key bigger than the key, lowerBound(lo) to upperBound(hi) walks lo to hi
+         * @return Returns a iterator to the node, end() if no key is bigger
+         **/
+        ConstIterator upperBound(const T1& p_key) const;
+
+        /**
+         * @param p_key The key we're comparing with, doesn't need to be in the map
+         * @brief Finds the biggest key that isn't bigger than the key
+         * @return Returns the key
+         **/
+        const T1& floor(const T1& p_key) const;
+
+        /**
+         * @param p_key The key we're comparing with, doesn't need to be in the map
+         * @brief Finds the smallest key that isn't smaller than the key
+         * @return Returns the key
+         **/
+        const T1& ceiling(const T1& p_key) const;
+
+        /**
+         * @tparam TF The function type that we're going to play, takes the key and the data
+         * @param p_low The smallest key we want
+         * @param p_high The key we stop before
+         * @param p_func The function we're going to play on each key between them, in order
+         * @brief Plays the keys in [low, high) like ConcurrentSkipList::range(), only going past the nodes that lead to them
+         **/
+        template<typename TF>
+        void range(const T1& p_low, const T1& p_high, TF&& p_func) const;
+
     protected:
         /// The internal data structure
         typedef MapNode<T1, T2> MapNode;
@@ -112,6 +185,13 @@ namespace cslib {
          * @return Returns the data relating to the keys
          **/
         T2& m_insert(const T1& p_key);
+
+        /**
+         * @param p_key The key
+         * @brief Makes a node to compare the tree with, only the key is compared
+         * @return Returns the node
+         **/
+        static MapNode ms_probe(const T1& p_key);
     };
 }
 
@@ -203,6 +283,43 @@ size_t cslib::Map<T1, T2>::size() const {
     return this->amount();
 }
 
+template<typename T1, typename T2>
+const T1& cslib::Map<T1, T2>::select(size_t p_index) const {
+    return AVLTree<MapNode>::select(p_index).key;
+}
+
+template<typename T1, typename T2>
+size_t cslib::Map<T1, T2>::rank(const T1& p_key) const {
+    return AVLTree<MapNode>::rank(ms_probe(p_key));
+}
+
+template<typename T1, typename T2>
+typename cslib::Map<T1, T2>::ConstIterator cslib::Map<T1, T2>::lowerBound(const T1& p_key) const {
+    return AVLTree<MapNode>::lowerBound(ms_probe(p_key));
+}
+
+template<typename T1, typename T2>
+typename cslib::Map<T1, T2>::ConstIterator cslib::Map<T1, T2>::upperBound(const T1& p_key) const {
+    return AVLTree<MapNode>::upperBound(ms_probe(p_key));
+}
+
+template<typename T1, typename T2>
+const T1& cslib::Map<T1, T2>::floor(const T1& p_key) const {
+    return AVLTree<MapNode>::floor(ms_probe(p_key)).key;
+}
+
+template<typename T1, typename T2>
+const T1& cslib::Map<T1, T2>::ceiling(const T1& p_key) const {
+    return AVLTree<MapNode>::ceiling(ms_probe(p_key)).key;
+}
+
+template<typename T1, typename T2> template<typename TF>
+void cslib::Map<T1, T2>::range(const T1& p_low, const T1& p_high, TF&& p_func) const {
+    AVLTree<MapNode>::range(ms_probe(p_low), ms_probe(p_high), [&](const MapNode& node) {
+        p_func(node.key, node.data);
+    });
+}
+
 template<typename T1, typename T2>
 cslib::Vector<const T1&> cslib::Map<T1, T2>::keys() const {
     // The vector full of keys
@@ -229,6 +346,21 @@ cslib::Vector<const T2&> cslib::Map<T1, T2>::values() const {
     return vals;
 }
 
+template<typename T1, typename T2>
+typename cslib::Map<T1, T2>::ConstIterator cslib::Map<T1, T2>::begin() const {
+    return AVLTree<MapNode>::begin();
+}
+
+template<typename T1, typename T2>
+typename cslib::Map<T1, T2>::ConstIterator cslib::Map<T1, T2>::end() const {
+    return AVLTree<MapNode>::end();
+}
+
+template<typename T1, typename T2>
+typename cslib::Map<T1, T2>::ConstIterator cslib::Map<T1, T2>::last() const {
+    return AVLTree<MapNode>::last();
+}
+
 template<typename T1, typename T2>
 T2& cslib::Map<T1, T2>::m_insert(const T1& p_key) {
     // Create node
@@ -254,6 +386,8 @@ T2& cslib::Map<T1, T2>::m_insert(const T1& p_key) {
             if (current->left == nullptr) {
                 // Set it
                 current->left = node;
+                node->parent = current;
+                BSTree<MapNode>::ms_grow(current, 1);
                 return node->data.data;
             }
             current = current->left;
@@ -265,6 +399,8 @@ T2& cslib::Map<T1, T2>::m_insert(const T1& p_key) {
             if (current->right == nullptr) {
                 // Set it
                 current->right = node;
+                node->parent = current;
+                BSTree<MapNode>::ms_grow(current, 1);
                 return node->data.data;
             }
 
@@ -280,4 +416,12 @@ T2& cslib::Map<T1, T2>::m_insert(const T1& p_key) {
     throw BSTNodeExists();
 }
 
+template<typename T1, typename T2>
+typename cslib::Map<T1, T2>::MapNode cslib::Map<T1, T2>::ms_probe(const T1& p_key) {
+    MapNode mapnode;
+    mapnode.key = p_key;
+    mapnode.data = T2();
+    return mapnode;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,304 @@
+/**
+ * @file MpmcQueue.h
+ * @brief Holds the MpmcQueue, a bounded first-in-first out structure any number of threads can push and pop.
+ **/
+#ifndef CSMPMCQUEUE_H
+#define CSMPMCQUEUE_H
+
+#include "Universal.h"
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+/// How many times a blocking call looks at its cell before it sleeps.
+#define MPMCQUEUE_SPINS 64
+
+namespace cslib {
+    /**
+     * @class MpmcQueue
+     * @tparam T Type of the data structure.
+     * @brief A lock free First-in-first out data structure with a fixed capacity, for many producers and consumers.
+     *
+     * Every cell of the power-of-two ring holds a sequence number that says whose turn it is. For
+     * position p, the cell's sequence is p when it's free for the producer of p, p + 1 once the value
+     * is in, and p + capacity once the consumer is done and it's free for the next lap. A thread
+     * claims a position by moving the enqueue or dequeue index on, and only then touches the cell,
+     * so producers and consumers don't fight over the same line unless the ring is almost empty.
+     *
+     * The try calls never wait. The blocking calls claim the next position straight away and wait for
+     * its cell to be their turn, sleeping after a short spin. T's copy shouldn't throw, a claimed
+     * position has to be filled.
+     **/
+    template<typename T>
+    class MpmcQueue {
+    protected:
+        /**
+         * @struct Cell
+         * @brief A place in the ring
+         **/
+        struct Cell {
+            /// Whose turn it is
+            std::atomic<size_t> sequence;
+            /// Where the value goes
+            alignas(T) unsigned char storage[sizeof(T)];
+        };
+
+    public:
+        /**
+         * @param p_capacity The least amount of values it holds, rounded up to a power of two
+         *
+         * @brief Constructs an empty queue
+         */
+        MpmcQueue(size_t p_capacity);
+
+        /**
+         * @brief Destroys what's left, nobody can be using it
+         */
+        ~MpmcQueue();
+
+        /// Copying can't be done safely while others use it
+        MpmcQueue(const MpmcQueue<T>&) = delete;
+        MpmcQueue<T>& operator= (const MpmcQueue<T>&) = delete;
+
+        /**
+         * @brief Gets how many values fit
+         * @return Returns the capacity
+         */
+        size_t capacity() const;
+
+        /**
+         * @brief Gets the amount of values when we looked
+         * @return Returns the amount of values
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if there was no data in the data structure when we looked.
+         * @return True if empty, false if at least one item.
+         */
+        bool empty() const;
+
+        /**
+         * @param p_data The data we are adding to the back
+         *
+         * @brief Adds the value to the back if there is room
+         * @return Returns false if the queue was full
+         */
+        bool tryEnqueue(const T& p_data);
+
+        /**
+         * @param p_data Gets the value from the front
+         *
+         * @brief Takes the front value off if there is one
+         * @return Returns false if the queue was empty
+         */
+        bool tryDequeue(T& p_data);
+
+        /**
+         * @param p_data The data we are adding to the back
+         *
+         * @brief Adds the value to the back, waiting for room if it's full
+         */
+        void enqueue(const T& p_data);
+
+        /**
+         * @brief Takes the front value off, waiting for one if it's empty
+         * @return Returns the value that just got dequeued.
+         */
+        T dequeue();
+
+    protected:
+        /**
+         * @param p_cell The cell we claimed
+         * @param p_sequence The sequence that makes it our turn
+         *
+         * @brief Waits until it's our turn at the cell
+         */
+        void m_wait(Cell& p_cell, size_t p_sequence);
+
+        /**
+         * @param p_cell The cell we're done with
+         * @param p_sequence The sequence that makes it the next one's turn
+         *
+         * @brief Hands the cell on, waking whoever sleeps on it
+         */
+        void m_publish(Cell& p_cell, size_t p_sequence);
+
+        /// The ring
+        Cell* m_cells;
+
+        /// The capacity less one
+        size_t m_mask;
+
+        /// How many blocking calls are asleep, nobody notifies when there are none
+        std::atomic<size_t> m_waiters;
+
+        /// The next position a producer claims
+        alignas(64) std::atomic<size_t> m_enqueuePos;
+
+        /// The next position a consumer claims
+        alignas(64) std::atomic<size_t> m_dequeuePos;
+    };
+}
+
+template<typename T>
+cslib::MpmcQueue<T>::MpmcQueue(size_t p_capacity) : m_cells(nullptr), m_mask(0), m_waiters(0), m_enqueuePos(0), m_dequeuePos(0) {
+    size_t capacity = 2;
+    while (capacity < p_capacity) {
+        capacity *= 2;
+    }
+
+    this->m_cells = new Cell[capacity];
+    this->m_mask = capacity - 1;
+    for (size_t i = 0; i < capacity; i++) {
+        this->m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+cslib::MpmcQueue<T>::~MpmcQueue() {
+    size_t end = this->m_enqueuePos.load(std::memory_order_acquire);
+    for (size_t i = this->m_dequeuePos.load(std::memory_order_acquire); i < end; i++) {
+        reinterpret_cast<T*>(this->m_cells[i & this->m_mask].storage)->~T();
+    }
+    delete[] this->m_cells;
+}
+
+template<typename T>
+size_t cslib::MpmcQueue<T>::capacity() const {
+    return this->m_mask + 1;
+}
+
+template<typename T>
+size_t cslib::MpmcQueue<T>::size() const {
+    // Blocking consumers can claim past the producers
+    size_t dequeuePos = this->m_dequeuePos.load(std::memory_order_acquire);
+    size_t enqueuePos = this->m_enqueuePos.load(std::memory_order_acquire);
+    if (enqueuePos <= dequeuePos) {
+        return 0;
+    }
+
+    size_t size = enqueuePos - dequeuePos;
+    return (size > this->m_mask + 1) ? this->m_mask + 1 : size;
+}
+
+template<typename T>
+bool cslib::MpmcQueue<T>::empty() const {
+    return (this->size() == 0);
+}
+
+template<typename T>
+bool cslib::MpmcQueue<T>::tryEnqueue(const T& p_data) {
+    size_t pos = this->m_enqueuePos.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+        cell = &this->m_cells[pos & this->m_mask];
+        intptr_t diff = (intptr_t)cell->sequence.load(std::memory_order_acquire) - (intptr_t)pos;
+
+        if (diff == 0) {
+            // Free for this lap, claim it
+            if (this->m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Still holds last lap's value
+            return false;
+        } else {
+            // Another producer took it
+            pos = this->m_enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    new (cell->storage) T(p_data);
+    this->m_publish(*cell, pos + 1);
+    return true;
+}
+
+template<typename T>
+bool cslib::MpmcQueue<T>::tryDequeue(T& p_data) {
+    size_t pos = this->m_dequeuePos.load(std::memory_order_relaxed);
+    Cell* cell = nullptr;
+    while (true) {
+        cell = &this->m_cells[pos & this->m_mask];
+        intptr_t diff = (intptr_t)cell->sequence.load(std::memory_order_acquire) - (intptr_t)(pos + 1);
+
+        if (diff == 0) {
+            // Filled for this lap, claim it
+            if (this->m_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Nothing in it yet
+            return false;
+        } else {
+            // Another consumer took it
+            pos = this->m_dequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    T* value = reinterpret_cast<T*>(cell->storage);
+    p_data = std::move(*value);
+    value->~T();
+    this->m_publish(*cell, pos + this->m_mask + 1);
+    return true;
+}
+
+template<typename T>
+void cslib::MpmcQueue<T>::enqueue(const T& p_data) {
+    size_t pos = this->m_enqueuePos.fetch_add(1, std::memory_order_relaxed);
+    Cell& cell = this->m_cells[pos & this->m_mask];
+
+    // Wait for last lap's consumer to be done with it
+    this->m_wait(cell, pos);
+    new (cell.storage) T(p_data);
+    this->m_publish(cell, pos + 1);
+}
+
+template<typename T>
+T cslib::MpmcQueue<T>::dequeue() {
+    size_t pos = this->m_dequeuePos.fetch_add(1, std::memory_order_relaxed);
+    Cell& cell = this->m_cells[pos & this->m_mask];
+
+    // Wait for this lap's producer to fill it
+    this->m_wait(cell, pos + 1);
+    T* value = reinterpret_cast<T*>(cell.storage);
+    T temp = std::move(*value);
+    value->~T();
+    this->m_publish(cell, pos + this->m_mask + 1);
+    return temp;
+}
+
+template<typename T>
+void cslib::MpmcQueue<T>::m_wait(Cell& p_cell, size_t p_sequence) {
+    for (int i = 0; i < MPMCQUEUE_SPINS; i++) {
+        if (p_cell.sequence.load(std::memory_order_acquire) == p_sequence) {
+            return;
+        }
+    }
+
+    // Say we sleep before the last look, so a publish either sees us or we see it
+    this->m_waiters.fetch_add(1, std::memory_order_seq_cst);
+    while (true) {
+        size_t sequence = p_cell.sequence.load(std::memory_order_seq_cst);
+        if (sequence == p_sequence) {
+            break;
+        }
+        p_cell.sequence.wait(sequence, std::memory_order_acquire);
+    }
+    this->m_waiters.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template<typename T>
+void cslib::MpmcQueue<T>::m_publish(Cell& p_cell, size_t p_sequence) {
+    p_cell.sequence.store(p_sequence, std::memory_order_release);
+
+    // Other laps can sleep on the same cell, so wake them all
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (this->m_waiters.load(std::memory_order_relaxed) > 0) {
+        p_cell.sequence.notify_all();
+    }
+}
+
+
+#endif
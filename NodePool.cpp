@@ -0,0 +1,8 @@
+#include "NodePool.h"
+
+double cslib::NodePoolStats::hitRate() const {
+    if (this->requests == 0) {
+        return 0.0;
+    }
+    return (double)this->recycled / (double)this->requests;
+}
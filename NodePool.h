@@ -0,0 +1,316 @@
+/**
+ * @file NodePool.h
+ * @brief Holds the NodePool, a slab allocator that recycles the nodes of linked structures.
+ **/
+
+#ifndef CSNODEPOOL_H
+#define CSNODEPOOL_H
+
+#include "Universal.h"
+
+#include <new>
+
+namespace cslib {
+    /**
+     * @struct NodePoolStats
+     * @brief Counters kept by a node pool
+     **/
+    struct NodePoolStats {
+        /// How many nodes were asked for
+        size_t requests = 0;
+
+        /// How many of those were handed out from the free list
+        size_t recycled = 0;
+
+        /// How many blocks were allocated from the system
+        size_t blocks = 0;
+
+        /// How many nodes are handed out right now
+        size_t live = 0;
+
+        /**
+         * @brief Gets the fraction of requests that didn't need fresh memory
+         * @return Returns a value between 0 and 1
+         */
+        double hitRate() const;
+    };
+
+    /**
+     * @class NodePool
+     * @tparam TNode The node type we're handing out
+     * @brief Hands out node sized memory from contiguous blocks and recycles freed nodes.
+     *
+     * Blocks are made of pages, each aligned to the page size and starting with a header
+     * naming its pool, so a node can always be given back to the pool it came from, even
+     * after it has been moved into a structure that draws from a different pool. The first
+     * block is one small page, each one after holds twice the pages of the last, up to
+     * ms_pagesMax, so small structures stay small. A pool stays alive until every owner has
+     * released it and every node has been given back.
+     *
+     * Pools aren't thread safe. A node must be given back on the thread of its pool, which
+     * for the pool from local() is the thread that made the structure.
+     **/
+    template<typename TNode>
+    class NodePool {
+    public:
+        /**
+         * @brief Creates a new pool with one owner
+         * @return Returns the pool
+         */
+        static NodePool<TNode>* create();
+
+        /**
+         * @brief Gets the pool shared by everything on this thread and adds an owner
+         * @return Returns the pool
+         */
+        static NodePool<TNode>* local();
+
+        /**
+         * @brief Adds an owner to the pool
+         */
+        void retain();
+
+        /**
+         * @brief Removes an owner, the pool is deleted once nothing uses it
+         */
+        void release();
+
+        /**
+         * @brief Gets memory for a node, doesn't construct it
+         * @return Returns the memory for one node
+         */
+        TNode* allocate();
+
+        /**
+         * @param p_node The node we're giving back, already destroyed
+         *
+         * @brief Gives the memory of a node back to the pool it came from
+         */
+        static void deallocate(TNode* p_node);
+
+        /**
+         * @brief Gets the counters of this pool
+         * @return Returns the counters
+         */
+        const NodePoolStats& stats() const;
+
+    private:
+        /**
+         * @struct Block
+         * @brief The header at the start of every page, only the first page of a block links the blocks
+         **/
+        struct Block {
+            /// The pool the page belongs to
+            NodePool<TNode>* pool;
+
+            /// The block allocated before this one
+            Block* next;
+
+            /// How many pages the block holds, 0 past its first page
+            size_t pages;
+        };
+
+        /**
+         * @union Slot
+         * @brief A node, or a link in the free list once it is given back
+         **/
+        union Slot {
+            /// The next free slot
+            Slot* next;
+
+            /// Room for the node
+            alignas(TNode) unsigned char storage[sizeof(TNode)];
+        };
+
+        /**
+         * @param p_bytes The least amount of bytes
+         *
+         * @brief Rounds up to a power of two
+         * @return Returns the power of two
+         */
+        static constexpr size_t ms_powerOfTwo(size_t p_bytes, size_t p_power = 1);
+
+        /// Where the first slot starts in a block
+        static constexpr size_t ms_offset = ((sizeof(Block) + alignof(Slot) - 1) / alignof(Slot)) * alignof(Slot);
+
+        /// The size (and alignment) of every page, room for at least 4 nodes
+        static constexpr size_t ms_pageBytes = ms_powerOfTwo(ms_offset + 4 * sizeof(Slot) > 128 ? ms_offset + 4 * sizeof(Slot) : 128);
+
+        /// How many slots fit in a page
+        static constexpr size_t ms_slots = (ms_pageBytes - ms_offset) / sizeof(Slot);
+
+        /// The most pages a block holds
+        static constexpr size_t ms_pagesMax = 16;
+
+        /**
+         * @brief Constructs an empty pool
+         */
+        NodePool();
+
+        /**
+         * @brief Frees every block
+         */
+        ~NodePool();
+
+        /**
+         * @brief Deletes the pool if nothing uses it anymore
+         */
+        void m_collect();
+
+        /// The most recent block
+        Block* m_blocks;
+
+        /// The page slots are bumped out of
+        Block* m_page;
+
+        /// How many pages of the most recent block are left after that one
+        size_t m_pagesLeft;
+
+        /// Slots used in the page
+        size_t m_used;
+
+        /// Slots which were given back
+        Slot* m_free;
+
+        /// How many structures use this pool
+        size_t m_owners;
+
+        /// The counters
+        NodePoolStats m_stats;
+    };
+}
+
+template<typename TNode>
+constexpr size_t cslib::NodePool<TNode>::ms_powerOfTwo(size_t p_bytes, size_t p_power) {
+    return (p_power >= p_bytes) ? p_power : ms_powerOfTwo(p_bytes, p_power * 2);
+}
+
+template<typename TNode>
+cslib::NodePool<TNode>::NodePool() : m_blocks(nullptr), m_page(nullptr), m_pagesLeft(0), m_used(ms_slots), m_free(nullptr), m_owners(1) {
+
+}
+
+template<typename TNode>
+cslib::NodePool<TNode>::~NodePool() {
+    // Give all the blocks back
+    Block* block = this->m_blocks;
+    while (block != nullptr) {
+        Block* next = block->next;
+        ::operator delete(block, std::align_val_t(ms_pageBytes));
+        block = next;
+    }
+}
+
+template<typename TNode>
+cslib::NodePool<TNode>* cslib::NodePool<TNode>::create() {
+    return new NodePool<TNode>();
+}
+
+template<typename TNode>
+cslib::NodePool<TNode>* cslib::NodePool<TNode>::local() {
+    // Owns the thread's pool until the thread finishes
+    struct Holder {
+        NodePool<TNode>* pool = NodePool<TNode>::create();
+        ~Holder() { pool->release(); }
+    };
+
+    thread_local Holder holder;
+    holder.pool->retain();
+    return holder.pool;
+}
+
+template<typename TNode>
+void cslib::NodePool<TNode>::retain() {
+    this->m_owners++;
+}
+
+template<typename TNode>
+void cslib::NodePool<TNode>::release() {
+    this->m_owners--;
+    this->m_collect();
+}
+
+template<typename TNode>
+TNode* cslib::NodePool<TNode>::allocate() {
+    this->m_stats.requests++;
+    this->m_stats.live++;
+
+    // Recycle first
+    if (this->m_free != nullptr) {
+        Slot* slot = this->m_free;
+        this->m_free = slot->next;
+        this->m_stats.recycled++;
+        return reinterpret_cast<TNode*>(slot->storage);
+    }
+
+    // If the page is full go to the next one, or get a new block twice as big as the last
+    if (this->m_used == ms_slots && this->m_pagesLeft > 0) {
+        this->m_page = reinterpret_cast<Block*>(reinterpret_cast<unsigned char*>(this->m_page) + ms_pageBytes);
+        this->m_page->pool = this;
+        this->m_page->next = nullptr;
+        this->m_page->pages = 0;
+        this->m_pagesLeft--;
+        this->m_used = 0;
+    } else if (this->m_used == ms_slots) {
+        size_t pages = (this->m_blocks == nullptr) ? 1 : this->m_blocks->pages * 2;
+        if (pages > ms_pagesMax) {
+            pages = ms_pagesMax;
+        }
+
+        void* memory = nullptr;
+        try {
+            memory = ::operator new(pages * ms_pageBytes, std::align_val_t(ms_pageBytes));
+        } catch (const std::exception&) {
+            this->m_stats.requests--;
+            this->m_stats.live--;
+            throw;
+        }
+
+        Block* block = static_cast<Block*>(memory);
+        block->pool = this;
+        block->next = this->m_blocks;
+        block->pages = pages;
+        this->m_blocks = block;
+        this->m_page = block;
+        this->m_pagesLeft = pages - 1;
+        this->m_used = 0;
+        this->m_stats.blocks++;
+    }
+
+    // Bump the next slot out of the page
+    Slot* slots = reinterpret_cast<Slot*>(reinterpret_cast<unsigned char*>(this->m_page) + ms_offset);
+    Slot* slot = slots + this->m_used;
+    this->m_used++;
+    return reinterpret_cast<TNode*>(slot->storage);
+}
+
+template<typename TNode>
+void cslib::NodePool<TNode>::deallocate(TNode* p_node) {
+    // The page header tells us which pool the node came from
+    uintptr_t address = reinterpret_cast<uintptr_t>(p_node);
+    Block* block = reinterpret_cast<Block*>(address & ~(uintptr_t)(ms_pageBytes - 1));
+    NodePool<TNode>* pool = block->pool;
+
+    // Push onto the free list
+    Slot* slot = reinterpret_cast<Slot*>(p_node);
+    slot->next = pool->m_free;
+    pool->m_free = slot;
+    pool->m_stats.live--;
+
+    pool->m_collect();
+}
+
+template<typename TNode>
+const cslib::NodePoolStats& cslib::NodePool<TNode>::stats() const {
+    return this->m_stats;
+}
+
+template<typename TNode>
+void cslib::NodePool<TNode>::m_collect() {
+    // Only once nothing can reach the memory
+    if (this->m_owners == 0 && this->m_stats.live == 0) {
+        delete this;
+    }
+}
+
+#endif
@@ -0,0 +1,467 @@
+/**
+ * @file PairingHeap.h
+ * @brief Holds the PairingHeap, a node based heap with cheap melds and decrease key.
+ **/
+#ifndef CSPAIRINGHEAP_H
+#define CSPAIRINGHEAP_H
+
+#include "Universal.h"
+#include "NodePool.h"
+#include "PriorityQueue.h"
+#include "Stack.h"
+
+#include <functional>
+#include <utility>
+
+namespace cslib {
+    /**
+     * @class PairingHeap
+     * @tparam T Type of the data structure.
+     * @tparam Compare Orders the values, the top is the value that orders first, the smallest by default.
+     * @brief A heap ordered tree of any shape, pairing roots back up when the top is popped.
+     *
+     * Push, meld and decreaseKey only link two trees, the one that orders after becomes the first
+     * child of the other, so they're O(1). Pop takes the root off and pairs its children left to
+     * right, then folds the pairs right to left, which is O(log n) amortized.
+     *
+     * Every node has its first child, its next sibling and a back pointer to the node before it,
+     * the parent for a first child, so any node can be cut out in O(1). Nodes come from a NodePool.
+     **/
+    template<typename T, typename Compare = std::less<T>>
+    class PairingHeap {
+    protected:
+        /**
+         * @structure Node
+         * @brief A value in the heap
+         **/
+        struct Node {
+            /// Actual data.
+            T data;
+            /// The first child
+            Node* child;
+            /// The next sibling
+            Node* next;
+            /// The sibling before, or the parent for a first child
+            Node* prev;
+        };
+
+    public:
+        /// Names a value in the heap, valid until it leaves
+        typedef Node* Handle;
+
+        /**
+         * @param p_compare Orders the values
+         *
+         * @brief Constructs an empty heap
+         */
+        explicit PairingHeap(const Compare& p_compare = Compare());
+
+        /**
+         * @brief Copies the values of the heap, handles into it don't carry over
+         */
+        PairingHeap(const PairingHeap<T, Compare>& p_heap);
+
+        /**
+         * @brief Copies the values of the heap, handles into it don't carry over
+         * @return Returns "this" data structure
+         */
+        PairingHeap<T, Compare>& operator= (const PairingHeap<T, Compare>& p_heap);
+
+        /**
+         * @brief Destroys the heap
+         */
+        ~PairingHeap();
+
+        /**
+         * @brief Gets the amount of values
+         * @return Returns the amount of values
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if the data structure is empty
+         * @return Returns true if empty, false if not.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Gets the value that orders first
+         * @return Returns the top value
+         */
+        const T& top() const;
+
+        /**
+         * @param p_handle The handle
+         *
+         * @brief Gets the value of a handle
+         * @return Returns the value
+         */
+        const T& get(Handle p_handle) const;
+
+        /**
+         * @param p_data The value we're adding
+         *
+         * @brief Adds the value, O(1)
+         * @return Returns the handle of the value
+         */
+        Handle push(const T& p_data);
+
+        /**
+         * @brief Takes the top value off, O(log n) amortized
+         * @return Returns the value that was on top
+         */
+        T pop();
+
+        /**
+         * @param p_handle The handle of the value
+         * @param p_data The new value, it can't order after the old one
+         *
+         * @brief Changes the value and cuts it up to the root, O(1)
+         */
+        void decreaseKey(Handle p_handle, const T& p_data);
+
+        /**
+         * @param p_handle The handle of the value
+         *
+         * @brief Removes the value, O(log n) amortized
+         * @return Returns the value that was removed
+         */
+        T erase(Handle p_handle);
+
+        /**
+         * @param p_heap The heap whose values we take, left empty
+         *
+         * @brief Moves every value of the other heap into this one, O(1). Its handles stay valid here
+         */
+        void meld(PairingHeap<T, Compare>& p_heap);
+
+        /**
+         * @brief Removes every value
+         */
+        void clear();
+
+    protected:
+        /**
+         * @param p_data The data we're copying
+         *
+         * @brief Creates the node
+         * @return Returns the new node
+         */
+        Node* m_create(const T& p_data);
+
+        /**
+         * @param p_node The node we're destroying
+         *
+         * @brief Destroys the node and gives it back to its pool
+         */
+        void m_destroy(Node* p_node);
+
+        /**
+         * @param p_heap The heap we're copying
+         *
+         * @brief Pushes every value of the heap into this one
+         */
+        void m_copy(const PairingHeap<T, Compare>& p_heap);
+
+        /**
+         * @param p_left A root
+         * @param p_right Another root
+         *
+         * @brief Makes the root that orders after the first child of the other
+         * @return Returns the root that's left
+         */
+        Node* m_link(Node* p_left, Node* p_right);
+
+        /**
+         * @param p_node A node that isn't the root
+         *
+         * @brief Cuts the node and its children out of its parent
+         */
+        void m_cut(Node* p_node);
+
+        /**
+         * @param p_first The first of the siblings
+         *
+         * @brief Pairs the siblings left to right, then folds the pairs right to left
+         * @return Returns the root of the one tree left, nullptr if there were no siblings
+         */
+        Node* m_pair(Node* p_first);
+
+        /// The root, the value that orders first
+        Node* m_root;
+
+        /// The amount of values
+        size_t m_size;
+
+        /// Orders the values
+        Compare m_compare;
+
+        /// Where new nodes come from, made when the first node is
+        NodePool<Node>* m_pool;
+    };
+}
+
+template<typename T, typename Compare>
+cslib::PairingHeap<T, Compare>::PairingHeap(const Compare& p_compare) : m_root(nullptr), m_size(0), m_compare(p_compare), m_pool(nullptr) {
+
+}
+
+template<typename T, typename Compare>
+cslib::PairingHeap<T, Compare>::PairingHeap(const PairingHeap<T, Compare>& p_heap) : m_root(nullptr), m_size(0), m_compare(p_heap.m_compare), m_pool(nullptr) {
+    this->m_copy(p_heap);
+}
+
+template<typename T, typename Compare>
+cslib::PairingHeap<T, Compare>& cslib::PairingHeap<T, Compare>::operator= (const PairingHeap<T, Compare>& p_heap) {
+    if (this != &p_heap) {
+        this->clear();
+        this->m_compare = p_heap.m_compare;
+        this->m_copy(p_heap);
+    }
+    return *this;
+}
+
+template<typename T, typename Compare>
+cslib::PairingHeap<T, Compare>::~PairingHeap() {
+    // Delete all and let go of the pool
+    this->clear();
+    if (this->m_pool != nullptr) {
+        this->m_pool->release();
+    }
+}
+
+template<typename T, typename Compare>
+size_t cslib::PairingHeap<T, Compare>::size() const {
+    return this->m_size;
+}
+
+template<typename T, typename Compare>
+bool cslib::PairingHeap<T, Compare>::empty() const {
+    return (this->m_root == nullptr);
+}
+
+template<typename T, typename Compare>
+const T& cslib::PairingHeap<T, Compare>::top() const {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_root->data;
+}
+
+template<typename T, typename Compare>
+const T& cslib::PairingHeap<T, Compare>::get(Handle p_handle) const {
+    return p_handle->data;
+}
+
+template<typename T, typename Compare>
+typename cslib::PairingHeap<T, Compare>::Handle cslib::PairingHeap<T, Compare>::push(const T& p_data) {
+    Node* node = this->m_create(p_data);
+    this->m_root = (this->m_root == nullptr) ? node : this->m_link(this->m_root, node);
+    this->m_size++;
+    return node;
+}
+
+template<typename T, typename Compare>
+T cslib::PairingHeap<T, Compare>::pop() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+
+    Node* root = this->m_root;
+    T data = std::move(root->data);
+
+    this->m_root = this->m_pair(root->child);
+    this->m_size--;
+    this->m_destroy(root);
+    return data;
+}
+
+template<typename T, typename Compare>
+void cslib::PairingHeap<T, Compare>::decreaseKey(Handle p_handle, const T& p_data) {
+    if (this->m_compare(p_handle->data, p_data)) {
+        throw PriorityQueueKeyIncreased();
+    }
+    p_handle->data = p_data;
+
+    // Cut it out with its children and link it back at the top
+    if (p_handle != this->m_root) {
+        this->m_cut(p_handle);
+        this->m_root = this->m_link(this->m_root, p_handle);
+    }
+}
+
+template<typename T, typename Compare>
+T cslib::PairingHeap<T, Compare>::erase(Handle p_handle) {
+    if (p_handle == this->m_root) {
+        return this->pop();
+    }
+
+    T data = std::move(p_handle->data);
+
+    // Its children pair up into one tree, which goes back under the root
+    this->m_cut(p_handle);
+    Node* children = this->m_pair(p_handle->child);
+    if (children != nullptr) {
+        this->m_root = this->m_link(this->m_root, children);
+    }
+
+    this->m_size--;
+    this->m_destroy(p_handle);
+    return data;
+}
+
+template<typename T, typename Compare>
+void cslib::PairingHeap<T, Compare>::meld(PairingHeap<T, Compare>& p_heap) {
+    if (this == &p_heap || p_heap.m_root == nullptr) {
+        return;
+    }
+
+    // Nodes go back to the pool they came from, wherever they end up
+    this->m_root = (this->m_root == nullptr) ? p_heap.m_root : this->m_link(this->m_root, p_heap.m_root);
+    this->m_size += p_heap.m_size;
+
+    p_heap.m_root = nullptr;
+    p_heap.m_size = 0;
+}
+
+template<typename T, typename Compare>
+void cslib::PairingHeap<T, Compare>::clear() {
+    // Walk it as a list, splicing every child list in after the node
+    Node* node = this->m_root;
+    while (node != nullptr) {
+        if (node->child != nullptr) {
+            Node* last = node->child;
+            while (last->next != nullptr) {
+                last = last->next;
+            }
+            last->next = node->next;
+            node->next = node->child;
+        }
+
+        Node* next = node->next;
+        this->m_destroy(node);
+        node = next;
+    }
+
+    this->m_root = nullptr;
+    this->m_size = 0;
+}
+
+template<typename T, typename Compare>
+typename cslib::PairingHeap<T, Compare>::Node* cslib::PairingHeap<T, Compare>::m_create(const T& p_data) {
+    // Get the pool the first time we need it
+    if (this->m_pool == nullptr) {
+        this->m_pool = NodePool<Node>::create();
+    }
+
+    Node* memory = this->m_pool->allocate();
+    try {
+        return new (memory) Node{ p_data, nullptr, nullptr, nullptr };
+    } catch (...) {
+        NodePool<Node>::deallocate(memory);
+        throw;
+    }
+}
+
+template<typename T, typename Compare>
+void cslib::PairingHeap<T, Compare>::m_destroy(Node* p_node) {
+    p_node->~Node();
+    NodePool<Node>::deallocate(p_node);
+}
+
+template<typename T, typename Compare>
+void cslib::PairingHeap<T, Compare>::m_copy(const PairingHeap<T, Compare>& p_heap) {
+    if (p_heap.m_root == nullptr) {
+        return;
+    }
+
+    // Any order will do, pushes are O(1)
+    Stack<const Node*, ArrayStack<const Node*>> nodes;
+    nodes.push(p_heap.m_root);
+    while (!nodes.empty()) {
+        const Node* node = nodes.pop();
+        this->push(node->data);
+
+        for (const Node* child = node->child; child != nullptr; child = child->next) {
+            nodes.push(child);
+        }
+    }
+}
+
+template<typename T, typename Compare>
+typename cslib::PairingHeap<T, Compare>::Node* cslib::PairingHeap<T, Compare>::m_link(Node* p_left, Node* p_right) {
+    Node* parent = p_left;
+    Node* child = p_right;
+    if (this->m_compare(p_right->data, p_left->data)) {
+        parent = p_right;
+        child = p_left;
+    }
+
+    // The child goes to the front of the parent's children
+    child->prev = parent;
+    child->next = parent->child;
+    if (parent->child != nullptr) {
+        parent->child->prev = child;
+    }
+    parent->child = child;
+
+    parent->prev = nullptr;
+    parent->next = nullptr;
+    return parent;
+}
+
+template<typename T, typename Compare>
+void cslib::PairingHeap<T, Compare>::m_cut(Node* p_node) {
+    // A first child hangs off its parent, the rest off their sibling
+    if (p_node->prev->child == p_node) {
+        p_node->prev->child = p_node->next;
+    } else {
+        p_node->prev->next = p_node->next;
+    }
+    if (p_node->next != nullptr) {
+        p_node->next->prev = p_node->prev;
+    }
+
+    p_node->prev = nullptr;
+    p_node->next = nullptr;
+}
+
+template<typename T, typename Compare>
+typename cslib::PairingHeap<T, Compare>::Node* cslib::PairingHeap<T, Compare>::m_pair(Node* p_first) {
+    if (p_first == nullptr) {
+        return nullptr;
+    }
+
+    // Left to right, link neighbours, keeping the pairs backwards through next
+    Node* pairs = nullptr;
+    Node* node = p_first;
+    while (node != nullptr) {
+        Node* second = node->next;
+        if (second == nullptr) {
+            node->prev = nullptr;
+            node->next = pairs;
+            pairs = node;
+            break;
+        }
+
+        Node* after = second->next;
+        Node* pair = this->m_link(node, second);
+        pair->next = pairs;
+        pairs = pair;
+        node = after;
+    }
+
+    // Right to left, fold every pair into the last one
+    Node* root = pairs;
+    pairs = pairs->next;
+    root->next = nullptr;
+    while (pairs != nullptr) {
+        Node* next = pairs->next;
+        root = this->m_link(root, pairs);
+        pairs = next;
+    }
+    return root;
+}
+
+
+#endif
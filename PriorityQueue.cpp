@@ -0,0 +1,5 @@
+#include "PriorityQueue.h"
+
+const char* cslib::PriorityQueueKeyIncreased::what() const throw() {
+    return "Priority Queue key was increased by decreaseKey!";
+}
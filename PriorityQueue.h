@@ -0,0 +1,737 @@
+/**
+ * @file PriorityQueue.h
+ * @brief Holds the PriorityQueue and IndexedPriorityQueue, implicit d-ary heaps kept in a Vector.
+ **/
+#ifndef CSPRIORITYQUEUE_H
+#define CSPRIORITYQUEUE_H
+
+#include "Universal.h"
+#include "Vector.h"
+
+#include <functional>
+#include <utility>
+
+/// Where a handle points when its value isn't in the queue.
+#define PRIORITYQUEUE_NOT_QUEUED ((size_t)-1)
+
+namespace cslib {
+    /**
+     * @class PriorityQueueKeyIncreased
+     * @brief Thrown when decreaseKey is given a value that orders after the old one
+     **/
+    class PriorityQueueKeyIncreased : public Exception {
+    public:
+        const char* what() const throw();
+    };
+
+    /**
+     * @class PriorityQueue
+     * @tparam T Type of the data structure.
+     * @tparam Compare Orders the values, the top is the value that orders first, the smallest by default.
+     * @tparam D How many children every value has, at least 2.
+     * @brief An implicit d-ary heap kept in one Vector.
+     *
+     * The children of index i are at D * i + 1 through D * i + D. A wider heap is shallower, so
+     * push looks at fewer levels, and the children pop compares sit next to each other in memory.
+     * Four children tends to beat two once the heap doesn't fit in cache.
+     **/
+    template<typename T, typename Compare = std::less<T>, size_t D = 4>
+    class PriorityQueue {
+        static_assert(D >= 2, "A heap needs at least two children per value");
+
+    public:
+        /**
+         * @param p_compare Orders the values
+         *
+         * @brief Constructs an empty queue
+         */
+        explicit PriorityQueue(const Compare& p_compare = Compare());
+
+        /**
+         * @param p_values The values we start with
+         * @param p_compare Orders the values
+         *
+         * @brief Builds the heap from the values in O(n)
+         */
+        explicit PriorityQueue(const Vector<T>& p_values, const Compare& p_compare = Compare());
+
+        /**
+         * @brief Gets the amount of values
+         * @return Returns the amount of values
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if the data structure is empty
+         * @return Returns true if empty, false if not.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Gets the value that orders first
+         * @return Returns the top value
+         */
+        const T& top() const;
+
+        /**
+         * @param p_data The value we're adding
+         *
+         * @brief Adds the value, O(log n)
+         */
+        void push(const T& p_data);
+
+        /**
+         * @param p_data The values we're adding
+         * @param p_count How many values
+         *
+         * @brief Adds all the values, rebuilding the heap instead when that's cheaper
+         */
+        void pushMany(const T* p_data, size_t p_count);
+
+        /**
+         * @brief Takes the top value off, O(D log n)
+         * @return Returns the value that was on top
+         */
+        T pop();
+
+        /**
+         * @param p_size The amount of values we want room for
+         *
+         * @brief Makes room so the queue can hold that many values without allocating
+         */
+        void reserve(size_t p_size);
+
+        /**
+         * @brief Removes every value
+         */
+        void clear();
+
+    protected:
+        /**
+         * @brief Orders every value, bottom up
+         */
+        void m_heapify();
+
+        /**
+         * @param p_index Where the value is
+         *
+         * @brief Moves the value up until its parent orders before it
+         */
+        void m_siftUp(size_t p_index);
+
+        /**
+         * @param p_index Where the value is
+         *
+         * @brief Moves the value down until its children order after it
+         */
+        void m_siftDown(size_t p_index);
+
+        /// The heap
+        Vector<T> m_heap;
+
+        /// Orders the values
+        Compare m_compare;
+    };
+
+    /**
+     * @class IndexedPriorityQueue
+     * @tparam T Type of the data structure.
+     * @tparam Compare Orders the values, the top is the value that orders first, the smallest by default.
+     * @tparam D How many children every value has, at least 2.
+     * @brief A d-ary heap that hands out a handle for every value, so it can be changed or removed later.
+     *
+     * Every handle knows where its value is in the heap, and the heap moves keep that up to date.
+     * Handles of values that left are reused by later pushes.
+     **/
+    template<typename T, typename Compare = std::less<T>, size_t D = 4>
+    class IndexedPriorityQueue {
+        static_assert(D >= 2, "A heap needs at least two children per value");
+
+    public:
+        /// Names a value in the queue
+        typedef size_t Handle;
+
+        /**
+         * @param p_compare Orders the values
+         *
+         * @brief Constructs an empty queue
+         */
+        explicit IndexedPriorityQueue(const Compare& p_compare = Compare());
+
+        /**
+         * @param p_values The values we start with, the value at index i gets handle i
+         * @param p_compare Orders the values
+         *
+         * @brief Builds the heap from the values in O(n)
+         */
+        explicit IndexedPriorityQueue(const Vector<T>& p_values, const Compare& p_compare = Compare());
+
+        /**
+         * @brief Gets the amount of values
+         * @return Returns the amount of values
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if the data structure is empty
+         * @return Returns true if empty, false if not.
+         */
+        bool empty() const;
+
+        /**
+         * @param p_handle The handle
+         *
+         * @brief Returns true if the handle's value is still in the queue
+         * @return Returns true if it is, false if not
+         */
+        bool contains(Handle p_handle) const;
+
+        /**
+         * @brief Gets the value that orders first
+         * @return Returns the top value
+         */
+        const T& top() const;
+
+        /**
+         * @brief Gets the handle of the value that orders first
+         * @return Returns the top value's handle
+         */
+        Handle topHandle() const;
+
+        /**
+         * @param p_handle The handle
+         *
+         * @brief Gets the value of a handle
+         * @return Returns the value
+         */
+        const T& get(Handle p_handle) const;
+
+        /**
+         * @param p_data The value we're adding
+         *
+         * @brief Adds the value, O(log n)
+         * @return Returns the handle of the value
+         */
+        Handle push(const T& p_data);
+
+        /**
+         * @param p_data The values we're adding
+         * @param p_count How many values
+         * @param p_handles Gets the handle of every value, can be nullptr
+         *
+         * @brief Adds all the values, rebuilding the heap instead when that's cheaper
+         */
+        void pushMany(const T* p_data, size_t p_count, Handle* p_handles = nullptr);
+
+        /**
+         * @brief Takes the top value off, O(D log n)
+         * @return Returns the value that was on top
+         */
+        T pop();
+
+        /**
+         * @param p_handle The handle of the value
+         * @param p_data The new value, it can't order after the old one
+         *
+         * @brief Changes the value and moves it up, O(log n)
+         */
+        void decreaseKey(Handle p_handle, const T& p_data);
+
+        /**
+         * @param p_handle The handle of the value
+         * @param p_data The new value
+         *
+         * @brief Changes the value, moving it whichever way it needs to go
+         */
+        void update(Handle p_handle, const T& p_data);
+
+        /**
+         * @param p_handle The handle of the value
+         *
+         * @brief Removes the value, O(D log n)
+         * @return Returns the value that was removed
+         */
+        T erase(Handle p_handle);
+
+        /**
+         * @param p_size The amount of values we want room for
+         *
+         * @brief Makes room so the queue can hold that many values without allocating
+         */
+        void reserve(size_t p_size);
+
+        /**
+         * @brief Removes every value, every handle becomes invalid
+         */
+        void clear();
+
+    protected:
+        /**
+         * @struct Entry
+         * @brief A value in the heap and its handle
+         **/
+        struct Entry {
+            /// The value
+            T data;
+            /// Its handle
+            Handle handle;
+        };
+
+        /**
+         * @param p_handle The handle
+         *
+         * @brief Gets where a handle's value is, throws if it isn't in the queue
+         * @return Returns the index in the heap
+         */
+        size_t m_position(Handle p_handle) const;
+
+        /**
+         * @brief Gets a handle for a new value
+         * @return Returns the handle
+         */
+        Handle m_handle();
+
+        /**
+         * @param p_index Where the value we're removing is
+         *
+         * @brief Takes a value out of the heap and frees its handle
+         * @return Returns the value
+         */
+        T m_remove(size_t p_index);
+
+        /**
+         * @param p_index Where to put it
+         * @param p_entry What to put there
+         *
+         * @brief Puts the entry in the heap and tells its handle
+         */
+        void m_place(size_t p_index, const Entry& p_entry);
+
+        /**
+         * @brief Orders every value, bottom up
+         */
+        void m_heapify();
+
+        /**
+         * @param p_index Where the value is
+         *
+         * @brief Moves the value up until its parent orders before it
+         */
+        void m_siftUp(size_t p_index);
+
+        /**
+         * @param p_index Where the value is
+         *
+         * @brief Moves the value down until its children order after it
+         */
+        void m_siftDown(size_t p_index);
+
+        /// The heap
+        Vector<Entry> m_heap;
+
+        /// Where the value of every handle is, PRIORITYQUEUE_NOT_QUEUED if it left
+        Vector<size_t> m_positions;
+
+        /// Handles that can be reused
+        Vector<Handle> m_free;
+
+        /// Orders the values
+        Compare m_compare;
+    };
+}
+
+template<typename T, typename Compare, size_t D>
+cslib::PriorityQueue<T, Compare, D>::PriorityQueue(const Compare& p_compare) : m_heap(), m_compare(p_compare) {
+
+}
+
+template<typename T, typename Compare, size_t D>
+cslib::PriorityQueue<T, Compare, D>::PriorityQueue(const Vector<T>& p_values, const Compare& p_compare) : m_heap(p_values), m_compare(p_compare) {
+    this->m_heapify();
+}
+
+template<typename T, typename Compare, size_t D>
+size_t cslib::PriorityQueue<T, Compare, D>::size() const {
+    return this->m_heap.size();
+}
+
+template<typename T, typename Compare, size_t D>
+bool cslib::PriorityQueue<T, Compare, D>::empty() const {
+    return (this->m_heap.size() == 0);
+}
+
+template<typename T, typename Compare, size_t D>
+const T& cslib::PriorityQueue<T, Compare, D>::top() const {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_heap[0];
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::PriorityQueue<T, Compare, D>::push(const T& p_data) {
+    this->m_heap.push(p_data);
+    this->m_siftUp(this->m_heap.size() - 1);
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::PriorityQueue<T, Compare, D>::pushMany(const T* p_data, size_t p_count) {
+    size_t size = this->m_heap.size();
+    this->m_heap.reserve(size + p_count);
+    for (size_t i = 0; i < p_count; i++) {
+        this->m_heap.push(p_data[i]);
+    }
+
+    // Sifting each up costs k log n, rebuilding costs n
+    if (p_count * 4 >= size) {
+        this->m_heapify();
+        return;
+    }
+    for (size_t i = size; i < size + p_count; i++) {
+        this->m_siftUp(i);
+    }
+}
+
+template<typename T, typename Compare, size_t D>
+T cslib::PriorityQueue<T, Compare, D>::pop() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+
+    T top = std::move(this->m_heap[0]);
+
+    // The last value fills the hole and sinks
+    size_t last = this->m_heap.size() - 1;
+    if (last > 0) {
+        this->m_heap[0] = std::move(this->m_heap[last]);
+    }
+    this->m_heap.resize(last);
+    if (last > 1) {
+        this->m_siftDown(0);
+    }
+    return top;
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::PriorityQueue<T, Compare, D>::reserve(size_t p_size) {
+    this->m_heap.reserve(p_size);
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::PriorityQueue<T, Compare, D>::clear() {
+    this->m_heap.resize(0);
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::PriorityQueue<T, Compare, D>::m_heapify() {
+    size_t size = this->m_heap.size();
+    if (size < 2) {
+        return;
+    }
+
+    // Every parent, last one first
+    for (size_t i = (size - 2) / D + 1; i > 0; i--) {
+        this->m_siftDown(i - 1);
+    }
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::PriorityQueue<T, Compare, D>::m_siftUp(size_t p_index) {
+    // Move parents down into the hole rather than swapping
+    T value = std::move(this->m_heap[p_index]);
+    while (p_index > 0) {
+        size_t parent = (p_index - 1) / D;
+        if (!this->m_compare(value, this->m_heap[parent])) {
+            break;
+        }
+        this->m_heap[p_index] = std::move(this->m_heap[parent]);
+        p_index = parent;
+    }
+    this->m_heap[p_index] = std::move(value);
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::PriorityQueue<T, Compare, D>::m_siftDown(size_t p_index) {
+    size_t size = this->m_heap.size();
+    T value = std::move(this->m_heap[p_index]);
+
+    while (true) {
+        size_t first = D * p_index + 1;
+        if (first >= size) {
+            break;
+        }
+
+        // The child that orders first
+        size_t last = (first + D < size) ? first + D : size;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++) {
+            if (this->m_compare(this->m_heap[child], this->m_heap[best])) {
+                best = child;
+            }
+        }
+
+        if (!this->m_compare(this->m_heap[best], value)) {
+            break;
+        }
+        this->m_heap[p_index] = std::move(this->m_heap[best]);
+        p_index = best;
+    }
+    this->m_heap[p_index] = std::move(value);
+}
+
+
+
+
+
+
+
+
+
+
+
+template<typename T, typename Compare, size_t D>
+cslib::IndexedPriorityQueue<T, Compare, D>::IndexedPriorityQueue(const Compare& p_compare) : m_heap(), m_positions(), m_free(), m_compare(p_compare) {
+
+}
+
+template<typename T, typename Compare, size_t D>
+cslib::IndexedPriorityQueue<T, Compare, D>::IndexedPriorityQueue(const Vector<T>& p_values, const Compare& p_compare) : m_heap(), m_positions(), m_free(), m_compare(p_compare) {
+    size_t size = p_values.size();
+    this->m_heap.reserve(size);
+    this->m_positions.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+        this->m_heap.push(Entry{ p_values[i], i });
+        this->m_positions.push(i);
+    }
+    this->m_heapify();
+}
+
+template<typename T, typename Compare, size_t D>
+size_t cslib::IndexedPriorityQueue<T, Compare, D>::size() const {
+    return this->m_heap.size();
+}
+
+template<typename T, typename Compare, size_t D>
+bool cslib::IndexedPriorityQueue<T, Compare, D>::empty() const {
+    return (this->m_heap.size() == 0);
+}
+
+template<typename T, typename Compare, size_t D>
+bool cslib::IndexedPriorityQueue<T, Compare, D>::contains(Handle p_handle) const {
+    return (p_handle < this->m_positions.size() && this->m_positions[p_handle] != PRIORITYQUEUE_NOT_QUEUED);
+}
+
+template<typename T, typename Compare, size_t D>
+const T& cslib::IndexedPriorityQueue<T, Compare, D>::top() const {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_heap[0].data;
+}
+
+template<typename T, typename Compare, size_t D>
+typename cslib::IndexedPriorityQueue<T, Compare, D>::Handle cslib::IndexedPriorityQueue<T, Compare, D>::topHandle() const {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_heap[0].handle;
+}
+
+template<typename T, typename Compare, size_t D>
+const T& cslib::IndexedPriorityQueue<T, Compare, D>::get(Handle p_handle) const {
+    return this->m_heap[this->m_position(p_handle)].data;
+}
+
+template<typename T, typename Compare, size_t D>
+typename cslib::IndexedPriorityQueue<T, Compare, D>::Handle cslib::IndexedPriorityQueue<T, Compare, D>::push(const T& p_data) {
+    Handle handle = this->m_handle();
+    size_t index = this->m_heap.size();
+    this->m_heap.push(Entry{ p_data, handle });
+    this->m_positions[handle] = index;
+    this->m_siftUp(index);
+    return handle;
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::IndexedPriorityQueue<T, Compare, D>::pushMany(const T* p_data, size_t p_count, Handle* p_handles) {
+    size_t size = this->m_heap.size();
+    this->m_heap.reserve(size + p_count);
+    for (size_t i = 0; i < p_count; i++) {
+        Handle handle = this->m_handle();
+        this->m_heap.push(Entry{ p_data[i], handle });
+        this->m_positions[handle] = size + i;
+        if (p_handles != nullptr) {
+            p_handles[i] = handle;
+        }
+    }
+
+    // Sifting each up costs k log n, rebuilding costs n
+    if (p_count * 4 >= size) {
+        this->m_heapify();
+        return;
+    }
+    for (size_t i = size; i < size + p_count; i++) {
+        this->m_siftUp(i);
+    }
+}
+
+template<typename T, typename Compare, size_t D>
+T cslib::IndexedPriorityQueue<T, Compare, D>::pop() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_remove(0);
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::IndexedPriorityQueue<T, Compare, D>::decreaseKey(Handle p_handle, const T& p_data) {
+    size_t index = this->m_position(p_handle);
+    if (this->m_compare(this->m_heap[index].data, p_data)) {
+        throw PriorityQueueKeyIncreased();
+    }
+
+    this->m_heap[index].data = p_data;
+    this->m_siftUp(index);
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::IndexedPriorityQueue<T, Compare, D>::update(Handle p_handle, const T& p_data) {
+    size_t index = this->m_position(p_handle);
+    bool down = this->m_compare(this->m_heap[index].data, p_data);
+
+    this->m_heap[index].data = p_data;
+    if (down) {
+        this->m_siftDown(index);
+    } else {
+        this->m_siftUp(index);
+    }
+}
+
+template<typename T, typename Compare, size_t D>
+T cslib::IndexedPriorityQueue<T, Compare, D>::erase(Handle p_handle) {
+    return this->m_remove(this->m_position(p_handle));
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::IndexedPriorityQueue<T, Compare, D>::reserve(size_t p_size) {
+    this->m_heap.reserve(p_size);
+    this->m_positions.reserve(p_size);
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::IndexedPriorityQueue<T, Compare, D>::clear() {
+    this->m_heap.resize(0);
+    this->m_positions.resize(0);
+    this->m_free.resize(0);
+}
+
+template<typename T, typename Compare, size_t D>
+size_t cslib::IndexedPriorityQueue<T, Compare, D>::m_position(Handle p_handle) const {
+    if (!this->contains(p_handle)) {
+        throw OutOfRange();
+    }
+    return this->m_positions[p_handle];
+}
+
+template<typename T, typename Compare, size_t D>
+typename cslib::IndexedPriorityQueue<T, Compare, D>::Handle cslib::IndexedPriorityQueue<T, Compare, D>::m_handle() {
+    size_t free = this->m_free.size();
+    if (free > 0) {
+        Handle handle = this->m_free[free - 1];
+        this->m_free.resize(free - 1);
+        return handle;
+    }
+
+    this->m_positions.push(PRIORITYQUEUE_NOT_QUEUED);
+    return this->m_positions.size() - 1;
+}
+
+template<typename T, typename Compare, size_t D>
+T cslib::IndexedPriorityQueue<T, Compare, D>::m_remove(size_t p_index) {
+    Handle handle = this->m_heap[p_index].handle;
+    T data = std::move(this->m_heap[p_index].data);
+
+    this->m_positions[handle] = PRIORITYQUEUE_NOT_QUEUED;
+    this->m_free.push(handle);
+
+    // The last value fills the hole, then goes whichever way it needs to
+    size_t last = this->m_heap.size() - 1;
+    if (p_index == last) {
+        this->m_heap.resize(last);
+        return data;
+    }
+
+    Entry moved = std::move(this->m_heap[last]);
+    this->m_heap.resize(last);
+    bool up = (p_index > 0 && this->m_compare(moved.data, this->m_heap[(p_index - 1) / D].data));
+    this->m_place(p_index, moved);
+    if (up) {
+        this->m_siftUp(p_index);
+    } else {
+        this->m_siftDown(p_index);
+    }
+    return data;
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::IndexedPriorityQueue<T, Compare, D>::m_place(size_t p_index, const Entry& p_entry) {
+    this->m_heap[p_index] = p_entry;
+    this->m_positions[p_entry.handle] = p_index;
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::IndexedPriorityQueue<T, Compare, D>::m_heapify() {
+    size_t size = this->m_heap.size();
+    if (size < 2) {
+        return;
+    }
+
+    for (size_t i = (size - 2) / D + 1; i > 0; i--) {
+        this->m_siftDown(i - 1);
+    }
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::IndexedPriorityQueue<T, Compare, D>::m_siftUp(size_t p_index) {
+    Entry entry = std::move(this->m_heap[p_index]);
+    while (p_index > 0) {
+        size_t parent = (p_index - 1) / D;
+        if (!this->m_compare(entry.data, this->m_heap[parent].data)) {
+            break;
+        }
+        this->m_place(p_index, this->m_heap[parent]);
+        p_index = parent;
+    }
+    this->m_place(p_index, entry);
+}
+
+template<typename T, typename Compare, size_t D>
+void cslib::IndexedPriorityQueue<T, Compare, D>::m_siftDown(size_t p_index) {
+    size_t size = this->m_heap.size();
+    Entry entry = std::move(this->m_heap[p_index]);
+
+    while (true) {
+        size_t first = D * p_index + 1;
+        if (first >= size) {
+            break;
+        }
+
+        size_t last = (first + D < size) ? first + D : size;
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++) {
+            if (this->m_compare(this->m_heap[child].data, this->m_heap[best].data)) {
+                best = child;
+            }
+        }
+
+        if (!this->m_compare(this->m_heap[best].data, entry.data)) {
+            break;
+        }
+        this->m_place(p_index, this->m_heap[best]);
+        p_index = best;
+    }
+    this->m_place(p_index, entry);
+}
+
+
+#endif
@@ -7,6 +7,9 @@
 #define CSQUEUE_H
 
 #include "LinkedList.h"
+#include "RingBuffer.h"
+
+#include <type_traits>
 
 namespace cslib {
 
@@ -14,10 +17,16 @@ namespace cslib {
     /**
      * @class Queue
      * @tparam T Type of the data structure.
+     * @tparam TContainer What holds the values, LinkedList<T> or RingBuffer<T>.
      * @brief A First-in-first out data structure.
+     *
+     * The default keeps a node per value. Queue<T, RingBuffer<T>> keeps the values in one array
+     * that wraps around instead, which is what breadth first walks want.
      **/
-    template<typename T>
+    template<typename T, typename TContainer = LinkedList<T>>
     class Queue : private LinkedList<T> {
+        static_assert(std::is_same<TContainer, LinkedList<T>>::value, "Queue is held by LinkedList<T> or RingBuffer<T>");
+
     public:
         /**
          * @brief Constructs the data structure.
@@ -94,37 +103,132 @@ namespace cslib {
     private:
         typedef LinkedList<T>::Node Node;
     };
+
+    /**
+     * @class Queue
+     * @tparam T Type of the data structure.
+     * @brief A First-in-first out data structure kept in a ring buffer, enqueueing doesn't allocate per value.
+     **/
+    template<typename T>
+    class Queue<T, RingBuffer<T>> : private RingBuffer<T> {
+    public:
+        /**
+         * @brief Constructs the data structure.
+         */
+        Queue();
+
+        /**
+         * @brief Gives the size of the queue, O(1).
+         * @return Size of the queue.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if the data structure is empty
+         * @return Returns true if empty, false if not.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Gets the front value, the first put in.
+         * @return Returns the next value that is to go.
+         */
+        T& front();
+
+        /**
+         * @brief Gets the front value, the first put in.
+         * @return Returns the next value that is to go.
+         */
+        const T& front() const;
+
+        /**
+         * @param p_data The data that we are putting to the back of the queue.
+         *
+         * @brief Adds value to back of queue.
+         * @return Returns the value that was just placed in.
+         */
+        T& enqueue(const T& p_data);
+
+        /**
+         * @brief Pops the front of the queue, next value is now the value placed after "this" value.
+         * @return Returns the value that just got dequeued.
+         */
+        T  dequeue();
+
+        /**
+         * @param p_size The amount of values we want room for
+         *
+         * @brief Makes room so the queue can hold that many values without allocating
+         */
+        void reserve(size_t p_size);
+
+        /**
+         * @param p_data The values, the first one is dequeued first
+         * @param p_count How many values
+         *
+         * @brief Enqueues all the values with at most one allocation
+         */
+        void enqueueMany(const T* p_data, size_t p_count);
+
+        /**
+         * @param p_data Gets the values in the order they were dequeued
+         * @param p_count The most values we want
+         *
+         * @brief Dequeues values until there are none or we have enough
+         * @return Returns how many were dequeued
+         */
+        size_t dequeueMany(T* p_data, size_t p_count);
+
+        /// The iterator type in the Queue
+        typedef typename RingBuffer<T>::Iterator Iterator;
+
+        /// The const iterator type in the Queue
+        typedef typename RingBuffer<T>::ConstIterator ConstIterator;
+
+        /**
+         * @brief Gets the top value of the queue by iterator.
+         * @return Iterator representing top of the queue
+         */
+        Iterator begin();
+
+        /**
+         * @brief Gets the top value of the queue by iterator.
+         * @return Iterator representing top of the queue
+         */
+        ConstIterator cbegin() const;
+
+        /**
+         * @brief Gets the value right after the end of the queue by iterator.
+         * @return Iterator representing past the back of the queue
+         */
+        Iterator end();
+
+        /**
+         * @brief Gets the value right after the end of the queue by iterator.
+         * @return Iterator representing past the back of the queue
+         */
+        ConstIterator cend() const;
+    };
 }
 
-template<typename T>
-cslib::Queue<T>::Queue() : cslib::LinkedList<T>() {
+template<typename T, typename TContainer>
+cslib::Queue<T, TContainer>::Queue() : cslib::LinkedList<T>() {
 
 }
 
-template<typename T>
-size_t cslib::Queue<T>::size() const {
-    // If root was null...
-    if (this->m_data == nullptr) {
-        return 0;
-    }
-    
-    // Loop until we reach end
-    size_t i = 1;
-    Node* node = this->m_data;
-    while (node->next != nullptr) {
-        node = node->next;
-        i++;
-    }
-    return i + 1;
+template<typename T, typename TContainer>
+size_t cslib::Queue<T, TContainer>::size() const {
+    // Kept by the list
+    return cslib::LinkedList<T>::size();
 }
 
-template<typename T>
-bool cslib::Queue<T>::empty() const {
+template<typename T, typename TContainer>
+bool cslib::Queue<T, TContainer>::empty() const {
     return (this->m_data == nullptr);
 }
 
-template<typename T>
-T& cslib::Queue<T>::front() {
+template<typename T, typename TContainer>
+T& cslib::Queue<T, TContainer>::front() {
     if (this->empty()) {
         throw OutOfRange();
     }
@@ -132,8 +236,8 @@ T& cslib::Queue<T>::front() {
     return this->m_data->data;
 }
 
-template<typename T>
-const T& cslib::Queue<T>::front() const {
+template<typename T, typename TContainer>
+const T& cslib::Queue<T, TContainer>::front() const {
     if (this->empty()) {
         throw OutOfRange();
     }
@@ -141,42 +245,40 @@ const T& cslib::Queue<T>::front() const {
     return this->m_data->data;
 }
 
-template<typename T>
-T& cslib::Queue<T>::enqueue(const T& p_data) {
+template<typename T, typename TContainer>
+T& cslib::Queue<T, TContainer>::enqueue(const T& p_data) {
     // Get new data 
     return this->append(p_data);;
 }
 
-template<typename T>
-T cslib::Queue<T>::dequeue() {
-    // Get the front node.
-    Node* node = (cslib::Queue<T>::Node*)this->m_data->next;
+template<typename T, typename TContainer>
+T cslib::Queue<T, TContainer>::dequeue() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
 
-    // Delete the front
-    T temp = this->m_data->data;
-    delete this->m_data;
+    // Unlink the front, the one after becomes the new front
+    Node* node = this->m_popFront();
 
-    // Set new front
-    this->m_data = node;
-    if (this->m_data == nullptr) {
-        this->m_last = nullptr;
-    }
+    // Delete the front
+    T temp = node->data;
+    this->m_destroy(node);
 
     return temp;
 }
 
-template<typename T>
-typename cslib::Queue<T>::Iterator cslib::Queue<T>::begin() {
-    return this->begin();
+template<typename T, typename TContainer>
+typename cslib::Queue<T, TContainer>::Iterator cslib::Queue<T, TContainer>::begin() {
+    return cslib::LinkedList<T>::begin();
 }
 
-template<typename T>
-typename cslib::Queue<T>::ConstIterator cslib::Queue<T>::cbegin() const  {
-    return this->cbegin();
+template<typename T, typename TContainer>
+typename cslib::Queue<T, TContainer>::ConstIterator cslib::Queue<T, TContainer>::cbegin() const  {
+    return cslib::LinkedList<T>::cbegin();
 }
 
-template<typename T>
-typename cslib::Queue<T>::Iterator cslib::Queue<T>::end() {
+template<typename T, typename TContainer>
+typename cslib::Queue<T, TContainer>::Iterator cslib::Queue<T, TContainer>::end() {
     if (this->m_last == nullptr) {
         return Iterator(nullptr);
     }
@@ -184,8 +286,8 @@ typename cslib::Queue<T>::Iterator cslib::Queue<T>::end() {
     return Iterator(nullptr);
 }
 
-template<typename T>
-typename cslib::Queue<T>::ConstIterator cslib::Queue<T>::cend() const  {
+template<typename T, typename TContainer>
+typename cslib::Queue<T, TContainer>::ConstIterator cslib::Queue<T, TContainer>::cend() const  {
     if (this->m_last == nullptr) {
         return ConstIterator(nullptr);
     }
@@ -194,6 +296,77 @@ typename cslib::Queue<T>::ConstIterator cslib::Queue<T>::cend() const  {
 }
 
 
+template<typename T>
+cslib::Queue<T, cslib::RingBuffer<T>>::Queue() : cslib::RingBuffer<T>() {
+
+}
+
+template<typename T>
+size_t cslib::Queue<T, cslib::RingBuffer<T>>::size() const {
+    return cslib::RingBuffer<T>::size();
+}
+
+template<typename T>
+bool cslib::Queue<T, cslib::RingBuffer<T>>::empty() const {
+    return cslib::RingBuffer<T>::empty();
+}
+
+template<typename T>
+T& cslib::Queue<T, cslib::RingBuffer<T>>::front() {
+    return cslib::RingBuffer<T>::front();
+}
+
+template<typename T>
+const T& cslib::Queue<T, cslib::RingBuffer<T>>::front() const {
+    return cslib::RingBuffer<T>::front();
+}
+
+template<typename T>
+T& cslib::Queue<T, cslib::RingBuffer<T>>::enqueue(const T& p_data) {
+    return cslib::RingBuffer<T>::enqueue(p_data);
+}
+
+template<typename T>
+T cslib::Queue<T, cslib::RingBuffer<T>>::dequeue() {
+    return cslib::RingBuffer<T>::dequeue();
+}
+
+template<typename T>
+void cslib::Queue<T, cslib::RingBuffer<T>>::reserve(size_t p_size) {
+    cslib::RingBuffer<T>::reserve(p_size);
+}
+
+template<typename T>
+void cslib::Queue<T, cslib::RingBuffer<T>>::enqueueMany(const T* p_data, size_t p_count) {
+    cslib::RingBuffer<T>::enqueueMany(p_data, p_count);
+}
+
+template<typename T>
+size_t cslib::Queue<T, cslib::RingBuffer<T>>::dequeueMany(T* p_data, size_t p_count) {
+    return cslib::RingBuffer<T>::dequeueMany(p_data, p_count);
+}
+
+template<typename T>
+typename cslib::Queue<T, cslib::RingBuffer<T>>::Iterator cslib::Queue<T, cslib::RingBuffer<T>>::begin() {
+    return cslib::RingBuffer<T>::begin();
+}
+
+template<typename T>
+typename cslib::Queue<T, cslib::RingBuffer<T>>::ConstIterator cslib::Queue<T, cslib::RingBuffer<T>>::cbegin() const {
+    return cslib::RingBuffer<T>::cbegin();
+}
+
+template<typename T>
+typename cslib::Queue<T, cslib::RingBuffer<T>>::Iterator cslib::Queue<T, cslib::RingBuffer<T>>::end() {
+    return cslib::RingBuffer<T>::end();
+}
+
+template<typename T>
+typename cslib::Queue<T, cslib::RingBuffer<T>>::ConstIterator cslib::Queue<T, cslib::RingBuffer<T>>::cend() const {
+    return cslib::RingBuffer<T>::cend();
+}
+
+
 
 
 
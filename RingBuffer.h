@@ -0,0 +1,534 @@
+/**
+ * @file RingBuffer.h
+ * @brief Holds the RingBuffer, a first-in-first out structure kept in one array that wraps around.
+ **/
+#ifndef CSRINGBUFFER_H
+#define CSRINGBUFFER_H
+
+#include "Universal.h"
+
+#include <new>
+#include <utility>
+
+/// The least amount of values the buffer holds once something is put in it, a power of two.
+#define RINGBUFFER_CAPACITY_MIN 16
+
+namespace cslib {
+    /**
+     * @class RingBuffer
+     * @tparam T Type of the data structure.
+     * @brief A First-in-first out structure where values sit in one array.
+     *
+     * The capacity is always a power of two so wrapping an index is a mask. When it fills up the
+     * values are moved into an array twice as big, so enqueueing is amortized O(1).
+     **/
+    template<typename T>
+    class RingBuffer {
+    public:
+        /**
+         * @class Iterator
+         * @brief Walks the buffer from the front to the back.
+         **/
+        class Iterator : public cslib::Iterator<T> {
+        public:
+            /**
+             * @param p_data The array
+             * @param p_mask The capacity less one
+             * @param p_at Where we are, before masking
+             * @param p_end Where the values end, before masking
+             *
+             * @brief Constructs the Iterator
+             */
+            Iterator(T* p_data = nullptr, size_t p_mask = 0, size_t p_at = 0, size_t p_end = 0);
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            Iterator& operator++();
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value before moving
+             */
+            Iterator  operator++(int);
+
+        private:
+            /// The array
+            T* m_data;
+            /// The capacity less one
+            size_t m_mask;
+            /// Where we are
+            size_t m_at;
+            /// Where the values end
+            size_t m_end;
+        };
+
+        /**
+         * @class ConstIterator
+         * @brief Walks the buffer from the front to the back.
+         **/
+        class ConstIterator : public cslib::ConstIterator<T> {
+        public:
+            /**
+             * @param p_data The array
+             * @param p_mask The capacity less one
+             * @param p_at Where we are, before masking
+             * @param p_end Where the values end, before masking
+             *
+             * @brief Constructs the Iterator
+             */
+            ConstIterator(const T* p_data = nullptr, size_t p_mask = 0, size_t p_at = 0, size_t p_end = 0);
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            ConstIterator& operator++();
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value before moving
+             */
+            ConstIterator  operator++(int);
+
+        private:
+            /// The array
+            const T* m_data;
+            /// The capacity less one
+            size_t m_mask;
+            /// Where we are
+            size_t m_at;
+            /// Where the values end
+            size_t m_end;
+        };
+
+        /**
+         * @brief Constructs the class, nothing is allocated until the first enqueue
+         */
+        RingBuffer();
+
+        /**
+         * @brief Deep copies the buffer
+         */
+        RingBuffer(const RingBuffer<T>& p_buffer);
+
+        /**
+         * @brief Deep copies the buffer.
+         * @return Returns "this" data structure
+         */
+        RingBuffer<T>& operator= (const RingBuffer<T>& p_buffer);
+
+        /**
+         * @brief Destroys the class
+         */
+        ~RingBuffer();
+
+        /**
+         * @brief Gets the amount of values, O(1)
+         * @return Returns the amount of values
+         */
+        size_t size() const;
+
+        /**
+         * @brief Gets how many values fit before it has to grow
+         * @return Returns the capacity
+         */
+        size_t capacity() const;
+
+        /**
+         * @brief Returns true if the data structure is empty
+         * @return Returns true if empty, false if not.
+         */
+        bool empty() const;
+
+        /**
+         * @param p_index The index from the front
+         *
+         * @brief Gets a value by where it is in line
+         * @return Returns the value
+         */
+        T& operator[](size_t p_index);
+
+        /**
+         * @param p_index The index from the front
+         *
+         * @brief Gets a value by where it is in line
+         * @return Returns the value
+         */
+        const T& operator[](size_t p_index) const;
+
+        /**
+         * @brief Gets the front value, the first put in.
+         * @return Returns the next value that is to go.
+         */
+        T& front();
+
+        /**
+         * @brief Gets the front value, the first put in.
+         * @return Returns the next value that is to go.
+         */
+        const T& front() const;
+
+        /**
+         * @param p_data The data that we are putting to the back.
+         *
+         * @brief Adds value to the back.
+         * @return Returns the value that was just placed in.
+         */
+        T& enqueue(const T& p_data);
+
+        /**
+         * @brief Takes the value off the front.
+         * @return Returns the value that just got dequeued.
+         */
+        T  dequeue();
+
+        /**
+         * @param p_size The amount of values we want room for
+         *
+         * @brief Grows so that many values fit without growing again
+         */
+        void reserve(size_t p_size);
+
+        /**
+         * @param p_data The values, the first goes in first
+         * @param p_count How many values
+         *
+         * @brief Adds all the values to the back, growing at most once
+         */
+        void enqueueMany(const T* p_data, size_t p_count);
+
+        /**
+         * @param p_data Gets the values from the front
+         * @param p_count The most values we want
+         *
+         * @brief Takes values off the front until there are none or we have enough
+         * @return Returns how many were taken
+         */
+        size_t dequeueMany(T* p_data, size_t p_count);
+
+        /**
+         * @brief Removes every value, keeps the array
+         */
+        void clear();
+
+        /**
+         * @brief Gets the iterator to the front of the data structure.
+         * @return Returns a iterator to the value
+         */
+        Iterator begin();
+
+        /**
+         * @brief Gets the iterator to the front of the data structure.
+         * @return Returns a iterator to the value
+         */
+        ConstIterator cbegin() const;
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the value
+         */
+        Iterator end();
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the value
+         */
+        ConstIterator cend() const;
+
+    protected:
+        /**
+         * @param p_capacity The new capacity, a power of two that fits every value
+         * @param p_data Values to add to the back, can be in the old array
+         * @param p_count How many values to add
+         *
+         * @brief Moves the values into a new array, the front goes to the start, and copies the new ones after them before the old array is freed
+         */
+        void m_resize(size_t p_capacity, const T* p_data = nullptr, size_t p_count = 0);
+
+        /**
+         * @param p_size The least capacity
+         *
+         * @brief Rounds up to a power of two
+         * @return Returns the power of two
+         */
+        static size_t ms_powerOfTwo(size_t p_size);
+
+        /// The array, raw memory where there are no values
+        T* m_data;
+
+        /// How many values fit, a power of two or 0
+        size_t m_capacity;
+
+        /// Where the front is
+        size_t m_head;
+
+        /// The amount of values
+        size_t m_size;
+    };
+}
+
+template<typename T>
+cslib::RingBuffer<T>::RingBuffer() : m_data(nullptr), m_capacity(0), m_head(0), m_size(0) {
+
+}
+
+template<typename T>
+cslib::RingBuffer<T>::RingBuffer(const RingBuffer<T>& p_buffer) : m_data(nullptr), m_capacity(0), m_head(0), m_size(0) {
+    *this = p_buffer;
+}
+
+template<typename T>
+cslib::RingBuffer<T>& cslib::RingBuffer<T>::operator= (const RingBuffer<T>& p_buffer) {
+    if (this == &p_buffer) {
+        return *this;
+    }
+
+    this->clear();
+    this->reserve(p_buffer.m_size);
+    for (size_t i = 0; i < p_buffer.m_size; i++) {
+        this->enqueue(p_buffer[i]);
+    }
+    return *this;
+}
+
+template<typename T>
+cslib::RingBuffer<T>::~RingBuffer() {
+    this->clear();
+    ::operator delete(this->m_data, std::align_val_t(alignof(T)));
+}
+
+template<typename T>
+size_t cslib::RingBuffer<T>::size() const {
+    return this->m_size;
+}
+
+template<typename T>
+size_t cslib::RingBuffer<T>::capacity() const {
+    return this->m_capacity;
+}
+
+template<typename T>
+bool cslib::RingBuffer<T>::empty() const {
+    return (this->m_size == 0);
+}
+
+template<typename T>
+T& cslib::RingBuffer<T>::operator[](size_t p_index) {
+    if (p_index >= this->m_size) {
+        throw OutOfRange();
+    }
+    return this->m_data[(this->m_head + p_index) & (this->m_capacity - 1)];
+}
+
+template<typename T>
+const T& cslib::RingBuffer<T>::operator[](size_t p_index) const {
+    if (p_index >= this->m_size) {
+        throw OutOfRange();
+    }
+    return this->m_data[(this->m_head + p_index) & (this->m_capacity - 1)];
+}
+
+template<typename T>
+T& cslib::RingBuffer<T>::front() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_data[this->m_head];
+}
+
+template<typename T>
+const T& cslib::RingBuffer<T>::front() const {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_data[this->m_head];
+}
+
+template<typename T>
+T& cslib::RingBuffer<T>::enqueue(const T& p_data) {
+    // The value might be one of ours, so it goes in before the old array does
+    if (this->m_size == this->m_capacity) {
+        this->m_resize((this->m_capacity == 0) ? RINGBUFFER_CAPACITY_MIN : this->m_capacity * 2, &p_data, 1);
+        return this->m_data[this->m_size - 1];
+    }
+
+    T* value = new (&this->m_data[(this->m_head + this->m_size) & (this->m_capacity - 1)]) T(p_data);
+    this->m_size++;
+    return *value;
+}
+
+template<typename T>
+T cslib::RingBuffer<T>::dequeue() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+
+    T* value = &this->m_data[this->m_head];
+    T temp = *value;
+    value->~T();
+
+    this->m_head = (this->m_head + 1) & (this->m_capacity - 1);
+    this->m_size--;
+    return temp;
+}
+
+template<typename T>
+void cslib::RingBuffer<T>::reserve(size_t p_size) {
+    if (p_size > this->m_capacity) {
+        this->m_resize(ms_powerOfTwo(p_size));
+    }
+}
+
+template<typename T>
+void cslib::RingBuffer<T>::enqueueMany(const T* p_data, size_t p_count) {
+    if (this->m_size + p_count > this->m_capacity) {
+        this->m_resize(ms_powerOfTwo(this->m_size + p_count), p_data, p_count);
+        return;
+    }
+
+    // Up to the end of the array, then from the start
+    const size_t mask = this->m_capacity - 1;
+    size_t at = this->m_head + this->m_size;
+    for (size_t i = 0; i < p_count; i++) {
+        new (&this->m_data[(at + i) & mask]) T(p_data[i]);
+    }
+    this->m_size += p_count;
+}
+
+template<typename T>
+size_t cslib::RingBuffer<T>::dequeueMany(T* p_data, size_t p_count) {
+    size_t count = (p_count < this->m_size) ? p_count : this->m_size;
+
+    const size_t mask = this->m_capacity - 1;
+    for (size_t i = 0; i < count; i++) {
+        T* value = &this->m_data[(this->m_head + i) & mask];
+        p_data[i] = *value;
+        value->~T();
+    }
+
+    if (count > 0) {
+        this->m_head = (this->m_head + count) & mask;
+        this->m_size -= count;
+    }
+    return count;
+}
+
+template<typename T>
+void cslib::RingBuffer<T>::clear() {
+    for (size_t i = 0; i < this->m_size; i++) {
+        this->m_data[(this->m_head + i) & (this->m_capacity - 1)].~T();
+    }
+    this->m_head = 0;
+    this->m_size = 0;
+}
+
+template<typename T>
+typename cslib::RingBuffer<T>::Iterator cslib::RingBuffer<T>::begin() {
+    if (this->empty()) {
+        return Iterator();
+    }
+    return Iterator(this->m_data, this->m_capacity - 1, this->m_head, this->m_head + this->m_size);
+}
+
+template<typename T>
+typename cslib::RingBuffer<T>::ConstIterator cslib::RingBuffer<T>::cbegin() const {
+    if (this->empty()) {
+        return ConstIterator();
+    }
+    return ConstIterator(this->m_data, this->m_capacity - 1, this->m_head, this->m_head + this->m_size);
+}
+
+template<typename T>
+typename cslib::RingBuffer<T>::Iterator cslib::RingBuffer<T>::end() {
+    return Iterator();
+}
+
+template<typename T>
+typename cslib::RingBuffer<T>::ConstIterator cslib::RingBuffer<T>::cend() const {
+    return ConstIterator();
+}
+
+template<typename T>
+void cslib::RingBuffer<T>::m_resize(size_t p_capacity, const T* p_data, size_t p_count) {
+    T* data = static_cast<T*>(::operator new(sizeof(T) * p_capacity, std::align_val_t(alignof(T))));
+
+    // The new values first, they might still be read from the old array
+    for (size_t i = 0; i < p_count; i++) {
+        new (&data[this->m_size + i]) T(p_data[i]);
+    }
+
+    // Unwrap the values into the new array
+    for (size_t i = 0; i < this->m_size; i++) {
+        T* value = &this->m_data[(this->m_head + i) & (this->m_capacity - 1)];
+        new (&data[i]) T(std::move(*value));
+        value->~T();
+    }
+
+    ::operator delete(this->m_data, std::align_val_t(alignof(T)));
+    this->m_data = data;
+    this->m_capacity = p_capacity;
+    this->m_head = 0;
+    this->m_size += p_count;
+}
+
+template<typename T>
+size_t cslib::RingBuffer<T>::ms_powerOfTwo(size_t p_size) {
+    size_t capacity = RINGBUFFER_CAPACITY_MIN;
+    while (capacity < p_size) {
+        capacity *= 2;
+    }
+    return capacity;
+}
+
+
+
+
+
+
+
+
+
+
+
+template<typename T>
+cslib::RingBuffer<T>::Iterator::Iterator(T* p_data, size_t p_mask, size_t p_at, size_t p_end) : m_data(p_data), m_mask(p_mask), m_at(p_at), m_end(p_end) {
+    this->m_ptr = (p_at == p_end) ? nullptr : &p_data[p_at & p_mask];
+}
+
+template<typename T>
+typename cslib::RingBuffer<T>::Iterator& cslib::RingBuffer<T>::Iterator::operator++() {
+    this->m_at++;
+    this->m_ptr = (this->m_at == this->m_end) ? nullptr : &this->m_data[this->m_at & this->m_mask];
+    return *this;
+}
+
+template<typename T>
+typename cslib::RingBuffer<T>::Iterator cslib::RingBuffer<T>::Iterator::operator++(int) {
+    Iterator cpy = *this;
+    ++(*this);
+    return cpy;
+}
+
+template<typename T>
+cslib::RingBuffer<T>::ConstIterator::ConstIterator(const T* p_data, size_t p_mask, size_t p_at, size_t p_end) : m_data(p_data), m_mask(p_mask), m_at(p_at), m_end(p_end) {
+    this->m_ptr = (p_at == p_end) ? nullptr : &p_data[p_at & p_mask];
+}
+
+template<typename T>
+typename cslib::RingBuffer<T>::ConstIterator& cslib::RingBuffer<T>::ConstIterator::operator++() {
+    this->m_at++;
+    this->m_ptr = (this->m_at == this->m_end) ? nullptr : &this->m_data[this->m_at & this->m_mask];
+    return *this;
+}
+
+template<typename T>
+typename cslib::RingBuffer<T>::ConstIterator cslib::RingBuffer<T>::ConstIterator::operator++(int) {
+    ConstIterator cpy = *this;
+    ++(*this);
+    return cpy;
+}
+
+
+#endif
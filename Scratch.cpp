@@ -0,0 +1,110 @@
+#include "Scratch.h"
+
+#include <new>
+
+namespace cslib {
+    /**
+     * @struct ScratchCache
+     * @brief The idle buffers of a thread, freed when the thread finishes
+     **/
+    struct ScratchCache {
+        /// The buffers
+        void* buffers[SCRATCH_BUFFERS_MAX];
+        /// How many bytes each holds
+        size_t capacities[SCRATCH_BUFFERS_MAX];
+        /// How many there are
+        size_t count = 0;
+        /// The counters
+        ScratchStats stats;
+
+        ~ScratchCache() {
+            for (size_t i = 0; i < this->count; i++) {
+                ::operator delete(this->buffers[i]);
+            }
+            this->count = 0;
+        }
+    };
+
+    /**
+     * @fn ScratchPool_cache
+     * @brief Gets the cache of the calling thread
+     * @return Returns the cache
+     */
+    static ScratchCache& ScratchPool_cache() {
+        thread_local ScratchCache cache;
+        return cache;
+    }
+}
+
+void* cslib::ScratchPool::take(size_t& p_capacity) {
+    ScratchCache& cache = ScratchPool_cache();
+    cache.stats.requests++;
+    if (cache.count == 0) {
+        cache.stats.allocations++;
+        p_capacity = SCRATCH_BYTES_MIN;
+        return ::operator new(p_capacity);
+    }
+
+    // The biggest, so whoever asks first gets the one a deep traversal grew
+    size_t biggest = 0;
+    for (size_t i = 1; i < cache.count; i++) {
+        if (cache.capacities[i] > cache.capacities[biggest]) {
+            biggest = i;
+        }
+    }
+
+    void* buffer = cache.buffers[biggest];
+    p_capacity = cache.capacities[biggest];
+    cache.count--;
+    cache.buffers[biggest] = cache.buffers[cache.count];
+    cache.capacities[biggest] = cache.capacities[cache.count];
+    return buffer;
+}
+
+void cslib::ScratchPool::give(void* p_buffer, size_t p_capacity) {
+    ScratchCache& cache = ScratchPool_cache();
+    if (cache.count < SCRATCH_BUFFERS_MAX) {
+        cache.buffers[cache.count] = p_buffer;
+        cache.capacities[cache.count] = p_capacity;
+        cache.count++;
+        return;
+    }
+
+    // Full, keep the bigger ones
+    size_t smallest = 0;
+    for (size_t i = 1; i < cache.count; i++) {
+        if (cache.capacities[i] < cache.capacities[smallest]) {
+            smallest = i;
+        }
+    }
+    if (cache.capacities[smallest] < p_capacity) {
+        ::operator delete(cache.buffers[smallest]);
+        cache.buffers[smallest] = p_buffer;
+        cache.capacities[smallest] = p_capacity;
+    } else {
+        ::operator delete(p_buffer);
+    }
+}
+
+void* cslib::ScratchPool::grow(void* p_buffer, size_t p_used, size_t& p_capacity) {
+    ScratchCache& cache = ScratchPool_cache();
+    cache.stats.allocations++;
+
+    void* buffer = ::operator new(p_capacity * 2);
+    memcpy(buffer, p_buffer, p_used);
+    ::operator delete(p_buffer);
+    p_capacity *= 2;
+    return buffer;
+}
+
+void cslib::ScratchPool::trim() {
+    ScratchCache& cache = ScratchPool_cache();
+    for (size_t i = 0; i < cache.count; i++) {
+        ::operator delete(cache.buffers[i]);
+    }
+    cache.count = 0;
+}
+
+const cslib::ScratchStats& cslib::ScratchPool::stats() {
+    return ScratchPool_cache().stats;
+}
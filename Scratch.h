@@ -0,0 +1,262 @@
+/**
+ * @file Scratch.h
+ * @brief Holds Scratch, a short lived stack or queue whose memory comes from a per-thread pool of buffers.
+ **/
+#ifndef CSSCRATCH_H
+#define CSSCRATCH_H
+
+#include "Universal.h"
+
+#include <string.h>
+#include <type_traits>
+
+/// How many idle buffers a thread keeps for the next Scratch.
+#define SCRATCH_BUFFERS_MAX 8
+
+/// The least amount of bytes a scratch buffer holds.
+#define SCRATCH_BYTES_MIN 256
+
+namespace cslib {
+    /**
+     * @struct ScratchStats
+     * @brief Counters kept by the scratch pool of a thread
+     **/
+    struct ScratchStats {
+        /// How many buffers were asked for
+        size_t requests = 0;
+
+        /// How many times memory came from the system, new buffers and growing ones
+        size_t allocations = 0;
+    };
+
+    /**
+     * @class ScratchPool
+     * @brief Keeps the buffers of finished Scratches on each thread, so the next ones reuse them.
+     *
+     * A buffer is handed out whole and comes back with whatever it grew to, so once a thread
+     * has done a traversal, doing it again allocates nothing. Buffers never move between threads.
+     **/
+    class ScratchPool {
+    public:
+        /**
+         * @param p_capacity Gets how many bytes the buffer holds
+         *
+         * @brief Takes the biggest idle buffer of this thread, or allocates one
+         * @return Returns the buffer
+         */
+        static void* take(size_t& p_capacity);
+
+        /**
+         * @param p_buffer The buffer
+         * @param p_capacity How many bytes it holds
+         *
+         * @brief Gives a buffer back to this thread, if it already keeps enough the smallest is freed
+         */
+        static void give(void* p_buffer, size_t p_capacity);
+
+        /**
+         * @param p_buffer The buffer
+         * @param p_used How many bytes at the start are kept
+         * @param p_capacity How many bytes it holds, gets the new amount
+         *
+         * @brief Swaps a buffer for one twice the size
+         * @return Returns the new buffer
+         */
+        static void* grow(void* p_buffer, size_t p_used, size_t& p_capacity);
+
+        /**
+         * @brief Frees every idle buffer of this thread
+         */
+        static void trim();
+
+        /**
+         * @brief Gets the counters of this thread
+         * @return Returns the counters
+         */
+        static const ScratchStats& stats();
+    };
+
+    /**
+     * @class Scratch
+     * @tparam T Type held, trivially copyable, usually a node pointer.
+     * @brief A stack that can also be read from the front like a queue, for the length of one function.
+     *
+     * It takes a buffer from the thread's ScratchPool on the first push and gives it back when it's
+     * destroyed. Room taken from the front is moved over once it's half of what was pushed, so
+     * used as a queue it grows to about twice the most values it held at once, not everything pushed.
+     **/
+    template<typename T>
+    class Scratch {
+        static_assert(std::is_trivially_copyable<T>::value, "Scratch holds trivially copyable values");
+
+    public:
+        /**
+         * @brief Constructs it empty, nothing is taken until the first push
+         */
+        Scratch();
+
+        /**
+         * @brief Gives the buffer back to the thread
+         */
+        ~Scratch();
+
+        /// The buffer belongs to one owner
+        Scratch(const Scratch<T>&) = delete;
+        Scratch<T>& operator= (const Scratch<T>&) = delete;
+
+        /**
+         * @brief Gets the amount of values
+         * @return Returns the amount of values
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if there is no data in the data structure.
+         * @return True if empty, false if at least one item.
+         */
+        bool empty() const;
+
+        /**
+         * @param p_index Index from the front
+         *
+         * @brief Gets the value at the index, doesn't check it
+         * @return Returns the value
+         */
+        T& operator[](size_t p_index);
+
+        /**
+         * @brief Gets the value pushed last
+         * @return Returns the value
+         */
+        T& top();
+
+        /**
+         * @param p_data The data we are adding to the top
+         *
+         * @brief Adds a value to the top, the back if used as a queue
+         * @return Returns the value
+         */
+        T& push(const T& p_data);
+
+        /**
+         * @brief Takes off the value pushed last
+         * @return Returns the value
+         */
+        T  pop();
+
+        /**
+         * @brief Takes off the oldest value, used as a queue
+         * @return Returns the value
+         */
+        T  popFront();
+
+        /**
+         * @brief Removes every value, the buffer is kept
+         */
+        void clear();
+
+    protected:
+        /// The values, nullptr until the first push
+        T* m_data;
+
+        /// Where the front is
+        size_t m_head;
+
+        /// One past the top
+        size_t m_tail;
+
+        /// How many bytes the buffer holds
+        size_t m_bytes;
+    };
+}
+
+template<typename T>
+cslib::Scratch<T>::Scratch() : m_data(nullptr), m_head(0), m_tail(0), m_bytes(0) {
+
+}
+
+template<typename T>
+cslib::Scratch<T>::~Scratch() {
+    if (this->m_data != nullptr) {
+        ScratchPool::give(this->m_data, this->m_bytes);
+    }
+}
+
+template<typename T>
+size_t cslib::Scratch<T>::size() const {
+    return this->m_tail - this->m_head;
+}
+
+template<typename T>
+bool cslib::Scratch<T>::empty() const {
+    return (this->m_tail == this->m_head);
+}
+
+template<typename T>
+T& cslib::Scratch<T>::operator[](size_t p_index) {
+    return this->m_data[this->m_head + p_index];
+}
+
+template<typename T>
+T& cslib::Scratch<T>::top() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+    return this->m_data[this->m_tail - 1];
+}
+
+template<typename T>
+T& cslib::Scratch<T>::push(const T& p_data) {
+    if (this->m_data == nullptr) {
+        this->m_data = static_cast<T*>(ScratchPool::take(this->m_bytes));
+    }
+
+    // Full, but half of it was taken from the front, move the rest down rather than grow
+    if ((this->m_tail + 1) * sizeof(T) > this->m_bytes && this->m_head >= this->m_tail / 2) {
+        memmove(this->m_data, this->m_data + this->m_head, (this->m_tail - this->m_head) * sizeof(T));
+        this->m_tail -= this->m_head;
+        this->m_head = 0;
+    }
+    while ((this->m_tail + 1) * sizeof(T) > this->m_bytes) {
+        this->m_data = static_cast<T*>(ScratchPool::grow(this->m_data, this->m_tail * sizeof(T), this->m_bytes));
+    }
+
+    this->m_data[this->m_tail] = p_data;
+    return this->m_data[this->m_tail++];
+}
+
+template<typename T>
+T cslib::Scratch<T>::pop() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+
+    T data = this->m_data[--this->m_tail];
+    if (this->m_tail == this->m_head) {
+        this->m_head = this->m_tail = 0;
+    }
+    return data;
+}
+
+template<typename T>
+T cslib::Scratch<T>::popFront() {
+    if (this->empty()) {
+        throw OutOfRange();
+    }
+
+    // Once it's all taken the room can be used again
+    T data = this->m_data[this->m_head++];
+    if (this->m_tail == this->m_head) {
+        this->m_head = this->m_tail = 0;
+    }
+    return data;
+}
+
+template<typename T>
+void cslib::Scratch<T>::clear() {
+    this->m_head = 0;
+    this->m_tail = 0;
+}
+
+
+#endif
@@ -0,0 +1,777 @@
+/**
+ * @file Sequence.h
+ * @brief Holds the Sequence data structure, a list indexed in O(log n) by an implicit key treap.
+ **/
+#ifndef CSSEQUENCE_H
+#define CSSEQUENCE_H
+
+#include "Universal.h"
+#include "NodePool.h"
+#include "LinkedList.h"
+
+#include <atomic>
+
+namespace cslib {
+    /**
+     * @class Sequence
+     * @tparam T Type of the data structure.
+     * @brief A list of values in order where finding, inserting and removing by index are O(log n).
+     *
+     * Values are kept in a treap keyed by their position. A node's key is never stored, it is the
+     * size of everything left of it, so inserting shifts the rest without touching it. Every node
+     * has a random priority which keeps the tree balanced with high probability.
+     **/
+    template<typename T>
+    class Sequence {
+    protected:
+        /**
+         * @structure Node
+         * @brief The node of some sort of data
+         **/
+        struct Node {
+            /// Actual data.
+            T data;
+            /// Values in front of this one.
+            Node* left;
+            /// Values after this one.
+            Node* right;
+            /// The node above.
+            Node* parent;
+            /// The amount of nodes in this subtree.
+            size_t size;
+            /// Heap order priority, parents are higher.
+            uint32_t priority;
+        };
+
+    public:
+        /**
+         * @class Iterator
+         * @brief The iterator for a sequence, walks it in order.
+         **/
+        class Iterator : public cslib::Iterator<Node> {
+        public:
+            /**
+             * @param p_ptr The pointer of the Iterator
+             *
+             * @brief Constructs the Iterator
+             */
+            Iterator(Node* p_ptr = nullptr);
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            Iterator& operator++();
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value before moving
+             */
+            Iterator  operator++(int);
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            T& operator* ();
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            T* operator->();
+        };
+
+        /**
+         * @class ConstIterator
+         * @brief The iterator for a sequence, walks it in order.
+         **/
+        class ConstIterator : public cslib::ConstIterator<Node> {
+        public:
+            /**
+             * @param p_ptr The pointer of the Const Iterator
+             *
+             * @brief Constructs the Iterator
+             */
+            ConstIterator(const Node* p_ptr = nullptr);
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            ConstIterator& operator++();
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value before moving
+             */
+            ConstIterator  operator++(int);
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            const T& operator* ();
+
+            /**
+             * @brief Gets the value at the location
+             * @return Gets the value that this iterator represents
+             */
+            const T* operator->();
+        };
+
+        /**
+         * @brief Constructs the class
+         */
+        Sequence();
+
+        /**
+         * @brief Deep copies the Sequence, the shape of the tree is kept
+         */
+        Sequence(const Sequence<T>& p_seq);
+
+        /**
+         * @brief Deep copies the Sequence.
+         * @return Returns "this" data structure
+         */
+        Sequence<T>& operator= (const Sequence<T>& p_seq);
+
+        /**
+         * @brief Destroys the class
+         */
+        ~Sequence();
+
+        /**
+         * @brief Gets the size of the sequence
+         * @return Returns the amount of values, O(1)
+         */
+        size_t size() const;
+
+        /**
+         * @param p_index The index of the value we wish
+         *
+         * @brief Gets an index of a value in O(log n).
+         * @return Returns the value at the index.
+         */
+        T& operator[](size_t p_index);
+
+        /**
+         * @param p_index The index of the value we wish
+         *
+         * @brief Gets an index of a value in O(log n).
+         * @return Returns the value at the index.
+         */
+        const T& operator[](size_t p_index) const;
+
+        /**
+         * @param p_data The data we are adding
+         *
+         * @brief Adds the value to the far end.
+         * @return Returns the value just inserted.
+         */
+        T& append(const T& p_data);
+
+        /**
+         * @param p_data The data we are adding
+         * @param p_index The index we are inserting into.
+         *
+         * @brief Adds the value to the index given (p_index) in O(log n)
+         * @return Returns the value just inserted.
+         */
+        T& insert(const T& p_data, size_t p_index);
+
+        /**
+         * @param p_left The left hand index
+         * @param p_right The right hand index
+         *
+         * @brief Swaps the two values
+         */
+        void swap(size_t p_left, size_t p_right);
+
+        /**
+         * @param p_index The index we are removing
+         *
+         * @brief Deletes the index given in O(log n)
+         * @return Returns the value just removed.
+         */
+        T remove(size_t p_index);
+
+        /**
+         * @param p_index The index of the first value that moves
+         * @param p_tail The sequence the values are added to the end of, can't be "this"
+         *
+         * @brief Moves the values from the index onwards to the end of the other in O(log n)
+         */
+        void split(size_t p_index, Sequence<T>& p_tail);
+
+        /**
+         * @param p_other The sequence we're taking every value from, left empty
+         *
+         * @brief Adds all of the other sequence onto the end of this one in O(log n)
+         */
+        void concat(Sequence<T>& p_other);
+
+        /**
+         * @brief Gets the iterator to the front of the data structure.
+         * @return Returns a iterator to the node
+         */
+        Iterator begin();
+
+        /**
+         * @brief Gets the iterator to the front of the data structure.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator cbegin() const;
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the node
+         */
+        Iterator end();
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the node
+         */
+        ConstIterator cend() const;
+
+    protected:
+        /**
+         * @param p_data The data we're copying
+         *
+         * @brief Creates a lone node
+         * @return Returns the new node
+         */
+        Node* m_create(const T& p_data);
+
+        /**
+         * @param p_node The node we're destroying
+         *
+         * @brief Destroys the node and gives it back to its pool
+         */
+        static void ms_destroy(Node* p_node);
+
+        /**
+         * @param p_node The subtree we're destroying
+         *
+         * @brief Destroys every node under and including the node
+         */
+        static void ms_clear(Node* p_node);
+
+        /**
+         * @param p_node The subtree we're copying
+         * @param p_parent The parent of the copy
+         *
+         * @brief Copies a subtree, priorities included
+         * @return Returns the copy
+         */
+        Node* m_copy(const Node* p_node, Node* p_parent);
+
+        /**
+         * @param p_index The index we are retrieving
+         *
+         * @brief Gets the pointer of the node at the location.
+         * @return Returns a pointer to the node
+         */
+        Node* m_at(size_t p_index) const;
+
+        /**
+         * @param p_node The node, can be nullptr
+         *
+         * @brief Gets the size of a subtree
+         * @return Returns the size
+         */
+        static size_t ms_size(const Node* p_node);
+
+        /**
+         * @param p_node The node whose children changed
+         *
+         * @brief Recounts the node and points its children back at it
+         */
+        static void ms_update(Node* p_node);
+
+        /**
+         * @param p_node The tree we're splitting
+         * @param p_count How many values go into the left
+         * @param p_left Gets the first p_count values
+         * @param p_right Gets the rest
+         *
+         * @brief Splits a tree by position
+         */
+        static void ms_split(Node* p_node, size_t p_count, Node*& p_left, Node*& p_right);
+
+        /**
+         * @param p_left The tree that goes first
+         * @param p_right The tree that goes after
+         *
+         * @brief Joins two trees, keeping the heap order of the priorities
+         * @return Returns the root of the joined tree
+         */
+        static Node* ms_merge(Node* p_left, Node* p_right);
+
+        /**
+         * @param p_node A node in the tree
+         *
+         * @brief Gets the node after in order
+         * @return Returns the next node, nullptr if it was the last
+         */
+        static Node* ms_next(const Node* p_node);
+
+        /**
+         * @brief Gets the next random priority
+         * @return Returns the priority
+         */
+        uint32_t m_priority();
+
+        /**
+         * @brief Gets a seed no other sequence starts from, so joined sequences don't share priorities
+         * @return Returns the seed, never 0
+         */
+        uint32_t m_newSeed() const;
+
+        /// The root of the tree
+        Node* m_root;
+
+        /// Where new nodes come from, made when the first node is
+        NodePool<Node>* m_pool;
+
+        /// State of the priority generator
+        uint32_t m_seed;
+    };
+}
+
+template<typename T>
+cslib::Sequence<T>::Sequence() : m_root(nullptr), m_pool(nullptr), m_seed(m_newSeed()) {
+
+}
+
+template<typename T>
+cslib::Sequence<T>::Sequence(const Sequence<T>& p_seq) : m_root(nullptr), m_pool(nullptr), m_seed(m_newSeed()) {
+    this->m_root = this->m_copy(p_seq.m_root, nullptr);
+}
+
+template<typename T>
+cslib::Sequence<T>& cslib::Sequence<T>::operator= (const Sequence<T>& p_seq) {
+    if (this != &p_seq) {
+        ms_clear(this->m_root);
+        this->m_root = nullptr;
+        this->m_root = this->m_copy(p_seq.m_root, nullptr);
+    }
+    return *this;
+}
+
+template<typename T>
+cslib::Sequence<T>::~Sequence() {
+    // Delete all and let go of the pool
+    ms_clear(this->m_root);
+    if (this->m_pool != nullptr) {
+        this->m_pool->release();
+    }
+}
+
+template<typename T>
+size_t cslib::Sequence<T>::size() const {
+    return ms_size(this->m_root);
+}
+
+template<typename T>
+T& cslib::Sequence<T>::operator[](size_t p_index) {
+    return this->m_at(p_index)->data;
+}
+
+template<typename T>
+const T& cslib::Sequence<T>::operator[](size_t p_index) const {
+    return this->m_at(p_index)->data;
+}
+
+template<typename T>
+T& cslib::Sequence<T>::append(const T& p_data) {
+    Node* node = this->m_create(p_data);
+    this->m_root = ms_merge(this->m_root, node);
+    this->m_root->parent = nullptr;
+    return node->data;
+}
+
+template<typename T>
+T& cslib::Sequence<T>::insert(const T& p_data, size_t p_index) {
+    // Bound check
+    if (p_index > this->size()) {
+        throw OutOfRange();
+    }
+
+    // Cut where it goes and join the three back up
+    Node* node = this->m_create(p_data);
+    Node* left = nullptr;
+    Node* right = nullptr;
+    ms_split(this->m_root, p_index, left, right);
+    this->m_root = ms_merge(ms_merge(left, node), right);
+    this->m_root->parent = nullptr;
+    return node->data;
+}
+
+template<typename T>
+void cslib::Sequence<T>::swap(size_t p_left, size_t p_right) {
+    // If both are the same...
+    if (p_left == p_right) {
+        return;
+    }
+
+    Node* left = this->m_at(p_left);
+    Node* right = this->m_at(p_right);
+
+    T temp = left->data;
+    left->data = right->data;
+    right->data = temp;
+}
+
+template<typename T>
+T cslib::Sequence<T>::remove(size_t p_index) {
+    // Check if we're in range
+    if (p_index >= this->size()) {
+        throw OutOfRange();
+    }
+
+    // Cut the one value out and join the rest
+    Node* left = nullptr;
+    Node* node = nullptr;
+    Node* right = nullptr;
+    ms_split(this->m_root, p_index, left, right);
+    ms_split(right, 1, node, right);
+    this->m_root = ms_merge(left, right);
+    if (this->m_root != nullptr) {
+        this->m_root->parent = nullptr;
+    }
+
+    T temp = node->data;
+    ms_destroy(node);
+    return temp;
+}
+
+template<typename T>
+void cslib::Sequence<T>::split(size_t p_index, Sequence<T>& p_tail) {
+    // Can't give to ourselves
+    if (&p_tail == this) {
+        throw LinkedListException();
+    }
+
+    // Bound check
+    if (p_index > this->size()) {
+        throw OutOfRange();
+    }
+
+    Node* left = nullptr;
+    Node* right = nullptr;
+    ms_split(this->m_root, p_index, left, right);
+    this->m_root = left;
+    if (this->m_root != nullptr) {
+        this->m_root->parent = nullptr;
+    }
+
+    // The nodes keep their pool, so the tail can free them
+    p_tail.m_root = ms_merge(p_tail.m_root, right);
+    if (p_tail.m_root != nullptr) {
+        p_tail.m_root->parent = nullptr;
+    }
+}
+
+template<typename T>
+void cslib::Sequence<T>::concat(Sequence<T>& p_other) {
+    if (&p_other == this) {
+        throw LinkedListException();
+    }
+
+    this->m_root = ms_merge(this->m_root, p_other.m_root);
+    if (this->m_root != nullptr) {
+        this->m_root->parent = nullptr;
+    }
+    p_other.m_root = nullptr;
+}
+
+template<typename T>
+typename cslib::Sequence<T>::Iterator cslib::Sequence<T>::begin() {
+    // The leftmost is first
+    Node* node = this->m_root;
+    while (node != nullptr && node->left != nullptr) {
+        node = node->left;
+    }
+    return Iterator(node);
+}
+
+template<typename T>
+typename cslib::Sequence<T>::ConstIterator cslib::Sequence<T>::cbegin() const {
+    // The leftmost is first
+    const Node* node = this->m_root;
+    while (node != nullptr && node->left != nullptr) {
+        node = node->left;
+    }
+    return ConstIterator(node);
+}
+
+template<typename T>
+typename cslib::Sequence<T>::Iterator cslib::Sequence<T>::end() {
+    return Iterator(nullptr);
+}
+
+template<typename T>
+typename cslib::Sequence<T>::ConstIterator cslib::Sequence<T>::cend() const {
+    return ConstIterator(nullptr);
+}
+
+template<typename T>
+typename cslib::Sequence<T>::Node* cslib::Sequence<T>::m_create(const T& p_data) {
+    // Get the pool the first time we need it
+    if (this->m_pool == nullptr) {
+        this->m_pool = NodePool<Node>::create();
+    }
+
+    // Creates a new node in memory from the pool
+    Node* memory = nullptr;
+    try {
+        memory = this->m_pool->allocate();
+        Node* node = new (memory) Node{ p_data, nullptr, nullptr, nullptr, 1, this->m_priority() };
+        return node;
+    } catch (std::exception&) {
+        if (memory != nullptr) {
+            NodePool<Node>::deallocate(memory);
+        }
+        throw LinkedListNodeCantCreate();
+    }
+}
+
+template<typename T>
+void cslib::Sequence<T>::ms_destroy(Node* p_node) {
+    // Nodes go back to the pool they came from, which might not be ours
+    p_node->~Node();
+    NodePool<Node>::deallocate(p_node);
+}
+
+template<typename T>
+void cslib::Sequence<T>::ms_clear(Node* p_node) {
+    // Rotate left children up until there are none, then the node can go, no stack needed
+    while (p_node != nullptr) {
+        if (p_node->left != nullptr) {
+            Node* left = p_node->left;
+            p_node->left = left->right;
+            left->right = p_node;
+            p_node = left;
+        } else {
+            Node* right = p_node->right;
+            ms_destroy(p_node);
+            p_node = right;
+        }
+    }
+}
+
+template<typename T>
+typename cslib::Sequence<T>::Node* cslib::Sequence<T>::m_copy(const Node* p_node, Node* p_parent) {
+    if (p_node == nullptr) {
+        return nullptr;
+    }
+
+    Node* node = this->m_create(p_node->data);
+    node->priority = p_node->priority;
+    node->size = p_node->size;
+    node->parent = p_parent;
+    node->left = this->m_copy(p_node->left, node);
+    node->right = this->m_copy(p_node->right, node);
+    return node;
+}
+
+template<typename T>
+typename cslib::Sequence<T>::Node* cslib::Sequence<T>::m_at(size_t p_index) const {
+    // Check if valid relation
+    if (p_index >= this->size()) {
+        throw OutOfRange();
+    }
+
+    // Go down by the sizes on the left
+    Node* node = this->m_root;
+    while (true) {
+        size_t left = ms_size(node->left);
+        if (p_index < left) {
+            node = node->left;
+        } else if (p_index == left) {
+            return node;
+        } else {
+            p_index -= left + 1;
+            node = node->right;
+        }
+    }
+}
+
+template<typename T>
+size_t cslib::Sequence<T>::ms_size(const Node* p_node) {
+    return (p_node == nullptr) ? 0 : p_node->size;
+}
+
+template<typename T>
+void cslib::Sequence<T>::ms_update(Node* p_node) {
+    p_node->size = 1 + ms_size(p_node->left) + ms_size(p_node->right);
+    if (p_node->left != nullptr) {
+        p_node->left->parent = p_node;
+    }
+    if (p_node->right != nullptr) {
+        p_node->right->parent = p_node;
+    }
+}
+
+template<typename T>
+void cslib::Sequence<T>::ms_split(Node* p_node, size_t p_count, Node*& p_left, Node*& p_right) {
+    if (p_node == nullptr) {
+        p_left = nullptr;
+        p_right = nullptr;
+        return;
+    }
+
+    size_t left = ms_size(p_node->left);
+    if (left < p_count) {
+        // The node and its left go left, the cut is on the right
+        ms_split(p_node->right, p_count - left - 1, p_node->right, p_right);
+        ms_update(p_node);
+        p_left = p_node;
+    } else {
+        // The node and its right go right, the cut is on the left
+        ms_split(p_node->left, p_count, p_left, p_node->left);
+        ms_update(p_node);
+        p_right = p_node;
+    }
+}
+
+template<typename T>
+typename cslib::Sequence<T>::Node* cslib::Sequence<T>::ms_merge(Node* p_left, Node* p_right) {
+    if (p_left == nullptr) {
+        return p_right;
+    }
+    if (p_right == nullptr) {
+        return p_left;
+    }
+
+    // Higher priority stays on top
+    if (p_left->priority > p_right->priority) {
+        p_left->right = ms_merge(p_left->right, p_right);
+        ms_update(p_left);
+        return p_left;
+    }
+
+    p_right->left = ms_merge(p_left, p_right->left);
+    ms_update(p_right);
+    return p_right;
+}
+
+template<typename T>
+typename cslib::Sequence<T>::Node* cslib::Sequence<T>::ms_next(const Node* p_node) {
+    // Leftmost on the right
+    if (p_node->right != nullptr) {
+        Node* node = p_node->right;
+        while (node->left != nullptr) {
+            node = node->left;
+        }
+        return node;
+    }
+
+    // Otherwise up until we come from the left
+    Node* parent = p_node->parent;
+    while (parent != nullptr && parent->right == p_node) {
+        p_node = parent;
+        parent = parent->parent;
+    }
+    return parent;
+}
+
+template<typename T>
+uint32_t cslib::Sequence<T>::m_priority() {
+    // Xorshift, good enough to balance a tree
+    uint32_t x = this->m_seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    this->m_seed = x;
+    return x;
+}
+
+template<typename T>
+uint32_t cslib::Sequence<T>::m_newSeed() const {
+    // A count shared by every sequence, mixed with where this one lives
+    static std::atomic<uint64_t> s_count{ 0 };
+    uint64_t x = (s_count.fetch_add(1, std::memory_order_relaxed) * 0x9E3779B97F4A7C15ull) ^ reinterpret_cast<uintptr_t>(this);
+
+    // SplitMix64 finish, every bit of the input reaches the low half
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ull;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBull;
+    x ^= x >> 31;
+
+    // Xorshift never leaves 0
+    uint32_t seed = (uint32_t)x;
+    return (seed == 0) ? 2463534242u : seed;
+}
+
+
+
+
+
+
+
+
+
+
+
+template<typename T>
+cslib::Sequence<T>::Iterator::Iterator(Node* p_ptr) {
+    this->m_ptr = p_ptr;
+}
+
+template<typename T>
+T& cslib::Sequence<T>::Iterator::operator*() {
+    return (this->m_ptr->data);
+}
+
+template<typename T>
+T* cslib::Sequence<T>::Iterator::operator->() {
+    return &(this->m_ptr->data);
+}
+
+template<typename T>
+typename cslib::Sequence<T>::Iterator& cslib::Sequence<T>::Iterator::operator++() {
+    this->m_ptr = Sequence<T>::ms_next(this->m_ptr);
+    return *this;
+}
+
+template<typename T>
+typename cslib::Sequence<T>::Iterator cslib::Sequence<T>::Iterator::operator++(int) {
+    Iterator cpy = *this;
+    this->m_ptr = Sequence<T>::ms_next(this->m_ptr);
+    return cpy;
+}
+
+template<typename T>
+cslib::Sequence<T>::ConstIterator::ConstIterator(const Node* p_ptr) {
+    this->m_ptr = p_ptr;
+}
+
+template<typename T>
+const T& cslib::Sequence<T>::ConstIterator::operator*() {
+    return (this->m_ptr->data);
+}
+
+template<typename T>
+const T* cslib::Sequence<T>::ConstIterator::operator->() {
+    return &(this->m_ptr->data);
+}
+
+template<typename T>
+typename cslib::Sequence<T>::ConstIterator& cslib::Sequence<T>::ConstIterator::operator++() {
+    this->m_ptr = Sequence<T>::ms_next(this->m_ptr);
+    return *this;
+}
+
+template<typename T>
+typename cslib::Sequence<T>::ConstIterator cslib::Sequence<T>::ConstIterator::operator++(int) {
+    ConstIterator cpy = *this;
+    this->m_ptr = Sequence<T>::ms_next(this->m_ptr);
+    return cpy;
+}
+
+
+#endif
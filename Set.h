@@ -62,7 +62,7 @@ cslib::Set<T> cslib::Set<T>::unionise(const Set<T>& p_set) const {
     Set<T> uni = left;
 
     // Add in right
-    Stack<BinaryNode*> stack;
+    Scratch<BinaryNode*> stack;
     stack.push(right.m_root); 
     while (!stack.empty()) {
         // Get the data
@@ -97,8 +97,8 @@ cslib::Set<T> cslib::Set<T>::intersection(const Set<T>& p_set) const {
     Set<T> intsect;
 
     // Add in right
-    Stack<BinaryNode*> lstack;
-    Stack<BinaryNode*> rstack;
+    Scratch<BinaryNode*> lstack;
+    Scratch<BinaryNode*> rstack;
     lstack.push(left .m_root);
     rstack.push(right.m_root);
 
@@ -198,7 +198,7 @@ cslib::Set<T> cslib::Set<T>::difference(const Set<T>& p_set) const {
     Set<T> dif;
 
     // Check all left nodes to ensure it doesn't exist in right
-    Stack<BinaryNode*> stack;
+    Scratch<BinaryNode*> stack;
     stack.push(left.m_root);
     while (!stack.empty()) {
         // Get the data
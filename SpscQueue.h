@@ -0,0 +1,237 @@
+/**
+ * @file SpscQueue.h
+ * @brief Holds the SpscQueue, a bounded first-in-first out structure for one producer and one consumer thread.
+ **/
+#ifndef CSSPSCQUEUE_H
+#define CSSPSCQUEUE_H
+
+#include "Universal.h"
+
+#include <atomic>
+#include <new>
+#include <utility>
+
+namespace cslib {
+    /**
+     * @class SpscQueue
+     * @tparam T Type of the data structure.
+     * @brief A lock free First-in-first out data structure with a fixed capacity, one thread pushes and one pops.
+     *
+     * The values sit in a power-of-two ring. The head only moves on the consumer and the tail only
+     * on the producer, each on its own cache line, so neither side ever needs a compare and exchange.
+     * Each side also keeps the last index it read from the other side and only reloads it when the
+     * ring looks full or empty, so the cache line of the other side is rarely pulled over.
+     **/
+    template<typename T>
+    class SpscQueue {
+    public:
+        /**
+         * @param p_capacity The least amount of values it holds, rounded up to a power of two
+         *
+         * @brief Constructs an empty queue
+         */
+        SpscQueue(size_t p_capacity);
+
+        /**
+         * @brief Destroys what's left, neither thread can be using it
+         */
+        ~SpscQueue();
+
+        /// Copying can't be done safely while others use it
+        SpscQueue(const SpscQueue<T>&) = delete;
+        SpscQueue<T>& operator= (const SpscQueue<T>&) = delete;
+
+        /**
+         * @brief Gets how many values fit
+         * @return Returns the capacity
+         */
+        size_t capacity() const;
+
+        /**
+         * @brief Gets the amount of values when we looked, exact only on the producer or consumer
+         * @return Returns the amount of values
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if there was no data in the data structure when we looked.
+         * @return True if empty, false if at least one item.
+         */
+        bool empty() const;
+
+        /**
+         * @param p_data The data we are adding to the back, only the producer may call this
+         *
+         * @brief Adds the value to the back if there is room
+         * @return Returns false if the queue was full
+         */
+        bool tryPush(const T& p_data);
+
+        /**
+         * @param p_data Gets the value from the front, only the consumer may call this
+         *
+         * @brief Takes the front value off if there is one
+         * @return Returns false if the queue was empty
+         */
+        bool tryPop(T& p_data);
+
+        /**
+         * @param p_data The values, the first goes in first
+         * @param p_count How many values
+         *
+         * @brief Adds as many values as fit, publishing them all at once. Only the producer may call this
+         * @return Returns how many were added
+         */
+        size_t pushMany(const T* p_data, size_t p_count);
+
+        /**
+         * @param p_data Gets the values from the front
+         * @param p_count The most values we want
+         *
+         * @brief Takes values off the front until there are none or we have enough. Only the consumer may call this
+         * @return Returns how many were taken
+         */
+        size_t popMany(T* p_data, size_t p_count);
+
+    protected:
+        /// The ring, raw memory where there are no values
+        alignas(64) T* m_data;
+
+        /// The capacity less one
+        size_t m_mask;
+
+        /// Where the consumer takes from next, only the consumer writes it
+        alignas(64) std::atomic<size_t> m_head;
+
+        /// The tail the consumer last saw
+        size_t m_tailCache;
+
+        /// Where the producer puts the next value, only the producer writes it
+        alignas(64) std::atomic<size_t> m_tail;
+
+        /// The head the producer last saw
+        size_t m_headCache;
+    };
+}
+
+template<typename T>
+cslib::SpscQueue<T>::SpscQueue(size_t p_capacity) : m_data(nullptr), m_mask(0), m_head(0), m_tailCache(0), m_tail(0), m_headCache(0) {
+    size_t capacity = 2;
+    while (capacity < p_capacity) {
+        capacity *= 2;
+    }
+
+    this->m_data = static_cast<T*>(::operator new(sizeof(T) * capacity, std::align_val_t(alignof(T))));
+    this->m_mask = capacity - 1;
+}
+
+template<typename T>
+cslib::SpscQueue<T>::~SpscQueue() {
+    size_t tail = this->m_tail.load(std::memory_order_acquire);
+    for (size_t i = this->m_head.load(std::memory_order_acquire); i != tail; i++) {
+        this->m_data[i & this->m_mask].~T();
+    }
+    ::operator delete(this->m_data, std::align_val_t(alignof(T)));
+}
+
+template<typename T>
+size_t cslib::SpscQueue<T>::capacity() const {
+    return this->m_mask + 1;
+}
+
+template<typename T>
+size_t cslib::SpscQueue<T>::size() const {
+    // The head first, so the tail can't look behind it
+    size_t head = this->m_head.load(std::memory_order_acquire);
+    size_t tail = this->m_tail.load(std::memory_order_acquire);
+    return tail - head;
+}
+
+template<typename T>
+bool cslib::SpscQueue<T>::empty() const {
+    return (this->size() == 0);
+}
+
+template<typename T>
+bool cslib::SpscQueue<T>::tryPush(const T& p_data) {
+    size_t tail = this->m_tail.load(std::memory_order_relaxed);
+
+    // Only look at the consumer's line when it seems full
+    if (tail - this->m_headCache > this->m_mask) {
+        this->m_headCache = this->m_head.load(std::memory_order_acquire);
+        if (tail - this->m_headCache > this->m_mask) {
+            return false;
+        }
+    }
+
+    new (&this->m_data[tail & this->m_mask]) T(p_data);
+    this->m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+bool cslib::SpscQueue<T>::tryPop(T& p_data) {
+    size_t head = this->m_head.load(std::memory_order_relaxed);
+
+    // Only look at the producer's line when it seems empty
+    if (head == this->m_tailCache) {
+        this->m_tailCache = this->m_tail.load(std::memory_order_acquire);
+        if (head == this->m_tailCache) {
+            return false;
+        }
+    }
+
+    T* value = &this->m_data[head & this->m_mask];
+    p_data = std::move(*value);
+    value->~T();
+    this->m_head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+size_t cslib::SpscQueue<T>::pushMany(const T* p_data, size_t p_count) {
+    size_t tail = this->m_tail.load(std::memory_order_relaxed);
+
+    size_t room = this->m_mask + 1 - (tail - this->m_headCache);
+    if (room < p_count) {
+        this->m_headCache = this->m_head.load(std::memory_order_acquire);
+        room = this->m_mask + 1 - (tail - this->m_headCache);
+    }
+
+    size_t count = (p_count < room) ? p_count : room;
+    for (size_t i = 0; i < count; i++) {
+        new (&this->m_data[(tail + i) & this->m_mask]) T(p_data[i]);
+    }
+
+    // One store hands the whole batch over
+    if (count > 0) {
+        this->m_tail.store(tail + count, std::memory_order_release);
+    }
+    return count;
+}
+
+template<typename T>
+size_t cslib::SpscQueue<T>::popMany(T* p_data, size_t p_count) {
+    size_t head = this->m_head.load(std::memory_order_relaxed);
+
+    size_t waiting = this->m_tailCache - head;
+    if (waiting < p_count) {
+        this->m_tailCache = this->m_tail.load(std::memory_order_acquire);
+        waiting = this->m_tailCache - head;
+    }
+
+    size_t count = (p_count < waiting) ? p_count : waiting;
+    for (size_t i = 0; i < count; i++) {
+        T* value = &this->m_data[(head + i) & this->m_mask];
+        p_data[i] = std::move(*value);
+        value->~T();
+    }
+
+    if (count > 0) {
+        this->m_head.store(head + count, std::memory_order_release);
+    }
+    return count;
+}
+
+
+#endif
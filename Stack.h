@@ -7,6 +7,9 @@
 #define CSSTACK_H
 
 #include "LinkedList.h"
+#include "ArrayStack.h"
+
+#include <type_traits>
 
 namespace cslib {
     /**
@@ -36,10 +39,16 @@ namespace cslib {
     /**
      * @class Stack
      * @tparam T Type of the data structure.
+     * @tparam TContainer What holds the values, LinkedList<T> or ArrayStack<T>.
      * @brief A Last-in-first out data structure.
+     *
+     * The default keeps a node per value. Stack<T, ArrayStack<T>> keeps the values in arrays
+     * instead, which is what short lived scratch stacks like tree traversals want.
      **/
-    template<typename T>
+    template<typename T, typename TContainer = LinkedList<T>>
     class Stack : private LinkedList<T> {
+        static_assert(std::is_same<TContainer, LinkedList<T>>::value, "Stack is held by LinkedList<T> or ArrayStack<T>");
+
     public:
         /**
          * @brief Constructor for the Stack Data Structure 
@@ -117,106 +126,295 @@ namespace cslib {
         /// The node in the Stack
         typedef LinkedList<T>::Node Node;
     };
+
+    /**
+     * @class Stack
+     * @tparam T Type of the data structure.
+     * @brief A Last-in-first out data structure kept in arrays, pushing doesn't allocate per value.
+     **/
+    template<typename T>
+    class Stack<T, ArrayStack<T>> : private ArrayStack<T> {
+    public:
+        /**
+         * @brief Constructor for the Stack Data Structure
+         */
+        Stack();
+
+        /**
+         * @brief Returns the size of the stack.
+         * @return Returns the size of a stack.
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if there is no data in the data structure.
+         * @return True if empty, false if at least one item.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Gets the top value of the stack without poping.
+         * @return Top value of the stack.
+         */
+        T& top();
+
+        /**
+         * @brief Gets the top value of the stack without poping.
+         * @return Top value of the stack.
+         */
+        const T& top() const;
+
+        /**
+         * @brief Removes the top value from the stack.
+         * @return Gives the popped value back
+         */
+        T  pop();
+
+        /**
+         * @param p_data The data we are adding to the top of the stack.
+         *
+         * @brief Adds the parameter into the top of the stack
+         * @return Top value of the stack.
+         */
+        T& push(const T& p_data);
+
+        /**
+         * @param p_size The amount of values we want room for
+         *
+         * @brief Makes room so the stack can hold that many values without allocating
+         */
+        void reserve(size_t p_size);
+
+        /**
+         * @param p_data The values, the last one ends up on top
+         * @param p_count How many values
+         *
+         * @brief Pushes all the values with at most one allocation
+         */
+        void pushMany(const T* p_data, size_t p_count);
+
+        /**
+         * @param p_data Gets the values in the order they were popped
+         * @param p_count The most values we want
+         *
+         * @brief Pops values until there are none or we have enough
+         * @return Returns how many were popped
+         */
+        size_t popMany(T* p_data, size_t p_count);
+
+        /// The iterator type in the Stack
+        typedef typename ArrayStack<T>::Iterator Iterator;
+
+        /// The const iterator type in the Stack
+        typedef typename ArrayStack<T>::ConstIterator ConstIterator;
+
+        /**
+         * @brief Gets the top value of the stack by iterator.
+         * @return Iterator representing top of the stack
+         */
+        Iterator begin();
+
+        /**
+         * @brief Gets the top value of the stack by iterator.
+         * @return Iterator representing top of the stack
+         */
+        ConstIterator cbegin() const;
+
+        /**
+         * @brief Gets the value right after the end of the stack by iterator.
+         * @return Iterator representing past the bottom of the stack
+         */
+        Iterator end();
+
+        /**
+         * @brief Gets the value right after the end of the stack by iterator.
+         * @return Iterator representing past the bottom of the stack
+         */
+        ConstIterator cend() const;
+    };
 }
 
 const char* cslib::StackOverflow::what() const throw() { return "Stack Overflow"; }
 const char* cslib::StackUnderflow::what() const throw() { return "Stack Underflow"; }
 
-template<typename T>
-cslib::Stack<T>::Stack() : cslib::LinkedList<T>() {
+template<typename T, typename TContainer>
+cslib::Stack<T, TContainer>::Stack() : cslib::LinkedList<T>() {
 
 }
 
-template<typename T>
-size_t cslib::Stack<T>::size() const {
+template<typename T, typename TContainer>
+size_t cslib::Stack<T, TContainer>::size() const {
     // Get size from 
     return cslib::LinkedList<T>::size();
 }
 
-template<typename T>
-bool cslib::Stack<T>::empty() const {
+template<typename T, typename TContainer>
+bool cslib::Stack<T, TContainer>::empty() const {
     // Get size from 
     return (this->m_data == nullptr);
 }
 
-template<typename T>
-T& cslib::Stack<T>::top() {
+template<typename T, typename TContainer>
+T& cslib::Stack<T, TContainer>::top() {
     if (this->empty()) {
         throw StackUnderflow();
     }
     return this->m_data->data;
 }
 
-template<typename T>
-const T& cslib::Stack<T>::top() const {
+template<typename T, typename TContainer>
+const T& cslib::Stack<T, TContainer>::top() const {
     if (this->empty()) {
         throw StackUnderflow();
     }
     return this->m_data->data;
 }
 
-template<typename T>
-T cslib::Stack<T>::pop() {
+template<typename T, typename TContainer>
+T cslib::Stack<T, TContainer>::pop() {
     if (this->empty()) {
         throw StackUnderflow();
     }
 
-    // Save root value
-    T temp = this->m_data->data;
+    // Unlink the root and save its value
+    Node* node = this->m_popFront();
+    T temp = node->data;
     
     // Clear node
-    Node* node = (Node*)this->m_data->next;
-    delete this->m_data;
+    this->m_destroy(node);
 
-    if (node == nullptr) {
-        this->m_data = nullptr;
-        return temp;
+    return temp;
+}
+
+template<typename T, typename TContainer>
+T& cslib::Stack<T, TContainer>::push(const T& p_data) {
+    Node* node = nullptr;
+    
+    try {
+        node = this->m_create(p_data);
+    } catch (const LinkedListNodeCantCreate&) {
+        throw StackOverflow();
     }
 
-    // Save new root
-    this->m_data = node;
+    // Becomes the new root
+    this->m_pushFront(node);
+    return node->data;
+}
 
-    return temp;
+template<typename T, typename TContainer>
+typename cslib::Stack<T, TContainer>::Iterator cslib::Stack<T, TContainer>::begin() {
+    return cslib::LinkedList<T>::begin();
 }
 
+template<typename T, typename TContainer>
+typename cslib::Stack<T, TContainer>::ConstIterator cslib::Stack<T, TContainer>::cbegin() const {
+    return cslib::LinkedList<T>::cbegin();
+}
+
+template<typename T, typename TContainer>
+typename cslib::Stack<T, TContainer>::Iterator cslib::Stack<T, TContainer>::end() {
+    return cslib::LinkedList<T>::end();
+}
+
+template<typename T, typename TContainer>
+typename cslib::Stack<T, TContainer>::ConstIterator cslib::Stack<T, TContainer>::cend() const {
+    return cslib::LinkedList<T>::cend();
+}
+
+
+
+
+// Array backed
+
 template<typename T>
-T& cslib::Stack<T>::push(const T& p_data) {
-    // Get the current value
-    Node* next = (Node*)this->m_data;
+cslib::Stack<T, cslib::ArrayStack<T>>::Stack() : cslib::ArrayStack<T>() {
 
-    Node* node = nullptr;
-    
+}
+
+template<typename T>
+size_t cslib::Stack<T, cslib::ArrayStack<T>>::size() const {
+    return cslib::ArrayStack<T>::size();
+}
+
+template<typename T>
+bool cslib::Stack<T, cslib::ArrayStack<T>>::empty() const {
+    return cslib::ArrayStack<T>::empty();
+}
+
+template<typename T>
+T& cslib::Stack<T, cslib::ArrayStack<T>>::top() {
+    if (this->empty()) {
+        throw StackUnderflow();
+    }
+    return cslib::ArrayStack<T>::top();
+}
+
+template<typename T>
+const T& cslib::Stack<T, cslib::ArrayStack<T>>::top() const {
+    if (this->empty()) {
+        throw StackUnderflow();
+    }
+    return cslib::ArrayStack<T>::top();
+}
+
+template<typename T>
+T cslib::Stack<T, cslib::ArrayStack<T>>::pop() {
+    if (this->empty()) {
+        throw StackUnderflow();
+    }
+    return cslib::ArrayStack<T>::pop();
+}
+
+template<typename T>
+T& cslib::Stack<T, cslib::ArrayStack<T>>::push(const T& p_data) {
     try {
-        node = new Node;
-    } catch (const std::exception&) {
+        return cslib::ArrayStack<T>::push(p_data);
+    } catch (const std::bad_alloc&) {
         throw StackOverflow();
     }
+}
 
-    node->data = p_data;
-    node->next = next;
+template<typename T>
+void cslib::Stack<T, cslib::ArrayStack<T>>::reserve(size_t p_size) {
+    try {
+        cslib::ArrayStack<T>::reserve(p_size);
+    } catch (const std::bad_alloc&) {
+        throw StackOverflow();
+    }
+}
 
-    this->m_data = node;
-    return node->data;
+template<typename T>
+void cslib::Stack<T, cslib::ArrayStack<T>>::pushMany(const T* p_data, size_t p_count) {
+    try {
+        cslib::ArrayStack<T>::pushMany(p_data, p_count);
+    } catch (const std::bad_alloc&) {
+        throw StackOverflow();
+    }
+}
+
+template<typename T>
+size_t cslib::Stack<T, cslib::ArrayStack<T>>::popMany(T* p_data, size_t p_count) {
+    return cslib::ArrayStack<T>::popMany(p_data, p_count);
 }
 
 template<typename T>
-typename cslib::Stack<T>::Iterator cslib::Stack<T>::begin() {
-    return this->begin();
+typename cslib::Stack<T, cslib::ArrayStack<T>>::Iterator cslib::Stack<T, cslib::ArrayStack<T>>::begin() {
+    return cslib::ArrayStack<T>::begin();
 }
 
 template<typename T>
-typename cslib::Stack<T>::ConstIterator cslib::Stack<T>::cbegin() const {
-    return this->cbegin();
+typename cslib::Stack<T, cslib::ArrayStack<T>>::ConstIterator cslib::Stack<T, cslib::ArrayStack<T>>::cbegin() const {
+    return cslib::ArrayStack<T>::cbegin();
 }
 
 template<typename T>
-typename cslib::Stack<T>::Iterator cslib::Stack<T>::end() {
-    return this->end();
+typename cslib::Stack<T, cslib::ArrayStack<T>>::Iterator cslib::Stack<T, cslib::ArrayStack<T>>::end() {
+    return cslib::ArrayStack<T>::end();
 }
 
 template<typename T>
-typename cslib::Stack<T>::ConstIterator cslib::Stack<T>::cend() const {
-    return this->cend();
+typename cslib::Stack<T, cslib::ArrayStack<T>>::ConstIterator cslib::Stack<T, cslib::ArrayStack<T>>::cend() const {
+    return cslib::ArrayStack<T>::cend();
 }
 
 
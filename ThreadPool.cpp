@@ -0,0 +1,206 @@
+#include "ThreadPool.h"
+
+namespace cslib {
+    /**
+     * @struct ThreadPoolLocal
+     * @brief Which pool and worker the calling thread is, and its state for picking victims
+     **/
+    struct ThreadPoolLocal {
+        /// The pool the thread works for, nullptr if none
+        const ThreadPool* pool = nullptr;
+        /// Which worker it is
+        size_t index = 0;
+        /// For picking who to steal from
+        uint64_t seed = 0;
+    };
+
+    /**
+     * @fn ThreadPool_local
+     * @brief Gets what the calling thread knows about itself
+     * @return Returns the thread's own state
+     */
+    static ThreadPoolLocal& ThreadPool_local() {
+        thread_local ThreadPoolLocal local;
+        if (local.seed == 0) {
+            local.seed = 0x9E3779B97F4A7C15ull ^ reinterpret_cast<uintptr_t>(&local);
+        }
+        return local;
+    }
+}
+
+cslib::TaskGroup::TaskGroup() : m_pending(0), m_failed(false) {
+
+}
+
+bool cslib::TaskGroup::done() const {
+    return (this->m_pending.load(std::memory_order_acquire) == 0);
+}
+
+void cslib::TaskGroup::m_fail(std::exception_ptr p_exception) {
+    // Only the first one is kept, sync reads it after every task is done
+    bool expected = false;
+    if (this->m_failed.compare_exchange_strong(expected, true, std::memory_order_relaxed)) {
+        this->m_exception = p_exception;
+    }
+}
+
+cslib::ThreadPool::ThreadPool(size_t p_threads) : m_sharedCount(0), m_sleepers(0), m_stopping(false) {
+    if (p_threads == 0) {
+        p_threads = std::thread::hardware_concurrency();
+    }
+    this->m_threadCount = (p_threads == 0) ? 1 : p_threads;
+
+    this->m_workers = new Worker[this->m_threadCount];
+    for (size_t i = 0; i < this->m_threadCount; i++) {
+        this->m_workers[i].thread = std::thread(&ThreadPool::m_work, this, i);
+    }
+}
+
+cslib::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_stopping = true;
+    }
+    this->m_wake.notify_all();
+
+    for (size_t i = 0; i < this->m_threadCount; i++) {
+        this->m_workers[i].thread.join();
+    }
+    delete[] this->m_workers;
+}
+
+cslib::ThreadPool& cslib::ThreadPool::instance() {
+    static ThreadPool pool;
+    return pool;
+}
+
+size_t cslib::ThreadPool::threads() const {
+    return this->m_threadCount;
+}
+
+void cslib::ThreadPool::sync(TaskGroup& p_group) {
+    // Help out instead of blocking, whatever we run might be what we wait for
+    Worker* self = this->m_local();
+    while (!p_group.done()) {
+        if (!this->m_runOne(self)) {
+            std::this_thread::yield();
+        }
+    }
+
+    if (p_group.m_failed.load(std::memory_order_acquire)) {
+        std::exception_ptr exception = p_group.m_exception;
+        p_group.m_exception = nullptr;
+        p_group.m_failed.store(false, std::memory_order_relaxed);
+        std::rethrow_exception(exception);
+    }
+}
+
+cslib::ThreadPool::Worker* cslib::ThreadPool::m_local() const {
+    ThreadPoolLocal& local = ThreadPool_local();
+    return (local.pool == this) ? this->m_workers + local.index : nullptr;
+}
+
+void cslib::ThreadPool::m_push(Job* p_job) {
+    Worker* self = this->m_local();
+    if (self != nullptr) {
+        self->deque.push(p_job);
+    } else {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        this->m_shared.enqueue(p_job);
+        this->m_sharedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Pairs with the fence of a worker going to sleep, either it sees the task or we see it
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (this->m_sleepers.load(std::memory_order_relaxed) > 0) {
+        // Taking the lock makes sure the sleeper is waiting, not between its check and the wait
+        {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+        }
+        this->m_wake.notify_one();
+    }
+}
+
+bool cslib::ThreadPool::m_runOne(Worker* p_self) {
+    Job* job = nullptr;
+    bool found = (p_self != nullptr && p_self->deque.pop(job));
+
+    if (!found && this->m_sharedCount.load(std::memory_order_relaxed) > 0) {
+        std::lock_guard<std::mutex> lock(this->m_mutex);
+        if (!this->m_shared.empty()) {
+            job = this->m_shared.dequeue();
+            this->m_sharedCount.fetch_sub(1, std::memory_order_relaxed);
+            found = true;
+        }
+    }
+
+    if (!found) {
+        // Start at a random victim so thieves spread out
+        ThreadPoolLocal& local = ThreadPool_local();
+        local.seed ^= local.seed << 13;
+        local.seed ^= local.seed >> 7;
+        local.seed ^= local.seed << 17;
+        size_t start = (size_t)(local.seed % this->m_threadCount);
+        for (size_t i = 0; i < this->m_threadCount && !found; i++) {
+            Worker* victim = this->m_workers + (start + i) % this->m_threadCount;
+            if (victim != p_self) {
+                found = victim->deque.steal(job);
+            }
+        }
+    }
+
+    if (!found) {
+        return false;
+    }
+
+    job->run();
+    delete job;
+    return true;
+}
+
+bool cslib::ThreadPool::m_hasWork() const {
+    if (this->m_sharedCount.load(std::memory_order_relaxed) > 0) {
+        return true;
+    }
+    for (size_t i = 0; i < this->m_threadCount; i++) {
+        if (!this->m_workers[i].deque.empty()) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void cslib::ThreadPool::m_work(size_t p_index) {
+    ThreadPoolLocal& local = ThreadPool_local();
+    local.pool = this;
+    local.index = p_index;
+    Worker* self = this->m_workers + p_index;
+
+    size_t idle = 0;
+    while (true) {
+        if (this->m_runOne(self)) {
+            idle = 0;
+            continue;
+        }
+        if (++idle < THREADPOOL_SPINS) {
+            std::this_thread::yield();
+            continue;
+        }
+        idle = 0;
+
+        std::unique_lock<std::mutex> lock(this->m_mutex);
+        this->m_sleepers.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (this->m_hasWork()) {
+            this->m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+            continue;
+        }
+        if (this->m_stopping) {
+            this->m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+
+        this->m_wake.wait(lock);
+        this->m_sleepers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
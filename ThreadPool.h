@@ -0,0 +1,351 @@
+/**
+ * @file ThreadPool.h
+ * @brief Holds the ThreadPool, worker threads that steal work from each other, and the TaskGroup to wait on work spawned into it.
+ **/
+#ifndef CSTHREADPOOL_H
+#define CSTHREADPOOL_H
+
+#include "Universal.h"
+#include "Queue.h"
+#include "WorkStealingDeque.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+/// How many pieces per thread parallelFor cuts a range into at most, when no grain size is given.
+#define THREADPOOL_PIECES_PER_THREAD 16
+
+/// How many times an idle worker looks for work before it sleeps.
+#define THREADPOOL_SPINS 64
+
+namespace cslib {
+    class ThreadPool;
+
+    /**
+     * @class TaskGroup
+     * @brief Counts the tasks spawned into it, ThreadPool::sync waits until they're all done.
+     *
+     * The first exception a task throws is kept and thrown again by sync. A group has to be
+     * synced before it's destroyed.
+     **/
+    class TaskGroup {
+    public:
+        /**
+         * @brief Constructs a group with nothing in it
+         */
+        TaskGroup();
+
+        /// The tasks point at it
+        TaskGroup(const TaskGroup&) = delete;
+        TaskGroup& operator= (const TaskGroup&) = delete;
+
+        /**
+         * @brief Tests if every task spawned into it is done
+         * @return Returns true if done
+         */
+        bool done() const;
+
+    protected:
+        /**
+         * @param p_exception What the task threw
+         *
+         * @brief Keeps the exception if it's the first one
+         */
+        void m_fail(std::exception_ptr p_exception);
+
+        /// How many tasks aren't done yet
+        std::atomic<size_t> m_pending;
+
+        /// If an exception was kept
+        std::atomic<bool> m_failed;
+
+        /// The first exception a task threw
+        std::exception_ptr m_exception;
+
+        friend class ThreadPool;
+    };
+
+    /**
+     * @class ThreadPool
+     * @brief Worker threads with a WorkStealingDeque each, idle workers steal from a random other one.
+     *
+     * A task spawned from a worker goes on the bottom of its own deque, so the worker goes on with
+     * what it just made while it's still in cache, and the others steal the oldest, usually biggest,
+     * pieces from the top. Tasks from threads outside the pool go in one shared queue. Waiting in
+     * sync runs other tasks instead of blocking, so recursive fork-join never runs out of threads.
+     * Idle workers look for work a few times and then sleep until a task is pushed.
+     *
+     * submit returns a future, blocking on it inside a task holds the worker, use spawn and sync there.
+     **/
+    class ThreadPool {
+    public:
+        /**
+         * @param p_threads How many workers, 0 for one per hardware thread
+         *
+         * @brief Constructs the pool and starts its workers
+         */
+        explicit ThreadPool(size_t p_threads = 0);
+
+        /**
+         * @brief Runs every task left and joins the workers
+         */
+        ~ThreadPool();
+
+        /// The workers are running on it
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator= (const ThreadPool&) = delete;
+
+        /**
+         * @brief Gets the pool shared by everyone, made on first use with one worker per hardware thread
+         * @return Returns the pool
+         */
+        static ThreadPool& instance();
+
+        /**
+         * @brief Gets how many workers there are
+         * @return Returns the amount of workers
+         */
+        size_t threads() const;
+
+        /**
+         * @param p_func What to run, takes nothing
+         *
+         * @brief Runs the function on the pool
+         * @return Returns a future for what it returns or throws
+         */
+        template<typename TF>
+        auto submit(TF&& p_func) -> std::future<decltype(p_func())>;
+
+        /**
+         * @param p_group The group that waits for it
+         * @param p_func What to run, takes nothing and returns nothing
+         *
+         * @brief Runs the function on the pool, sync on the group waits for it
+         */
+        template<typename TF>
+        void spawn(TaskGroup& p_group, TF&& p_func);
+
+        /**
+         * @param p_group The group
+         *
+         * @brief Runs tasks until everything spawned into the group is done, then throws what they threw first
+         */
+        void sync(TaskGroup& p_group);
+
+        /**
+         * @param p_begin The first index
+         * @param p_end One past the last index
+         * @param p_func What to run on each index, takes a size_t
+         * @param p_grain The fewest indices run as one piece, 0 to pick from the size and the threads
+         *
+         * @brief Runs the function on every index in parallel and waits for them
+         *
+         * A piece only splits off its second half while its own worker has nothing waiting to be
+         * stolen, so ranges are cut finely when workers are idle and hardly at all when they're busy.
+         */
+        template<typename TF>
+        void parallelFor(size_t p_begin, size_t p_end, TF&& p_func, size_t p_grain = 0);
+
+    protected:
+        /**
+         * @class Job
+         * @brief A task in a deque, runs once and is deleted
+         **/
+        class Job {
+        public:
+            virtual ~Job() {}
+
+            /**
+             * @brief Runs the task
+             */
+            virtual void run() = 0;
+        };
+
+        /**
+         * @class SubmitJob
+         * @brief A submitted task, the future gets what it returns
+         **/
+        template<typename R>
+        class SubmitJob : public Job {
+        public:
+            SubmitJob(std::packaged_task<R()>&& p_task) : task(std::move(p_task)) {}
+
+            void run() override { this->task(); }
+
+            /// The function and its promise
+            std::packaged_task<R()> task;
+        };
+
+        /**
+         * @class SpawnJob
+         * @brief A spawned task, counts itself off its group when done
+         **/
+        template<typename TF>
+        class SpawnJob : public Job {
+        public:
+            SpawnJob(TaskGroup& p_group, TF&& p_func) : group(p_group), func(std::forward<TF>(p_func)) {}
+
+            void run() override {
+                try {
+                    this->func();
+                } catch (...) {
+                    this->group.m_fail(std::current_exception());
+                }
+                this->group.m_pending.fetch_sub(1, std::memory_order_release);
+            }
+
+            /// The group that waits for it
+            TaskGroup& group;
+
+            /// The function
+            typename std::decay<TF>::type func;
+        };
+
+        /**
+         * @struct Worker
+         * @brief A thread and the deque it works from
+         **/
+        struct Worker {
+            /// Tasks it spawned
+            WorkStealingDeque<Job*> deque;
+            /// The thread
+            std::thread thread;
+        };
+
+        /**
+         * @brief Gets the worker of the calling thread
+         * @return Returns the worker, nullptr if the thread isn't one of ours
+         */
+        Worker* m_local() const;
+
+        /**
+         * @param p_job The task
+         *
+         * @brief Puts a task on our deque, or in the shared queue if we aren't a worker, and wakes a sleeper
+         */
+        void m_push(Job* p_job);
+
+        /**
+         * @param p_self The worker of the calling thread, nullptr if none
+         *
+         * @brief Runs one task, our own newest, then a shared one, then one stolen from a random worker
+         * @return Returns false if it found none
+         */
+        bool m_runOne(Worker* p_self);
+
+        /**
+         * @brief Tests if any task is waiting anywhere
+         * @return Returns true if there is one
+         */
+        bool m_hasWork() const;
+
+        /**
+         * @param p_index Which worker we are
+         *
+         * @brief What each worker runs until the pool stops
+         */
+        void m_work(size_t p_index);
+
+        /**
+         * @param p_group The group the pieces are spawned into
+         * @param p_begin The first index
+         * @param p_end One past the last index
+         * @param p_grain The fewest indices run as one piece
+         * @param p_func What to run on each index
+         *
+         * @brief Runs a range, splitting off halves while our deque is empty
+         */
+        template<typename TF>
+        void m_for(TaskGroup& p_group, size_t p_begin, size_t p_end, size_t p_grain, TF& p_func);
+
+        /// The workers
+        Worker* m_workers;
+
+        /// How many workers
+        size_t m_threadCount;
+
+        /// Tasks from threads outside the pool
+        Queue<Job*, RingBuffer<Job*>> m_shared;
+
+        /// How many tasks are in the shared queue, read without the lock
+        std::atomic<size_t> m_sharedCount;
+
+        /// How many workers sleep or are about to
+        std::atomic<size_t> m_sleepers;
+
+        /// If the workers should stop once there's no work
+        bool m_stopping;
+
+        /// Guards the shared queue, sleeping and stopping
+        std::mutex m_mutex;
+
+        /// Sleeping workers wait here
+        std::condition_variable m_wake;
+    };
+}
+
+template<typename TF>
+auto cslib::ThreadPool::submit(TF&& p_func) -> std::future<decltype(p_func())> {
+    typedef decltype(p_func()) R;
+    SubmitJob<R>* job = new SubmitJob<R>(std::packaged_task<R()>(std::forward<TF>(p_func)));
+    std::future<R> future = job->task.get_future();
+    this->m_push(job);
+    return future;
+}
+
+template<typename TF>
+void cslib::ThreadPool::spawn(TaskGroup& p_group, TF&& p_func) {
+    p_group.m_pending.fetch_add(1, std::memory_order_relaxed);
+    this->m_push(new SpawnJob<TF>(p_group, std::forward<TF>(p_func)));
+}
+
+template<typename TF>
+void cslib::ThreadPool::parallelFor(size_t p_begin, size_t p_end, TF&& p_func, size_t p_grain) {
+    if (p_begin >= p_end) {
+        return;
+    }
+    if (p_grain == 0) {
+        p_grain = (p_end - p_begin) / (this->m_threadCount * THREADPOOL_PIECES_PER_THREAD);
+        if (p_grain == 0) {
+            p_grain = 1;
+        }
+    }
+
+    TaskGroup group;
+    try {
+        this->m_for(group, p_begin, p_end, p_grain, p_func);
+    } catch (...) {
+        group.m_fail(std::current_exception());
+    }
+    this->sync(group);
+}
+
+template<typename TF>
+void cslib::ThreadPool::m_for(TaskGroup& p_group, size_t p_begin, size_t p_end, size_t p_grain, TF& p_func) {
+    Worker* self = this->m_local();
+    while (p_begin < p_end) {
+        // Only split while nobody could steal from us anyway
+        if (p_end - p_begin > p_grain && (self == nullptr || self->deque.empty())) {
+            size_t middle = p_begin + (p_end - p_begin) / 2;
+            size_t end = p_end;
+            this->spawn(p_group, [this, &p_group, middle, end, p_grain, &p_func]() {
+                this->m_for(p_group, middle, end, p_grain, p_func);
+            });
+            p_end = middle;
+            continue;
+        }
+
+        size_t stop = (p_end - p_begin > p_grain) ? p_begin + p_grain : p_end;
+        for (; p_begin < stop; p_begin++) {
+            p_func(p_begin);
+        }
+    }
+}
+
+
+#endif
@@ -0,0 +1,691 @@
+/**
+ * @file UnrolledList.h
+ * @brief Holds the UnrolledList data structure, a linked list of small arrays.
+ **/
+#ifndef CSUNROLLEDLIST_H
+#define CSUNROLLEDLIST_H
+
+#include "Universal.h"
+#include "LinkedList.h"
+
+/// The bytes a node aims to take up, two cache lines.
+#define UNROLLEDLIST_NODE_BYTES 128
+
+/// How many values of a type fit in a node after the next pointer and the count.
+#define UNROLLEDLIST_FIT(T) \
+    (((UNROLLEDLIST_NODE_BYTES - sizeof(void*) - sizeof(size_t)) / sizeof(T) < 4) ? 4 : \
+      (UNROLLEDLIST_NODE_BYTES - sizeof(void*) - sizeof(size_t)) / sizeof(T))
+
+namespace cslib {
+    /**
+     * @class UnrolledList
+     * @tparam T Type of the data structure.
+     * @brief A list where every node holds a cache line sized array of values.
+     *
+     * Works like a LinkedList, but walking it reads whole arrays at a time. Nodes are split
+     * when an insert fills them and merged with their neighbour when they fall under half full.
+     * Indexing a non-const list moves a cursor, const indexing only reads it so const readers can share the list.
+     **/
+    template<typename T>
+    class UnrolledList {
+    public:
+        /// How many values a node holds, never less than four
+        static constexpr size_t CAPACITY = UNROLLEDLIST_FIT(T);
+
+        /**
+         * @brief Constructs the class
+         */
+        UnrolledList();
+
+        /**
+         * @brief Deep copies the UnrolledList
+         */
+        UnrolledList(const UnrolledList<T>& p_list);
+
+        /**
+         * @brief Deep copies the UnrolledList.
+         * @return Returns "this" data structure
+         */
+        UnrolledList<T>& operator= (const UnrolledList<T>& p_list);
+
+        /**
+         * @brief Destroys the class
+         */
+        ~UnrolledList();
+
+        /**
+         * @brief Gets the size of the list
+         * @return Returns the amount of values in the list
+         */
+        size_t size() const;
+
+        /**
+         * @param p_index The index of the value we wish
+         *
+         * @brief Gets an index of a value in the list.
+         * @return Returns the value at the index.
+         */
+        T& operator[](size_t p_index);
+
+        /**
+         * @param p_index The index of the value we wish
+         *
+         * @brief Gets an index of a value in the list.
+         * @return Returns the value at the index.
+         */
+        const T& operator[](size_t p_index) const;
+
+        /**
+         * @param p_data The data we are adding
+         *
+         * @brief Adds the value to the far end.
+         * @return Returns the value just inserted.
+         */
+        T& append(const T& p_data);
+
+        /**
+         * @param p_data The data we are adding
+         * @param p_index The index we are inserting into.
+         *
+         * @brief Adds the value to the index given (p_index), splitting a full node
+         * @return Returns the value just inserted.
+         */
+        T& insert(const T& p_data, size_t p_index);
+
+        /**
+         * @param p_left The left hand index
+         * @param p_right The right hand index
+         *
+         * @brief Swaps the two values
+         */
+        void swap(size_t p_left, size_t p_right);
+
+        /**
+         * @param p_index The index we are removing
+         *
+         * @brief Deletes the index given, merging nodes that fall under half full
+         * @return Returns the value just removed.
+         */
+        T remove(size_t p_index);
+
+    protected:
+        /**
+         * @struct Node
+         * @brief A node holding a run of values
+         **/
+        struct Node {
+            /// The next node.
+            Node* next;
+
+            /// How many values are used.
+            size_t count;
+
+            /// The values.
+            T data[CAPACITY];
+        };
+
+        /**
+         * @param p_list The list to copy into "this"
+         *
+         * @brief Copies the right hand into this data structure.
+         */
+        void m_copy(const UnrolledList<T>& p_list);
+
+        /**
+         * @brief Deletes every node
+         */
+        void m_clear();
+
+        /**
+         * @brief Creates an empty node
+         * @return Returns the new node
+         */
+        Node* m_create();
+
+        /**
+         * @param p_index The index we are looking for, must be in range
+         * @param p_offset Set to where the index is inside the node
+         * @param p_last Set to the node before, or nullptr
+         *
+         * @brief Finds the node holding the index, walking from the cursor when it is behind and moving it there.
+         * @return Returns the node
+         */
+        Node* m_find(size_t p_index, size_t& p_offset, Node*& p_last);
+
+        /**
+         * @param p_index The index we are looking for, must be in range
+         * @param p_offset Set to where the index is inside the node
+         * @param p_last Set to the node before, or nullptr
+         *
+         * @brief Walks to the node holding the index from the cursor if it is behind, reads the cursor but never moves it so const readers don't race.
+         * @return Returns the node
+         */
+        Node* m_walk(size_t p_index, size_t& p_offset, Node*& p_last) const;
+
+        /**
+         * @param p_node The node we are splitting
+         *
+         * @brief Moves the top half of the node into a new node after it.
+         */
+        void m_split(Node* p_node);
+
+        /**
+         * @param p_node The node which might be too empty
+         * @param p_last The node before it, or nullptr
+         *
+         * @brief Fills or merges a node which fell under half full
+         */
+        void m_rebalance(Node* p_node, Node* p_last);
+
+        /// The first node
+        Node* m_data;
+
+        /// The last node
+        Node* m_last;
+
+        /// The amount of values
+        size_t m_size;
+
+        /// The node we found last
+        Node* m_cursor;
+
+        /// The node before the cursor
+        Node* m_cursorLast;
+
+        /// The index of the first value in the cursor
+        size_t m_cursorIndex;
+
+    public:
+        /**
+         * @class Iterator
+         * @brief The iterator for an unrolled list.
+         **/
+        class Iterator : public cslib::Iterator<T> {
+        public:
+            /**
+             * @param p_node The node of the iterator
+             * @param p_offset The place in the node
+             *
+             * @brief Constructs the Iterator
+             */
+            Iterator(Node* p_node, size_t p_offset);
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            Iterator& operator++();
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            Iterator  operator++(int);
+
+        private:
+            /// The node we're in
+            Node* m_node;
+
+            /// Where we are in the node
+            size_t m_offset;
+        };
+
+        /**
+         * @class ConstIterator
+         * @brief The iterator for an unrolled list.
+         **/
+        class ConstIterator : public cslib::ConstIterator<T> {
+        public:
+            /**
+             * @param p_node The node of the iterator
+             * @param p_offset The place in the node
+             *
+             * @brief Constructs the Iterator
+             */
+            ConstIterator(const Node* p_node, size_t p_offset);
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            ConstIterator& operator++();
+
+            /**
+             * @brief Gets the next iterator
+             * @return Returns the value that was next
+             */
+            ConstIterator  operator++(int);
+
+        private:
+            /// The node we're in
+            const Node* m_node;
+
+            /// Where we are in the node
+            size_t m_offset;
+        };
+
+        /**
+         * @brief Gets the iterator to the front of the data structure.
+         * @return Returns a iterator to the value
+         */
+        Iterator begin();
+
+        /**
+         * @brief Gets the iterator to the front of the data structure.
+         * @return Returns a iterator to the value
+         */
+        ConstIterator cbegin() const;
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the value
+         */
+        Iterator end();
+
+        /**
+         * @brief Gets the iterator to the value after the back of the data structure.
+         * @return Returns a iterator to the value
+         */
+        ConstIterator cend() const;
+    };
+}
+
+template<typename T>
+cslib::UnrolledList<T>::UnrolledList() : m_data(nullptr), m_last(nullptr), m_size(0), m_cursor(nullptr), m_cursorLast(nullptr), m_cursorIndex(0) {
+
+}
+
+template<typename T>
+cslib::UnrolledList<T>::UnrolledList(const UnrolledList<T>& p_list) : m_data(nullptr), m_last(nullptr), m_size(0), m_cursor(nullptr), m_cursorLast(nullptr), m_cursorIndex(0) {
+    this->m_copy(p_list);
+}
+
+template<typename T>
+cslib::UnrolledList<T>& cslib::UnrolledList<T>::operator= (const UnrolledList<T>& p_list) {
+    if (this != &p_list) {
+        this->m_clear();
+        this->m_copy(p_list);
+    }
+    return *this;
+}
+
+template<typename T>
+cslib::UnrolledList<T>::~UnrolledList() {
+    this->m_clear();
+}
+
+template<typename T>
+size_t cslib::UnrolledList<T>::size() const {
+    return this->m_size;
+}
+
+template<typename T>
+T& cslib::UnrolledList<T>::operator[](size_t p_index) {
+    if (p_index >= this->m_size) {
+        throw OutOfRange();
+    }
+
+    size_t offset;
+    Node* last;
+    Node* node = this->m_find(p_index, offset, last);
+    return node->data[offset];
+}
+
+template<typename T>
+const T& cslib::UnrolledList<T>::operator[](size_t p_index) const {
+    if (p_index >= this->m_size) {
+        throw OutOfRange();
+    }
+
+    size_t offset;
+    Node* last;
+    const Node* node = this->m_walk(p_index, offset, last);
+    return node->data[offset];
+}
+
+template<typename T>
+T& cslib::UnrolledList<T>::append(const T& p_data) {
+    // Start a new node if the last is full
+    if (this->m_last == nullptr || this->m_last->count == CAPACITY) {
+        Node* node = this->m_create();
+        if (this->m_last == nullptr) {
+            this->m_data = node;
+        } else {
+            this->m_last->next = node;
+        }
+        this->m_last = node;
+    }
+
+    // Add to the end of the last node
+    Node* node = this->m_last;
+    T& value = node->data[node->count];
+    value = p_data;
+    node->count++;
+    this->m_size++;
+    return value;
+}
+
+template<typename T>
+T& cslib::UnrolledList<T>::insert(const T& p_data, size_t p_index) {
+    // Bound check
+    if (p_index > this->m_size) {
+        throw OutOfRange();
+    }
+
+    // The end is just an append
+    if (p_index == this->m_size) {
+        return this->append(p_data);
+    }
+
+    // Find the node holding the index
+    size_t offset;
+    Node* last;
+    Node* node = this->m_find(p_index, offset, last);
+    size_t start = p_index - offset;
+
+    // Make room
+    if (node->count == CAPACITY) {
+        this->m_split(node);
+        if (offset > node->count) {
+            offset -= node->count;
+            start += node->count;
+            last = node;
+            node = node->next;
+        }
+    }
+
+    // Move the values after along
+    for (size_t i = node->count; i > offset; i--) {
+        node->data[i] = node->data[i - 1];
+    }
+
+    node->data[offset] = p_data;
+    node->count++;
+    this->m_size++;
+
+    // Nodes after this one have moved along, so the cursor stays on it
+    this->m_cursor = node;
+    this->m_cursorLast = last;
+    this->m_cursorIndex = start;
+    return node->data[offset];
+}
+
+template<typename T>
+void cslib::UnrolledList<T>::swap(size_t p_left, size_t p_right) {
+    // If both are the same...
+    if (p_left == p_right) {
+        return;
+    }
+
+    T& left = (*this)[p_left];
+    T& right = (*this)[p_right];
+
+    T temp = left;
+    left = right;
+    right = temp;
+}
+
+template<typename T>
+T cslib::UnrolledList<T>::remove(size_t p_index) {
+    // Check if we're in range
+    if (p_index >= this->m_size) {
+        throw OutOfRange();
+    }
+
+    // Find the node holding the index
+    size_t offset;
+    Node* last;
+    Node* node = this->m_find(p_index, offset, last);
+    const size_t start = p_index - offset;
+
+    // Move the values after back
+    T temp = node->data[offset];
+    for (size_t i = offset; i + 1 < node->count; i++) {
+        node->data[i] = node->data[i + 1];
+    }
+    node->count--;
+    this->m_size--;
+
+    // Nodes after this one have moved back, so the cursor stays on it unless it is going
+    if (node->count == 0) {
+        this->m_cursor = nullptr;
+    } else {
+        this->m_cursor = node;
+        this->m_cursorLast = last;
+        this->m_cursorIndex = start;
+    }
+    this->m_rebalance(node, last);
+    return temp;
+}
+
+template<typename T>
+void cslib::UnrolledList<T>::m_copy(const UnrolledList<T>& p_list) {
+    // Copy node by node, keeping the same layout
+    for (const Node* node = p_list.m_data; node != nullptr; node = node->next) {
+        Node* copy = this->m_create();
+        for (size_t i = 0; i < node->count; i++) {
+            copy->data[i] = node->data[i];
+        }
+        copy->count = node->count;
+
+        if (this->m_last == nullptr) {
+            this->m_data = copy;
+        } else {
+            this->m_last->next = copy;
+        }
+        this->m_last = copy;
+    }
+
+    this->m_size = p_list.m_size;
+}
+
+template<typename T>
+void cslib::UnrolledList<T>::m_clear() {
+    Node* node = this->m_data;
+    while (node != nullptr) {
+        Node* next = node->next;
+        delete node;
+        node = next;
+    }
+
+    this->m_data = nullptr;
+    this->m_last = nullptr;
+    this->m_size = 0;
+    this->m_cursor = nullptr;
+}
+
+template<typename T>
+typename cslib::UnrolledList<T>::Node* cslib::UnrolledList<T>::m_create() {
+    // Creates a new node
+    try {
+        Node* node = new Node();
+        node->next = nullptr;
+        node->count = 0;
+        return node;
+    } catch (std::exception&) {
+        throw LinkedListNodeCantCreate();
+    }
+}
+
+template<typename T>
+typename cslib::UnrolledList<T>::Node* cslib::UnrolledList<T>::m_find(size_t p_index, size_t& p_offset, Node*& p_last) {
+    Node* node = this->m_walk(p_index, p_offset, p_last);
+
+    // Remember where we are
+    this->m_cursor = node;
+    this->m_cursorLast = p_last;
+    this->m_cursorIndex = p_index - p_offset;
+    return node;
+}
+
+template<typename T>
+typename cslib::UnrolledList<T>::Node* cslib::UnrolledList<T>::m_walk(size_t p_index, size_t& p_offset, Node*& p_last) const {
+    // Start from the cursor if it is behind, otherwise from the front
+    size_t start = 0;
+    Node* last = nullptr;
+    Node* node = this->m_data;
+    if (this->m_cursor != nullptr && this->m_cursorIndex <= p_index) {
+        start = this->m_cursorIndex;
+        last = this->m_cursorLast;
+        node = this->m_cursor;
+    }
+
+    // Skip whole nodes
+    while (p_index >= start + node->count) {
+        start += node->count;
+        last = node;
+        node = node->next;
+    }
+
+    p_offset = p_index - start;
+    p_last = last;
+    return node;
+}
+
+template<typename T>
+void cslib::UnrolledList<T>::m_split(Node* p_node) {
+    // Move the top half into a new node
+    Node* node = this->m_create();
+    const size_t half = p_node->count / 2;
+    for (size_t i = half; i < p_node->count; i++) {
+        node->data[i - half] = p_node->data[i];
+    }
+    node->count = p_node->count - half;
+    p_node->count = half;
+
+    // Link it in after
+    node->next = p_node->next;
+    p_node->next = node;
+    if (this->m_last == p_node) {
+        this->m_last = node;
+    }
+}
+
+template<typename T>
+void cslib::UnrolledList<T>::m_rebalance(Node* p_node, Node* p_last) {
+    // Empty nodes are unlinked
+    if (p_node->count == 0) {
+        if (p_last == nullptr) {
+            this->m_data = p_node->next;
+        } else {
+            p_last->next = p_node->next;
+        }
+        if (this->m_last == p_node) {
+            this->m_last = p_last;
+        }
+        delete p_node;
+        return;
+    }
+
+    // Only bother while under half full and there is a next
+    Node* next = p_node->next;
+    if (p_node->count >= CAPACITY / 2 || next == nullptr) {
+        return;
+    }
+
+    // If both fit in one node, merge them
+    if (p_node->count + next->count <= CAPACITY) {
+        for (size_t i = 0; i < next->count; i++) {
+            p_node->data[p_node->count + i] = next->data[i];
+        }
+        p_node->count += next->count;
+        p_node->next = next->next;
+        if (this->m_last == next) {
+            this->m_last = p_node;
+        }
+        delete next;
+        return;
+    }
+
+    // Otherwise borrow from the front of the next
+    const size_t move = (next->count - p_node->count) / 2;
+    for (size_t i = 0; i < move; i++) {
+        p_node->data[p_node->count + i] = next->data[i];
+    }
+    for (size_t i = move; i < next->count; i++) {
+        next->data[i - move] = next->data[i];
+    }
+    p_node->count += move;
+    next->count -= move;
+}
+
+template<typename T>
+typename cslib::UnrolledList<T>::Iterator cslib::UnrolledList<T>::begin() {
+    return Iterator(this->m_data, 0);
+}
+
+template<typename T>
+typename cslib::UnrolledList<T>::ConstIterator cslib::UnrolledList<T>::cbegin() const {
+    return ConstIterator(this->m_data, 0);
+}
+
+template<typename T>
+typename cslib::UnrolledList<T>::Iterator cslib::UnrolledList<T>::end() {
+    return Iterator(nullptr, 0);
+}
+
+template<typename T>
+typename cslib::UnrolledList<T>::ConstIterator cslib::UnrolledList<T>::cend() const {
+    return ConstIterator(nullptr, 0);
+}
+
+
+
+
+
+
+
+
+
+
+
+template<typename T>
+cslib::UnrolledList<T>::Iterator::Iterator(Node* p_node, size_t p_offset) : m_node(p_node), m_offset(p_offset) {
+    this->m_ptr = (p_node != nullptr) ? &p_node->data[p_offset] : nullptr;
+}
+
+template<typename T>
+typename cslib::UnrolledList<T>::Iterator& cslib::UnrolledList<T>::Iterator::operator++() {
+    // Next in the node, or the start of the next node
+    this->m_offset++;
+    if (this->m_offset == this->m_node->count) {
+        this->m_node = this->m_node->next;
+        this->m_offset = 0;
+    }
+    this->m_ptr = (this->m_node != nullptr) ? &this->m_node->data[this->m_offset] : nullptr;
+    return *this;
+}
+
+template<typename T>
+typename cslib::UnrolledList<T>::Iterator cslib::UnrolledList<T>::Iterator::operator++(int) {
+    Iterator cpy = *this;
+    ++(*this);
+    return cpy;
+}
+
+template<typename T>
+cslib::UnrolledList<T>::ConstIterator::ConstIterator(const Node* p_node, size_t p_offset) : m_node(p_node), m_offset(p_offset) {
+    this->m_ptr = (p_node != nullptr) ? &p_node->data[p_offset] : nullptr;
+}
+
+template<typename T>
+typename cslib::UnrolledList<T>::ConstIterator& cslib::UnrolledList<T>::ConstIterator::operator++() {
+    // Next in the node, or the start of the next node
+    this->m_offset++;
+    if (this->m_offset == this->m_node->count) {
+        this->m_node = this->m_node->next;
+        this->m_offset = 0;
+    }
+    this->m_ptr = (this->m_node != nullptr) ? &this->m_node->data[this->m_offset] : nullptr;
+    return *this;
+}
+
+template<typename T>
+typename cslib::UnrolledList<T>::ConstIterator cslib::UnrolledList<T>::ConstIterator::operator++(int) {
+    ConstIterator cpy = *this;
+    ++(*this);
+    return cpy;
+}
+
+
+#endif
@@ -79,6 +79,19 @@ namespace cslib {
          */
         T& push(const T& p_value);
 
+        /**
+         * @param p_size The amount of elements we want room for
+         *
+         * @brief Allocates enough room for the amount of elements, doesn't change the size.
+         */
+        void reserve(size_t p_size);
+
+        /**
+         * @param p_size The size the user will see
+         *
+         * @brief Changes the size of the vector, growing the allocation if needed.
+         */
+        void resize(size_t p_size);
 
 
         class Iterator : public cslib::Iterator<T> {
@@ -197,7 +210,7 @@ cslib::Vector<T>::Vector(const Vector<T>& p_vector) {
     this->m_allocatedSize = p_vector.m_allocatedSize;
     this->m_size = p_vector.m_size;
     // Copy all the data over
-    this->copy(p_vector.m_array, p_vector.m_size);
+    this->m_copy(p_vector.m_array, p_vector.m_size);
 }
 
 template<class T>
@@ -225,6 +238,20 @@ T& cslib::Vector<T>::push(const T& p_value) {
     return this->m_array[this->m_size - 1];
 }
 
+template<class T>
+void cslib::Vector<T>::reserve(size_t p_size) {
+    // Only grow, never shrink the allocation
+    if (p_size > this->m_allocatedSize) {
+        this->m_resize(p_size);
+    }
+}
+
+template<class T>
+void cslib::Vector<T>::resize(size_t p_size) {
+    // Make sure we have room, then show the user the new size
+    this->reserve(p_size);
+    this->m_size = p_size;
+}
 
 template<class T>
 T& cslib::Vector<T>::operator[](size_t p_index) {
@@ -302,8 +329,9 @@ void cslib::Vector<T>::m_resize(size_t p_size) {
 
 template<class T>
 void cslib::Vector<T>::m_copy(T* p_array, size_t p_size) {
-    // Redefine the array
-    this->m_array = new T[p_size];
+    // Redefine the array, the old one is no longer needed
+    delete[] this->m_array;
+    this->m_array = new T[this->m_allocatedSize];
     // Save values into the old array location
     for (size_t i = 0; i < p_size; i++) {
         // Add into the array
@@ -0,0 +1,13 @@
+#include "VectorLoader.h"
+
+const char* cslib::ParseException::what() const throw() {
+    return "Parse Exception!";
+}
+
+const char* cslib::ParseInvalidNumber::what() const throw() {
+    return "Text is not a valid number!";
+}
+
+const char* cslib::ParseFileNotFound::what() const throw() {
+    return "File could not be read!";
+}
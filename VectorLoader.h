@@ -0,0 +1,495 @@
+/**
+ * @file VectorLoader.h
+ * @brief Loads delimited numbers from text straight into a Vector.
+ **/
+
+#ifndef CSVECTORLOADER_H
+#define CSVECTORLOADER_H
+
+#include "Universal.h"
+#include "Vector.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <charconv>
+#include <limits>
+#include <thread>
+#include <type_traits>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace cslib {
+    /**
+     * @class ParseException
+     * @brief Base for all exceptions thrown when parsing text
+     **/
+    class ParseException : public Exception {
+    public:
+        const char* what() const throw();
+    };
+
+    /**
+     * @class ParseInvalidNumber
+     * @brief Thrown when a token in the text isn't a number of the requested type
+     **/
+    class ParseInvalidNumber : public ParseException {
+    public:
+        const char* what() const throw();
+    };
+
+    /**
+     * @class ParseFileNotFound
+     * @brief Thrown when the file we're loading can't be opened or read
+     **/
+    class ParseFileNotFound : public ParseException {
+    public:
+        const char* what() const throw();
+    };
+
+    /**
+     * @class NumberParser
+     * @tparam T The number type we're reading (integral or floating point)
+     * @brief Reads delimited numbers out of a text buffer, eight bytes at a time.
+     **/
+    template<typename T>
+    class NumberParser {
+    public:
+        /**
+         * @param p_text The text we're reading
+         * @param p_length The amount of characters in the text
+         * @param p_delimiter The character between numbers, whitespace also separates
+         *
+         * @brief Counts the numbers in the text without parsing them
+         * @return Returns the amount of tokens in the text
+         */
+        static size_t count(const char* p_text, size_t p_length, char p_delimiter);
+
+        /**
+         * @param p_text The text we're reading
+         * @param p_length The amount of characters in the text
+         * @param p_delimiter The character between numbers, whitespace also separates
+         * @param p_out Where the numbers are written, must have room for every token
+         *
+         * @brief Parses every token in the text into the output
+         * @return Returns the amount of numbers written
+         */
+        static size_t parse(const char* p_text, size_t p_length, char p_delimiter, T* p_out);
+
+        /**
+         * @param p_char The character we're checking
+         * @param p_delimiter The delimiter of the text
+         *
+         * @brief Checks if the character separates two numbers
+         * @return Returns true if it is whitespace or the delimiter
+         */
+        static bool isSeparator(char p_char, char p_delimiter);
+
+    private:
+        /**
+         * @param p_first The first character of the token
+         * @param p_last The character after the token
+         * @param p_out The number we're writing into
+         *
+         * @brief Parses a single integral token
+         */
+        static void ms_parseToken(const char* p_first, const char* p_last, T& p_out, std::true_type);
+
+        /**
+         * @param p_first The first character of the token
+         * @param p_last The character after the token
+         * @param p_out The number we're writing into
+         *
+         * @brief Parses a single floating point token, correctly rounded
+         */
+        static void ms_parseToken(const char* p_first, const char* p_last, T& p_out, std::false_type);
+
+        /**
+         * @param p_word Eight characters loaded as one word
+         * @param p_delimiter The delimiter of the text
+         *
+         * @brief Marks every byte of the word which is a separator
+         * @return Returns the word with the high bit set in each separator byte
+         */
+        static uint64_t ms_separators(uint64_t p_word, char p_delimiter);
+
+        /**
+         * @param p_word Eight characters loaded as one word
+         *
+         * @brief Checks that all eight characters are digits
+         * @return Returns true if every byte is between '0' and '9'
+         */
+        static bool ms_isEightDigits(uint64_t p_word);
+
+        /**
+         * @param p_word Eight digit characters loaded as one word
+         *
+         * @brief Turns eight digit characters into their value
+         * @return Returns the value of the digits
+         */
+        static uint32_t ms_parseEightDigits(uint64_t p_word);
+    };
+
+    /**
+     * @fn Vector_parse
+     * @tparam T The number type of the vector
+     * @param p_text The text we're reading
+     * @param p_length The amount of characters in the text
+     * @param p_vector The vector the numbers are added to the back of
+     * @param p_delimiter The character between numbers, whitespace also separates
+     *
+     * @brief Parses delimited numbers into the vector, big texts are split across threads.
+     * @return Returns the amount of numbers added
+     */
+    template<typename T>
+    size_t Vector_parse(const char* p_text, size_t p_length, Vector<T>& p_vector, char p_delimiter = ',');
+
+    /**
+     * @fn Vector_load
+     * @tparam T The number type of the vector
+     * @param p_path The path of the file we're reading
+     * @param p_vector The vector the numbers are added to the back of
+     * @param p_delimiter The character between numbers, whitespace also separates
+     *
+     * @brief Reads the whole file in one go and parses it into the vector.
+     * @return Returns the amount of numbers added
+     */
+    template<typename T>
+    size_t Vector_load(const char* p_path, Vector<T>& p_vector, char p_delimiter = ',');
+}
+
+/// Texts smaller than this are parsed on the calling thread.
+#define VECTOR_PARSE_PARALLEL_MIN (1 << 20)
+
+/// Broadcasts a byte to all eight bytes of a word.
+#define VECTOR_PARSE_BROADCAST(x) (0x0101010101010101ULL * (uint8_t)(x))
+
+template<typename T>
+size_t cslib::NumberParser<T>::count(const char* p_text, size_t p_length, char p_delimiter) {
+    // A token starts at every non separator that follows a separator.
+    // Anything before the text counts as a separator.
+    size_t n = 0;
+    uint64_t lastSeparator = 0x80;
+    size_t i = 0;
+
+    // Eight bytes at a time
+    for (; i + 8 <= p_length; i += 8) {
+        uint64_t word;
+        memcpy(&word, p_text + i, 8);
+
+        const uint64_t separators = ms_separators(word, p_delimiter);
+        const uint64_t tokens = ~separators & 0x8080808080808080ULL;
+
+        // Shift so that each byte sees the byte before it
+        const uint64_t before = (separators << 8) | lastSeparator;
+        uint64_t starts = tokens & before;
+
+#if defined(_MSC_VER)
+        n += (size_t)__popcnt64(starts);
+#elif defined(__GNUC__)
+        n += (size_t)__builtin_popcountll(starts);
+#else
+        while (starts != 0) {
+            starts &= starts - 1;
+            n++;
+        }
+#endif
+
+        lastSeparator = (separators >> 56) & 0x80;
+    }
+
+    // The tail
+    bool wasSeparator = (lastSeparator != 0);
+    for (; i < p_length; i++) {
+        bool separator = isSeparator(p_text[i], p_delimiter);
+        if (!separator && wasSeparator) {
+            n++;
+        }
+        wasSeparator = separator;
+    }
+
+    return n;
+}
+
+template<typename T>
+size_t cslib::NumberParser<T>::parse(const char* p_text, size_t p_length, char p_delimiter, T* p_out) {
+    const char* it = p_text;
+    const char* end = p_text + p_length;
+    size_t n = 0;
+
+    while (it != end) {
+        // Skip the separators, eight at a time while we can
+        while (it + 8 <= end) {
+            uint64_t word;
+            memcpy(&word, it, 8);
+            if (ms_separators(word, p_delimiter) != 0x8080808080808080ULL) {
+                break;
+            }
+            it += 8;
+        }
+        while (it != end && isSeparator(*it, p_delimiter)) {
+            it++;
+        }
+        if (it == end) {
+            break;
+        }
+
+        // Find the end of the token
+        const char* first = it;
+        while (it != end && !isSeparator(*it, p_delimiter)) {
+            it++;
+        }
+
+        ms_parseToken(first, it, p_out[n], std::is_integral<T>());
+        n++;
+    }
+
+    return n;
+}
+
+template<typename T>
+void cslib::NumberParser<T>::ms_parseToken(const char* p_first, const char* p_last, T& p_out, std::true_type) {
+    // Sign
+    bool negative = false;
+    if (*p_first == '-' || *p_first == '+') {
+        negative = (*p_first == '-');
+        p_first++;
+
+        if (negative && !std::is_signed<T>::value) {
+            throw ParseInvalidNumber();
+        }
+    }
+    if (p_first == p_last) {
+        throw ParseInvalidNumber();
+    }
+
+    // Leading zeros don't count towards the digit limit
+    while (p_last - p_first > 1 && *p_first == '0') {
+        p_first++;
+    }
+
+    // 20 digits might still fit in 64 bits, the last ones are checked below
+    const size_t digits = (size_t)(p_last - p_first);
+    if (digits > 20) {
+        throw ParseInvalidNumber();
+    }
+
+    // Eight digits at a time
+    uint64_t value = 0;
+    while (p_last - p_first >= 8) {
+        uint64_t word;
+        memcpy(&word, p_first, 8);
+        if (!ms_isEightDigits(word)) {
+            throw ParseInvalidNumber();
+        }
+
+        value = value * 100000000ULL + ms_parseEightDigits(word);
+        p_first += 8;
+    }
+
+    // The rest one at a time, only these can go past 64 bits
+    while (p_first != p_last) {
+        const uint8_t digit = (uint8_t)(*p_first - '0');
+        if (digit > 9 || value > (UINT64_MAX - digit) / 10) {
+            throw ParseInvalidNumber();
+        }
+
+        value = value * 10 + digit;
+        p_first++;
+    }
+
+    // Check that it fits in the type
+    typedef typename std::make_unsigned<T>::type Unsigned;
+    const uint64_t max = (uint64_t)std::numeric_limits<T>::max();
+    if (negative) {
+        if (value > max + 1) {
+            throw ParseInvalidNumber();
+        }
+        p_out = (T)(0 - (Unsigned)value);
+    } else {
+        if (value > max) {
+            throw ParseInvalidNumber();
+        }
+        p_out = (T)value;
+    }
+}
+
+template<typename T>
+void cslib::NumberParser<T>::ms_parseToken(const char* p_first, const char* p_last, T& p_out, std::false_type) {
+    // from_chars doesn't take a leading plus
+    if (*p_first == '+') {
+        p_first++;
+    }
+
+    // from_chars rounds correctly (Eisel-Lemire with a slow path fallback)
+    std::from_chars_result result = std::from_chars(p_first, p_last, p_out);
+    if (result.ec != std::errc() || result.ptr != p_last) {
+        throw ParseInvalidNumber();
+    }
+}
+
+template<typename T>
+uint64_t cslib::NumberParser<T>::ms_separators(uint64_t p_word, char p_delimiter) {
+    // Exact zero byte test, sets the high bit of every byte which was zero
+    auto zeros = [](uint64_t p_x) {
+        const uint64_t low = 0x7F7F7F7F7F7F7F7FULL;
+        uint64_t t = (p_x & low) + low;
+        return ~(t | p_x | low);
+    };
+
+    // Everything up to a space is whitespace
+    uint64_t mask = zeros(p_word ^ VECTOR_PARSE_BROADCAST(' '));
+    mask |= zeros(p_word ^ VECTOR_PARSE_BROADCAST('\n'));
+    mask |= zeros(p_word ^ VECTOR_PARSE_BROADCAST('\r'));
+    mask |= zeros(p_word ^ VECTOR_PARSE_BROADCAST('\t'));
+    mask |= zeros(p_word ^ VECTOR_PARSE_BROADCAST(p_delimiter));
+    return mask;
+}
+
+template<typename T>
+bool cslib::NumberParser<T>::ms_isEightDigits(uint64_t p_word) {
+    // The high nibble must be 3, and adding 6 mustn't carry out of the low nibble
+    return (((p_word & 0xF0F0F0F0F0F0F0F0ULL) |
+            (((p_word + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+            0x3333333333333333ULL);
+}
+
+template<typename T>
+uint32_t cslib::NumberParser<T>::ms_parseEightDigits(uint64_t p_word) {
+    // Combine pairs, then quads, then the two halves
+    const uint64_t mask = 0x000000FF000000FFULL;
+    const uint64_t mul1 = 0x000F424000000064ULL; // 100 + (1000000 << 32)
+    const uint64_t mul2 = 0x0000271000000001ULL; // 1 + (10000 << 32)
+
+    p_word -= 0x3030303030303030ULL;
+    p_word = (p_word * 10) + (p_word >> 8);
+    p_word = (((p_word & mask) * mul1) + (((p_word >> 16) & mask) * mul2)) >> 32;
+    return (uint32_t)p_word;
+}
+
+template<typename T>
+bool cslib::NumberParser<T>::isSeparator(char p_char, char p_delimiter) {
+    return (p_char == p_delimiter || p_char == ' ' || p_char == '\n' || p_char == '\r' || p_char == '\t');
+}
+
+template<typename T>
+size_t cslib::Vector_parse(const char* p_text, size_t p_length, Vector<T>& p_vector, char p_delimiter) {
+    // Small texts aren't worth the threads
+    size_t threads = std::thread::hardware_concurrency();
+    if (p_length < VECTOR_PARSE_PARALLEL_MIN || threads < 2) {
+        threads = 1;
+    }
+
+    // Split the text into chunks which end on a separator
+    Vector<size_t> bounds(threads + 1);
+    bounds.push(0);
+    for (size_t i = 1; i < threads; i++) {
+        size_t at = (p_length / threads) * i;
+        if (at < bounds[i - 1]) {
+            at = bounds[i - 1];
+        }
+        while (at < p_length && !NumberParser<T>::isSeparator(p_text[at], p_delimiter)) {
+            at++;
+        }
+        bounds.push(at);
+    }
+    bounds.push(p_length);
+
+    // Count first, so that each chunk knows where it writes
+    Vector<size_t> offsets(threads + 1);
+    offsets.push(p_vector.size());
+    for (size_t i = 0; i < threads; i++) {
+        const size_t n = NumberParser<T>::count(p_text + bounds[i], bounds[i + 1] - bounds[i], p_delimiter);
+        offsets.push(offsets[i] + n);
+    }
+
+    const size_t start = p_vector.size();
+    const size_t added = offsets[threads] - start;
+    if (added == 0) {
+        return 0;
+    }
+    p_vector.resize(start + added);
+    T* out = &p_vector[0];
+
+    // Single threaded, takes back what it added if a number is bad like the threads do
+    if (threads == 1) {
+        try {
+            NumberParser<T>::parse(p_text, p_length, p_delimiter, out + start);
+        } catch (const ParseException&) {
+            p_vector.resize(start);
+            throw;
+        }
+        return added;
+    }
+
+    // Parse every chunk on its own thread, errors are rethrown on this thread
+    std::thread* workers = new std::thread[threads];
+    Vector<int> failed(threads);
+    for (size_t i = 0; i < threads; i++) {
+        failed.push(false);
+    }
+
+    for (size_t i = 0; i < threads; i++) {
+        workers[i] = std::thread([&, i]() {
+            try {
+                NumberParser<T>::parse(p_text + bounds[i], bounds[i + 1] - bounds[i], p_delimiter, out + offsets[i]);
+            } catch (const ParseException&) {
+                failed[i] = true;
+            }
+        });
+    }
+
+    bool ok = true;
+    for (size_t i = 0; i < threads; i++) {
+        workers[i].join();
+        ok = ok && !failed[i];
+    }
+    delete[] workers;
+
+    if (!ok) {
+        p_vector.resize(start);
+        throw ParseInvalidNumber();
+    }
+
+    return added;
+}
+
+template<typename T>
+size_t cslib::Vector_load(const char* p_path, Vector<T>& p_vector, char p_delimiter) {
+    // Open the file
+    FILE* file = fopen(p_path, "rb");
+    if (file == nullptr) {
+        throw ParseFileNotFound();
+    }
+
+    // Get the length
+    fseek(file, 0, SEEK_END);
+    long length = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (length < 0) {
+        fclose(file);
+        throw ParseFileNotFound();
+    }
+
+    // Read it in one go
+    char* text = new char[(size_t)length + 1];
+    size_t read = fread(text, 1, (size_t)length, file);
+    fclose(file);
+
+    if (read != (size_t)length) {
+        delete[] text;
+        throw ParseFileNotFound();
+    }
+
+    try {
+        size_t n = Vector_parse(text, read, p_vector, p_delimiter);
+        delete[] text;
+        return n;
+    } catch (...) {
+        delete[] text;
+        throw;
+    }
+}
+
+#endif
@@ -0,0 +1,272 @@
+/**
+ * @file WorkStealingDeque.h
+ * @brief Holds the WorkStealingDeque, a lock free double ended queue one thread works on and others steal from.
+ **/
+#ifndef CSWORKSTEALINGDEQUE_H
+#define CSWORKSTEALINGDEQUE_H
+
+#include "Universal.h"
+
+#include <atomic>
+#include <type_traits>
+
+/// The smallest array a WorkStealingDeque starts with, must be a power of two.
+#define WORKSTEALINGDEQUE_CAPACITY_MIN 32
+
+namespace cslib {
+    /**
+     * @class WorkStealingDeque
+     * @tparam T Type of the data structure, trivially copyable, usually a pointer to a task.
+     * @brief The Chase-Lev deque, the owner pushes and pops at the bottom and thieves steal from the top.
+     *
+     * The owner works like on a stack, so it gets back what it pushed last while it's still in cache,
+     * and only needs a compare and exchange when it takes the very last value. Thieves take the oldest
+     * value, usually the biggest piece of work, and race each other with a compare and exchange on the
+     * top. The values sit in a power-of-two circular array that the owner doubles when it's full.
+     * A thief may still be reading the old array, so old arrays are only freed with the deque, which
+     * at most doubles the memory it holds.
+     **/
+    template<typename T>
+    class WorkStealingDeque {
+        static_assert(std::is_trivially_copyable<T>::value, "A WorkStealingDeque holds trivially copyable values");
+
+    public:
+        /**
+         * @param p_capacity The least amount of values it holds before growing, rounded up to a power of two
+         *
+         * @brief Constructs an empty deque
+         */
+        explicit WorkStealingDeque(size_t p_capacity = WORKSTEALINGDEQUE_CAPACITY_MIN);
+
+        /**
+         * @brief Frees the arrays, no thread can be using it
+         */
+        ~WorkStealingDeque();
+
+        /// Copying can't be done safely while others use it
+        WorkStealingDeque(const WorkStealingDeque<T>&) = delete;
+        WorkStealingDeque<T>& operator= (const WorkStealingDeque<T>&) = delete;
+
+        /**
+         * @brief Gets the amount of values when we looked
+         * @return Returns the amount of values
+         */
+        size_t size() const;
+
+        /**
+         * @brief Returns true if there was no data in the data structure when we looked.
+         * @return True if empty, false if at least one item.
+         */
+        bool empty() const;
+
+        /**
+         * @brief Gets how many values fit before it grows
+         * @return Returns the capacity
+         */
+        size_t capacity() const;
+
+        /**
+         * @param p_data The data we are adding to the bottom, only the owner may call this
+         *
+         * @brief Adds the value to the bottom, growing if it's full
+         */
+        void push(const T& p_data);
+
+        /**
+         * @param p_data Gets the value from the bottom, only the owner may call this
+         *
+         * @brief Takes off the value pushed last
+         * @return Returns false if it was empty or a thief took the last value
+         */
+        bool pop(T& p_data);
+
+        /**
+         * @param p_data Gets the value from the top, any thread may call this
+         *
+         * @brief Takes off the oldest value
+         * @return Returns false if it was empty or another thread took the value first
+         */
+        bool steal(T& p_data);
+
+    protected:
+        /**
+         * @struct Array
+         * @brief A circular array of values, indexed by position modulo its size
+         **/
+        struct Array {
+            /// The values
+            std::atomic<T>* slots;
+            /// The size minus one
+            int64_t mask;
+            /// The array it replaced, kept until the deque is freed
+            Array* previous;
+
+            /**
+             * @brief Gets the value at a position
+             * @return Returns the value
+             */
+            T get(int64_t p_index) const {
+                return this->slots[p_index & this->mask].load(std::memory_order_relaxed);
+            }
+
+            /**
+             * @brief Sets the value at a position
+             */
+            void put(int64_t p_index, const T& p_data) {
+                this->slots[p_index & this->mask].store(p_data, std::memory_order_relaxed);
+            }
+        };
+
+        /**
+         * @param p_capacity The size, a power of two
+         * @param p_previous The array it replaces
+         *
+         * @brief Allocates an array
+         * @return Returns the array
+         */
+        static Array* ms_allocate(int64_t p_capacity, Array* p_previous);
+
+        /**
+         * @param p_array The full array
+         * @param p_top The top when we looked
+         * @param p_bottom The bottom
+         *
+         * @brief Copies the values into an array twice the size and publishes it
+         * @return Returns the new array
+         */
+        Array* m_grow(Array* p_array, int64_t p_top, int64_t p_bottom);
+
+        /// The oldest value, thieves move it
+        alignas(64) std::atomic<int64_t> m_top;
+
+        /// One past the newest value, only the owner moves it
+        alignas(64) std::atomic<int64_t> m_bottom;
+
+        /// The array the values are in
+        std::atomic<Array*> m_array;
+    };
+}
+
+template<typename T>
+cslib::WorkStealingDeque<T>::WorkStealingDeque(size_t p_capacity) : m_top(0), m_bottom(0) {
+    int64_t capacity = WORKSTEALINGDEQUE_CAPACITY_MIN;
+    while ((size_t)capacity < p_capacity) {
+        capacity <<= 1;
+    }
+    this->m_array.store(ms_allocate(capacity, nullptr), std::memory_order_relaxed);
+}
+
+template<typename T>
+cslib::WorkStealingDeque<T>::~WorkStealingDeque() {
+    Array* array = this->m_array.load(std::memory_order_relaxed);
+    while (array != nullptr) {
+        Array* previous = array->previous;
+        delete[] array->slots;
+        delete array;
+        array = previous;
+    }
+}
+
+template<typename T>
+size_t cslib::WorkStealingDeque<T>::size() const {
+    int64_t bottom = this->m_bottom.load(std::memory_order_relaxed);
+    int64_t top = this->m_top.load(std::memory_order_relaxed);
+    return (bottom > top) ? (size_t)(bottom - top) : 0;
+}
+
+template<typename T>
+bool cslib::WorkStealingDeque<T>::empty() const {
+    return (this->size() == 0);
+}
+
+template<typename T>
+size_t cslib::WorkStealingDeque<T>::capacity() const {
+    return (size_t)this->m_array.load(std::memory_order_relaxed)->mask + 1;
+}
+
+template<typename T>
+void cslib::WorkStealingDeque<T>::push(const T& p_data) {
+    int64_t bottom = this->m_bottom.load(std::memory_order_relaxed);
+    int64_t top = this->m_top.load(std::memory_order_acquire);
+    Array* array = this->m_array.load(std::memory_order_relaxed);
+    if (bottom - top > array->mask) {
+        array = this->m_grow(array, top, bottom);
+    }
+
+    // The value has to be there before a thief can see the new bottom
+    array->put(bottom, p_data);
+    this->m_bottom.store(bottom + 1, std::memory_order_release);
+}
+
+template<typename T>
+bool cslib::WorkStealingDeque<T>::pop(T& p_data) {
+    // Claim the bottom first, then look at the top, thieves do the opposite
+    int64_t bottom = this->m_bottom.load(std::memory_order_relaxed) - 1;
+    Array* array = this->m_array.load(std::memory_order_relaxed);
+    this->m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = this->m_top.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+        // Empty
+        this->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+    }
+
+    T data = array->get(bottom);
+    if (top == bottom) {
+        // The last one, race the thieves for it
+        bool won = this->m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        this->m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        if (!won) {
+            return false;
+        }
+    }
+
+    p_data = data;
+    return true;
+}
+
+template<typename T>
+bool cslib::WorkStealingDeque<T>::steal(T& p_data) {
+    int64_t top = this->m_top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t bottom = this->m_bottom.load(std::memory_order_acquire);
+    if (top >= bottom) {
+        return false;
+    }
+
+    // Read before claiming, once the top moves the owner may overwrite the slot
+    Array* array = this->m_array.load(std::memory_order_acquire);
+    T data = array->get(top);
+    if (!this->m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return false;
+    }
+
+    p_data = data;
+    return true;
+}
+
+template<typename T>
+typename cslib::WorkStealingDeque<T>::Array* cslib::WorkStealingDeque<T>::ms_allocate(int64_t p_capacity, Array* p_previous) {
+    Array* array = new Array;
+    array->slots = new std::atomic<T>[(size_t)p_capacity];
+    array->mask = p_capacity - 1;
+    array->previous = p_previous;
+    return array;
+}
+
+template<typename T>
+typename cslib::WorkStealingDeque<T>::Array* cslib::WorkStealingDeque<T>::m_grow(Array* p_array, int64_t p_top, int64_t p_bottom) {
+    Array* array = ms_allocate((p_array->mask + 1) * 2, p_array);
+    for (int64_t i = p_top; i < p_bottom; i++) {
+        array->put(i, p_array->get(i));
+    }
+
+    // Thieves that loaded the old array still read the right values from it
+    this->m_array.store(array, std::memory_order_release);
+    return array;
+}
+
+
+#endif
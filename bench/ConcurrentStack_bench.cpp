@@ -0,0 +1,99 @@
+#include "ConcurrentStack.h"
+#include "Stack.h"
+
+#include <stdio.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace cslib {
+    /**
+     * @class LockedStack
+     * @brief A Stack behind one mutex, what the ConcurrentStack replaces
+     **/
+    class LockedStack {
+    public:
+        void push(int p_data) {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_stack.push(p_data);
+        }
+
+        bool tryPop(int& p_data) {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            if (this->m_stack.empty()) {
+                return false;
+            }
+            p_data = this->m_stack.pop();
+            return true;
+        }
+
+    private:
+        std::mutex m_mutex;
+        Stack<int> m_stack;
+    };
+
+    /**
+     * @fn Stack_bench
+     * @param p_stack The stack every thread shares
+     * @param p_threads How many threads
+     * @param p_ops How many push and pop pairs each thread does
+     *
+     * @brief Times threads pushing and popping the one stack
+     * @return Returns millions of operations per second
+     */
+    template<typename TStack>
+    double Stack_bench(TStack& p_stack, int p_threads, int p_ops) {
+        std::thread* workers = new std::thread[p_threads];
+        auto start = std::chrono::steady_clock::now();
+
+        for (int t = 0; t < p_threads; t++) {
+            workers[t] = std::thread([&p_stack, p_ops]() {
+                int value = 0;
+                for (int i = 0; i < p_ops; i++) {
+                    p_stack.push(i);
+                    p_stack.tryPop(value);
+                }
+            });
+        }
+        for (int t = 0; t < p_threads; t++) {
+            workers[t].join();
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        delete[] workers;
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        return (2.0 * p_threads * p_ops) / seconds / 1e6;
+    }
+}
+
+
+
+int main(int argc, char** argv) {
+    using namespace cslib;
+
+    int maxThreads = (int)std::thread::hardware_concurrency();
+    if (argc > 1) {
+        maxThreads = atoi(argv[1]);
+    }
+    if (maxThreads < 1) {
+        maxThreads = 1;
+    }
+    constexpr int ops = 1000000;
+
+    printf("threads  locked Mops/s  lock free Mops/s  eliminated\n");
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        LockedStack locked;
+        ConcurrentStack<int> lockFree;
+
+        double lockedRate = Stack_bench(locked, threads, ops);
+        double lockFreeRate = Stack_bench(lockFree, threads, ops);
+        printf("%7d  %13.2f  %16.2f  %10zu\n", threads, lockedRate, lockFreeRate, lockFree.eliminated());
+
+        if (threads < maxThreads && threads * 2 > maxThreads) {
+            threads = maxThreads / 2;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include "MpmcQueue.h"
+#include "Queue.h"
+
+#include <stdio.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace cslib {
+    /**
+     * @class LockedQueue
+     * @brief A Queue behind one mutex, what the MpmcQueue replaces
+     **/
+    class LockedQueue {
+    public:
+        void enqueue(int p_data) {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_queue.enqueue(p_data);
+        }
+
+        bool tryDequeue(int& p_data) {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            if (this->m_queue.empty()) {
+                return false;
+            }
+            p_data = this->m_queue.dequeue();
+            return true;
+        }
+
+    private:
+        std::mutex m_mutex;
+        Queue<int> m_queue;
+    };
+
+    /**
+     * @fn Queue_bench
+     * @param p_queue The queue every thread shares
+     * @param p_producers How many threads enqueue
+     * @param p_consumers How many threads dequeue
+     * @param p_ops How many values each producer enqueues
+     *
+     * @brief Times producers and consumers moving every value through the one queue
+     * @return Returns millions of values per second
+     */
+    template<typename TQueue>
+    double Queue_bench(TQueue& p_queue, int p_producers, int p_consumers, int p_ops) {
+        std::thread* workers = new std::thread[p_producers + p_consumers];
+        std::atomic<long long> left{ (long long)p_producers * p_ops };
+        auto start = std::chrono::steady_clock::now();
+
+        for (int t = 0; t < p_producers; t++) {
+            workers[t] = std::thread([&p_queue, p_ops]() {
+                for (int i = 0; i < p_ops; i++) {
+                    p_queue.enqueue(i);
+                }
+            });
+        }
+        for (int t = 0; t < p_consumers; t++) {
+            workers[p_producers + t] = std::thread([&p_queue, &left]() {
+                int value = 0;
+                while (left.load(std::memory_order_relaxed) > 0) {
+                    if (p_queue.tryDequeue(value)) {
+                        left.fetch_sub(1, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (int t = 0; t < p_producers + p_consumers; t++) {
+            workers[t].join();
+        }
+
+        auto end = std::chrono::steady_clock::now();
+        delete[] workers;
+
+        double seconds = std::chrono::duration<double>(end - start).count();
+        return ((double)p_producers * p_ops) / seconds / 1e6;
+    }
+}
+
+
+
+int main(int argc, char** argv) {
+    using namespace cslib;
+
+    int maxThreads = (int)std::thread::hardware_concurrency();
+    if (argc > 1) {
+        maxThreads = atoi(argv[1]);
+    }
+    if (maxThreads < 2) {
+        maxThreads = 2;
+    }
+    constexpr int ops = 1000000;
+
+    // Half the threads produce, half consume
+    printf("producers  consumers  locked Mops/s  mpmc Mops/s\n");
+    for (int threads = 2; threads <= maxThreads; threads *= 2) {
+        LockedQueue locked;
+        MpmcQueue<int> lockFree(1024);
+
+        int producers = threads / 2;
+        int consumers = threads - producers;
+        double lockedRate = Queue_bench(locked, producers, consumers, ops / producers);
+        double lockFreeRate = Queue_bench(lockFree, producers, consumers, ops / producers);
+        printf("%9d  %9d  %13.2f  %11.2f\n", producers, consumers, lockedRate, lockFreeRate);
+
+        if (threads < maxThreads && threads * 2 > maxThreads) {
+            threads = maxThreads / 2;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,205 @@
+#include "PairingHeap.h"
+#include "PriorityQueue.h"
+#include "Graph.h"
+
+#include <stdio.h>
+#include <chrono>
+
+namespace cslib {
+    /**
+     * @struct Distance
+     * @brief A node and how far it is, ordered by the distance
+     **/
+    struct Distance {
+        /// How far the node is
+        uint64_t distance;
+        /// The node
+        size_t node;
+
+        bool operator< (const Distance& p_right) const {
+            return this->distance < p_right.distance;
+        }
+    };
+
+    /**
+     * @fn Weight
+     * @param p_from Where the edge starts
+     * @param p_to Where it goes
+     *
+     * @brief Gets the weight of an edge, the Graph doesn't keep any
+     * @return Returns a weight between 1 and 1000
+     */
+    uint64_t Weight(size_t p_from, size_t p_to) {
+        uint64_t hash = (uint64_t)p_from * 0x9E3779B97F4A7C15ull ^ (uint64_t)p_to * 0xC2B2AE3D27D4EB4Full;
+        hash ^= hash >> 29;
+        return hash % 1000 + 1;
+    }
+
+    /**
+     * @fn Dijkstra_lazy
+     * @brief Shortest paths with a PriorityQueue, pushing again instead of decreasing and skipping stale entries
+     */
+    void Dijkstra_lazy(const Graph<int>& p_graph, size_t p_start, uint64_t* p_distances) {
+        PriorityQueue<Distance> queue;
+        p_distances[p_start] = 0;
+        queue.push(Distance{ 0, p_start });
+
+        while (!queue.empty()) {
+            Distance current = queue.pop();
+            if (current.distance != p_distances[current.node]) {
+                continue;
+            }
+
+            const LinkedList<size_t>& edges = p_graph.neighbours(current.node);
+            for (LinkedList<size_t>::ConstIterator it = edges.cbegin(); it != edges.cend(); ++it) {
+                uint64_t distance = current.distance + Weight(current.node, *it);
+                if (distance < p_distances[*it]) {
+                    p_distances[*it] = distance;
+                    queue.push(Distance{ distance, *it });
+                }
+            }
+        }
+    }
+
+    /**
+     * @fn Dijkstra_indexed
+     * @brief Shortest paths with an IndexedPriorityQueue and decreaseKey
+     */
+    void Dijkstra_indexed(const Graph<int>& p_graph, size_t p_start, uint64_t* p_distances) {
+        typedef IndexedPriorityQueue<Distance>::Handle Handle;
+        IndexedPriorityQueue<Distance> queue;
+        Handle* handles = new Handle[p_graph.size()];
+        bool* queued = new bool[p_graph.size()]();
+
+        p_distances[p_start] = 0;
+        handles[p_start] = queue.push(Distance{ 0, p_start });
+        queued[p_start] = true;
+
+        while (!queue.empty()) {
+            Distance current = queue.pop();
+            queued[current.node] = false;
+
+            const LinkedList<size_t>& edges = p_graph.neighbours(current.node);
+            for (LinkedList<size_t>::ConstIterator it = edges.cbegin(); it != edges.cend(); ++it) {
+                uint64_t distance = current.distance + Weight(current.node, *it);
+                if (distance >= p_distances[*it]) {
+                    continue;
+                }
+
+                p_distances[*it] = distance;
+                if (queued[*it]) {
+                    queue.decreaseKey(handles[*it], Distance{ distance, *it });
+                } else {
+                    handles[*it] = queue.push(Distance{ distance, *it });
+                    queued[*it] = true;
+                }
+            }
+        }
+
+        delete[] handles;
+        delete[] queued;
+    }
+
+    /**
+     * @fn Dijkstra_pairing
+     * @brief Shortest paths with a PairingHeap and decreaseKey
+     */
+    void Dijkstra_pairing(const Graph<int>& p_graph, size_t p_start, uint64_t* p_distances) {
+        typedef PairingHeap<Distance>::Handle Handle;
+        PairingHeap<Distance> heap;
+        Handle* handles = new Handle[p_graph.size()]();
+
+        p_distances[p_start] = 0;
+        handles[p_start] = heap.push(Distance{ 0, p_start });
+
+        while (!heap.empty()) {
+            Distance current = heap.pop();
+            handles[current.node] = nullptr;
+
+            const LinkedList<size_t>& edges = p_graph.neighbours(current.node);
+            for (LinkedList<size_t>::ConstIterator it = edges.cbegin(); it != edges.cend(); ++it) {
+                uint64_t distance = current.distance + Weight(current.node, *it);
+                if (distance >= p_distances[*it]) {
+                    continue;
+                }
+
+                p_distances[*it] = distance;
+                if (handles[*it] != nullptr) {
+                    heap.decreaseKey(handles[*it], Distance{ distance, *it });
+                } else {
+                    handles[*it] = heap.push(Distance{ distance, *it });
+                }
+            }
+        }
+
+        delete[] handles;
+    }
+
+    /**
+     * @fn Dijkstra_bench
+     * @brief Times one of the searches
+     * @return Returns the milliseconds it took
+     */
+    template<typename TF>
+    double Dijkstra_bench(const Graph<int>& p_graph, uint64_t* p_distances, TF&& p_func) {
+        for (size_t i = 0; i < p_graph.size(); i++) {
+            p_distances[i] = (uint64_t)-1;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        p_func(p_graph, 0, p_distances);
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+
+
+int main(int argc, char** argv) {
+    using namespace cslib;
+
+    size_t nodes = 20000;
+    if (argc > 1) {
+        nodes = (size_t)atoi(argv[1]);
+    }
+    if (nodes < 2) {
+        nodes = 2;
+    }
+
+    printf("nodes  edges/node  lazy ms  indexed ms  pairing ms\n");
+    for (size_t degree = 4; degree <= 32; degree *= 2) {
+        // A ring so everything is reachable, plus random one way edges
+        Graph<int> graph;
+        for (size_t i = 0; i < nodes; i++) {
+            graph.insert((int)i);
+        }
+        unsigned int seed = 2024;
+        for (size_t i = 0; i < nodes; i++) {
+            graph.connect(i, (i + 1) % nodes, true);
+            for (size_t j = 1; j < degree; j++) {
+                seed = seed * 1103515245 + 12345;
+                graph.connect(i, (seed >> 4) % nodes, true);
+            }
+        }
+
+        uint64_t* lazy = new uint64_t[nodes];
+        uint64_t* indexed = new uint64_t[nodes];
+        uint64_t* pairing = new uint64_t[nodes];
+        double lazyMs = Dijkstra_bench(graph, lazy, Dijkstra_lazy);
+        double indexedMs = Dijkstra_bench(graph, indexed, Dijkstra_indexed);
+        double pairingMs = Dijkstra_bench(graph, pairing, Dijkstra_pairing);
+
+        for (size_t i = 0; i < nodes; i++) {
+            if (lazy[i] != indexed[i] || lazy[i] != pairing[i]) {
+                printf("Distances differ at node %zu\n", i);
+                return 1;
+            }
+        }
+        printf("%5zu  %10zu  %7.2f  %10.2f  %10.2f\n", nodes, degree, lazyMs, indexedMs, pairingMs);
+
+        delete[] lazy;
+        delete[] indexed;
+        delete[] pairing;
+    }
+
+    return 0;
+}
@@ -0,0 +1,189 @@
+#include "SpscQueue.h"
+#include "Queue.h"
+
+#include <stdio.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace cslib {
+    /**
+     * @class LockedQueue
+     * @brief A Queue behind one mutex, what the SpscQueue replaces
+     **/
+    class LockedQueue {
+    public:
+        bool tryPush(int p_data) {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_queue.enqueue(p_data);
+            return true;
+        }
+
+        bool tryPop(int& p_data) {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            if (this->m_queue.empty()) {
+                return false;
+            }
+            p_data = this->m_queue.dequeue();
+            return true;
+        }
+
+    private:
+        std::mutex m_mutex;
+        Queue<int> m_queue;
+    };
+
+    /**
+     * @fn Throughput_bench
+     * @param p_queue The queue between the two threads
+     * @param p_ops How many values go through
+     *
+     * @brief Times one thread pushing values and another popping them, one at a time
+     * @return Returns millions of values per second
+     */
+    template<typename TQueue>
+    double Throughput_bench(TQueue& p_queue, int p_ops) {
+        auto start = std::chrono::steady_clock::now();
+
+        std::thread producer([&p_queue, p_ops]() {
+            for (int i = 0; i < p_ops; i++) {
+                while (!p_queue.tryPush(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        int value = 0;
+        for (int i = 0; i < p_ops; i++) {
+            while (!p_queue.tryPop(value)) {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return p_ops / seconds / 1e6;
+    }
+
+    /**
+     * @fn Batch_bench
+     * @param p_queue The queue between the two threads
+     * @param p_ops How many values go through
+     * @param p_batch How many values each push and pop moves
+     *
+     * @brief Times one thread pushing values and another popping them, in batches
+     * @return Returns millions of values per second
+     */
+    double Batch_bench(SpscQueue<int>& p_queue, int p_ops, int p_batch) {
+        auto start = std::chrono::steady_clock::now();
+
+        std::thread producer([&p_queue, p_ops, p_batch]() {
+            int* batch = new int[p_batch];
+            int i = 0;
+            while (i < p_ops) {
+                int count = (p_ops - i < p_batch) ? p_ops - i : p_batch;
+                for (int j = 0; j < count; j++) {
+                    batch[j] = i + j;
+                }
+                size_t pushed = p_queue.pushMany(batch, count);
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+                i += (int)pushed;
+            }
+            delete[] batch;
+        });
+
+        int* batch = new int[p_batch];
+        int i = 0;
+        while (i < p_ops) {
+            size_t popped = p_queue.popMany(batch, p_batch);
+            if (popped == 0) {
+                std::this_thread::yield();
+            }
+            i += (int)popped;
+        }
+        delete[] batch;
+        producer.join();
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return p_ops / seconds / 1e6;
+    }
+
+    /**
+     * @fn Latency_bench
+     * @param p_ping Carries values to the other thread
+     * @param p_pong Carries them back
+     * @param p_trips How many round trips
+     *
+     * @brief Times a value going to the other thread and back
+     * @return Returns the nanoseconds one round trip takes
+     */
+    template<typename TQueue>
+    double Latency_bench(TQueue& p_ping, TQueue& p_pong, int p_trips) {
+        std::thread echo([&p_ping, &p_pong, p_trips]() {
+            int value = 0;
+            for (int i = 0; i < p_trips; i++) {
+                while (!p_ping.tryPop(value)) {
+                    std::this_thread::yield();
+                }
+                while (!p_pong.tryPush(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        auto start = std::chrono::steady_clock::now();
+        int value = 0;
+        for (int i = 0; i < p_trips; i++) {
+            while (!p_ping.tryPush(i)) {
+                std::this_thread::yield();
+            }
+            while (!p_pong.tryPop(value)) {
+                std::this_thread::yield();
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        echo.join();
+
+        return seconds * 1e9 / p_trips;
+    }
+}
+
+
+
+int main(int argc, char** argv) {
+    using namespace cslib;
+
+    int ops = 10000000;
+    if (argc > 1) {
+        ops = atoi(argv[1]);
+    }
+    if (ops < 1) {
+        ops = 1;
+    }
+    int trips = ops / 10 + 1;
+
+    {
+        LockedQueue locked;
+        SpscQueue<int> lockFree(1024);
+        printf("throughput   locked Mops/s  spsc Mops/s\n");
+        printf("%10s  %14.2f  %11.2f\n", "single", Throughput_bench(locked, ops), Throughput_bench(lockFree, ops));
+    }
+
+    for (int batch = 8; batch <= 256; batch *= 4) {
+        SpscQueue<int> lockFree(1024);
+        printf("%7s%3d  %14s  %11.2f\n", "batch ", batch, "", Batch_bench(lockFree, ops, batch));
+    }
+
+    {
+        LockedQueue lockedPing;
+        LockedQueue lockedPong;
+        SpscQueue<int> ping(1024);
+        SpscQueue<int> pong(1024);
+        printf("\nround trip   locked ns  spsc ns\n");
+        printf("%10s  %10.1f  %7.1f\n", "", Latency_bench(lockedPing, lockedPong, trips), Latency_bench(ping, pong, trips));
+    }
+
+    return 0;
+}
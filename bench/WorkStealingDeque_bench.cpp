@@ -0,0 +1,159 @@
+#include "WorkStealingDeque.h"
+#include "Deque.h"
+
+#include <stdio.h>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+namespace cslib {
+    /**
+     * @class LockedDeque
+     * @brief A Deque behind one mutex, what the WorkStealingDeque replaces
+     **/
+    class LockedDeque {
+    public:
+        void push(int p_data) {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            this->m_deque.pushBack(p_data);
+        }
+
+        bool pop(int& p_data) {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            if (this->m_deque.empty()) {
+                return false;
+            }
+            p_data = this->m_deque.popBack();
+            return true;
+        }
+
+        bool steal(int& p_data) {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            if (this->m_deque.empty()) {
+                return false;
+            }
+            p_data = this->m_deque.popFront();
+            return true;
+        }
+
+        bool empty() {
+            std::lock_guard<std::mutex> lock(this->m_mutex);
+            return this->m_deque.empty();
+        }
+
+    private:
+        std::mutex m_mutex;
+        Deque<int> m_deque;
+    };
+
+    /**
+     * @fn Owner_bench
+     * @param p_deque The deque
+     * @param p_ops How many values go through
+     *
+     * @brief Times the owner pushing and popping alone, what it does while nobody steals
+     * @return Returns millions of values per second
+     */
+    template<typename TDeque>
+    double Owner_bench(TDeque& p_deque, int p_ops) {
+        auto start = std::chrono::steady_clock::now();
+        int value = 0;
+        volatile long long sum = 0;
+        for (int i = 0; i < p_ops; i += 16) {
+            for (int j = 0; j < 16; j++) {
+                p_deque.push(i + j);
+            }
+            while (p_deque.pop(value)) {
+                sum += value;
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return p_ops / seconds / 1e6;
+    }
+
+    /**
+     * @fn Steal_bench
+     * @param p_deque The deque
+     * @param p_ops How many values go through
+     * @param p_thieves How many threads steal
+     *
+     * @brief Times the owner pushing bursts and popping some back while thieves take the rest
+     * @return Returns millions of values per second
+     */
+    template<typename TDeque>
+    double Steal_bench(TDeque& p_deque, int p_ops, int p_thieves) {
+        std::atomic<bool> done{ false };
+        std::atomic<long long> stolen{ 0 };
+        auto start = std::chrono::steady_clock::now();
+
+        std::thread* thieves = new std::thread[p_thieves];
+        for (int t = 0; t < p_thieves; t++) {
+            thieves[t] = std::thread([&p_deque, &done, &stolen]() {
+                int value = 0;
+                long long count = 0;
+                while (!done.load(std::memory_order_relaxed) || !p_deque.empty()) {
+                    if (p_deque.steal(value)) {
+                        count++;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+                stolen += count;
+            });
+        }
+
+        // Every other burst is half taken back by the owner
+        int value = 0;
+        for (int i = 0; i < p_ops; i += 64) {
+            for (int j = 0; j < 64; j++) {
+                p_deque.push(i + j);
+            }
+            if ((i / 64) % 2 == 0) {
+                for (int j = 0; j < 32; j++) {
+                    p_deque.pop(value);
+                }
+            }
+        }
+        done = true;
+
+        for (int t = 0; t < p_thieves; t++) {
+            thieves[t].join();
+        }
+        delete[] thieves;
+
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return p_ops / seconds / 1e6;
+    }
+}
+
+
+
+int main(int argc, char** argv) {
+    using namespace cslib;
+
+    int ops = 10000000;
+    if (argc > 1) {
+        ops = atoi(argv[1]);
+    }
+    if (ops < 64) {
+        ops = 64;
+    }
+
+    {
+        LockedDeque locked;
+        WorkStealingDeque<int> lockFree;
+        printf("owner only   locked Mops/s  chase-lev Mops/s\n");
+        printf("%10s  %14.2f  %16.2f\n", "", Owner_bench(locked, ops), Owner_bench(lockFree, ops));
+    }
+
+    unsigned int hardware = std::thread::hardware_concurrency();
+    int most = (hardware > 1) ? (int)hardware - 1 : 1;
+    printf("\nthieves      locked Mops/s  chase-lev Mops/s\n");
+    for (int thieves = 1; thieves <= most; thieves *= 2) {
+        LockedDeque locked;
+        WorkStealingDeque<int> lockFree;
+        printf("%10d  %14.2f  %16.2f\n", thieves, Steal_bench(locked, ops, thieves), Steal_bench(lockFree, ops, thieves));
+    }
+
+    return 0;
+}
@@ -1,11 +1,103 @@
 #include "Test.h" 
 #include "BinarySearchTree.h" 
+#include "AVLTree.h"
+#include "Set.h"
+#include "Map.h"
 
 #include <stdio.h>
 #include <string.h>
 
 namespace cslib {
 
+    /**
+     * @class BST_testGraft
+     * @brief Reaches m_addSubtree, the tree it takes from is left empty
+     */
+    struct BST_testGraft : public BinarySearchTree<int> {
+        void graft(BST_testGraft& p_bst) {
+            this->m_addSubtree(p_bst);
+            p_bst.m_root = nullptr;
+        }
+    };
+
+    /**
+     * @class BST_testNodes
+     * @brief Reaches the nodes of a tree to check its parents and subtree sizes
+     */
+    template<typename TTree>
+    struct BST_testNodes : public TTree {
+        typedef typename TTree::BinaryNode Node;
+
+        // Checks every node below points up to its parent and counts its subtree
+        static bool ms_valid(const Node* p_node, const Node* p_parent) {
+            if (p_node == nullptr) {
+                return true;
+            }
+
+            size_t size = 1 + ((p_node->left != nullptr) ? p_node->left->size : 0) + ((p_node->right != nullptr) ? p_node->right->size : 0);
+            return (p_node->parent == p_parent && p_node->size == size && ms_valid(p_node->left, p_node) && ms_valid(p_node->right, p_node));
+        }
+
+        bool valid() const {
+            return ms_valid(this->m_root, nullptr);
+        }
+
+        // Finds a node with that many children, nullptr if there is none
+        const Node* pick(int p_children) const {
+            Scratch<const Node*> stack;
+            if (this->m_root != nullptr) {
+                stack.push(this->m_root);
+            }
+            while (!stack.empty()) {
+                const Node* node = stack.pop();
+                if ((node->left != nullptr) + (node->right != nullptr) == p_children) {
+                    return node;
+                }
+                if (node->left != nullptr) {
+                    stack.push(node->left);
+                }
+                if (node->right != nullptr) {
+                    stack.push(node->right);
+                }
+            }
+            return nullptr;
+        }
+    };
+
+    /**
+     * @fn BST_testWalk
+     * @brief Checks the tree holds exactly the values flagged, both ways round, with select and rank agreeing
+     */
+    template<typename TTree>
+    bool BST_testWalk(const TTree& p_tree, const bool* p_in, int p_n) {
+        size_t index = 0;
+        typename TTree::ConstIterator it = p_tree.begin();
+        for (int i = 0; i < p_n; i++) {
+            if (!p_in[i]) {
+                if (p_tree.rank(i) != index) {
+                    return false;
+                }
+                continue;
+            }
+            if (it == p_tree.end() || *it != i || p_tree.select(index) != i || p_tree.rank(i) != index) {
+                return false;
+            }
+            ++it;
+            index++;
+        }
+        if (it != p_tree.end() || p_tree.amount() != index) {
+            return false;
+        }
+
+        // Back from the end
+        for (int i = p_n - 1; i >= 0; i--) {
+            if (p_in[i] && (it == p_tree.begin() || *--it != i)) {
+                return false;
+            }
+        }
+        return (it == p_tree.begin());
+    }
+
     BinarySearchTree<int> BST_testBasicTestTree() {
         //    4
         //  2   6
@@ -218,6 +310,363 @@ namespace cslib {
         }
         return true;
     }
+
+    // Traversals on a warm thread take their scratch from it and allocate nothing
+    int BST_test11() {
+        constexpr size_t n = 2048;
+        BinarySearchTree<int> bst;
+        unsigned int seed = 11;
+        for (size_t i = 0; i < n; i++) {
+            seed = seed * 1103515245 + 12345;
+            try {
+                bst.insert((int)(seed >> 8));
+            } catch (const BSTNodeExists& err) {
+            }
+        }
+
+        long long sum = 0;
+        auto visit = [&](const int& a) {
+            sum += a;
+        };
+        auto traverse = [&]() {
+            sum = 0;
+            bst.inorder(visit);
+            bst.preorder(visit);
+            bst.postorder(visit);
+            bst.depthFirst(visit);
+            bst.breadthFirst(visit);
+            return sum + (long long)bst.depth() + (long long)bst.amount();
+        };
+
+        long long cold = traverse();
+        BinarySearchTree<int> copy = bst;
+        copy = bst;
+
+        size_t allocations = ScratchPool::stats().allocations;
+        long long warm = traverse();
+        copy = bst;
+        copy.clear();
+
+        return (cold == warm && ScratchPool::stats().allocations == allocations && copy.empty());
+    }
+
+    // Iterators go both ways and removing keeps the order
+    int BST_test12() {
+        constexpr int n = 1000;
+        BinarySearchTree<int> bst;
+        for (int i = 0; i < n; i++) {
+            bst.insert((i * 389) % n);
+        }
+
+        int expected = 0;
+        for (BinarySearchTree<int>::ConstIterator it = bst.begin(); it != bst.end(); ++it) {
+            if (*it != expected++) {
+                return false;
+            }
+        }
+        for (BinarySearchTree<int>::ConstIterator it = bst.last(); it != bst.end(); --it) {
+            if (*it != --expected) {
+                return false;
+            }
+        }
+
+        // Stepping off end() either way
+        BinarySearchTree<int>::ConstIterator back = bst.end();
+        BinarySearchTree<int>::ConstIterator front = bst.end();
+        if (*--back != n - 1 || *++front != 0 || bst.last() != back || --bst.begin() != bst.end()) {
+            return false;
+        }
+
+        // Leaves, inner nodes and the root alike
+        for (int i = 0; i < n; i += 3) {
+            if (bst.remove(i) != i) {
+                return false;
+            }
+        }
+        CS_RANGE_TEST(bst.remove(0), BSTNodeNotFound);
+
+        // Copies get parents of their own
+        BinarySearchTree<int> copy = bst;
+        bst.clear();
+
+        int last = -1;
+        int count = 0;
+        for (BinarySearchTree<int>::ConstIterator it = copy.cbegin(); it != copy.cend(); it++) {
+            if (*it <= last || *it % 3 == 0) {
+                return false;
+            }
+            last = *it;
+            count++;
+        }
+
+        int visits = 0;
+        copy.postorder([&](const int&) {
+            visits++;
+        });
+
+        return (count == n - (n + 2) / 3 && visits == count && bst.begin() == bst.end());
+    }
+
+    // select and rank agree with the order through inserts, removes and copies
+    int BST_test13() {
+        constexpr int n = 2000;
+        BinarySearchTree<int> bst;
+        unsigned int seed = 13;
+        for (int i = 0; i < n; i++) {
+            seed = seed * 1103515245 + 12345;
+            int value = (int)((seed >> 8) % (n * 2)) * 2;
+            if (!BSTree_contains(bst, value)) {
+                bst.insert(value);
+            }
+        }
+        for (int i = 0; i < n / 2; i++) {
+            seed = seed * 1103515245 + 12345;
+            int value = (int)((seed >> 8) % (n * 2)) * 2;
+            if (BSTree_contains(bst, value)) {
+                bst.remove(value);
+            }
+        }
+
+        BinarySearchTree<int> copy = bst;
+        size_t index = 0;
+        for (BinarySearchTree<int>::ConstIterator it = copy.begin(); it != copy.end(); ++it, index++) {
+            // Values are even, the odd one before each has the same rank
+            if (copy.select(index) != *it || copy.rank(*it) != index || copy.rank(*it - 1) != index) {
+                return false;
+            }
+        }
+        CS_RANGE_TEST(copy.select(index), OutOfRange);
+
+        BinarySearchTree<int> empty;
+        CS_RANGE_TEST(empty.select(0), OutOfRange);
+
+        return (index == bst.amount() && index == copy.amount() && copy.rank(n * 8) == index && empty.amount() == 0);
+    }
+
+    // Bounds and ranges between, on and past the values
+    int BST_test14() {
+        // 0, 10, 20 ... 990
+        BinarySearchTree<int> bst;
+        for (int i = 0; i < 100; i++) {
+            bst.insert(((i * 37) % 100) * 10);
+        }
+
+        if (*bst.lowerBound(500) != 500 || *bst.upperBound(500) != 510 ||
+            *bst.lowerBound(505) != 510 || *bst.upperBound(505) != 510 ||
+            *bst.lowerBound(-5) != 0 || bst.lowerBound(991) != bst.end() || bst.upperBound(990) != bst.end()) {
+            return false;
+        }
+        if (bst.floor(505) != 500 || bst.floor(500) != 500 || bst.ceiling(505) != 510 || bst.floor(5000) != 990) {
+            return false;
+        }
+        CS_RANGE_TEST(bst.floor(-1), BSTNodeNotFound);
+        CS_RANGE_TEST(bst.ceiling(991), BSTNodeNotFound);
+        if (*--bst.upperBound(505) != 500 || *--bst.upperBound(990) != 990) {
+            return false;
+        }
+
+        // The low end is kept and the high end left out, ends that aren't values work too
+        int expected = 200;
+        bst.range(200, 300, [&](const int& a) {
+            if (a == expected) {
+                expected += 10;
+            }
+        });
+        if (expected != 300) {
+            return false;
+        }
+
+        int count = 0;
+        for (BinarySearchTree<int>::ConstIterator it = bst.lowerBound(195); it != bst.upperBound(305); ++it) {
+            count++;
+        }
+        bst.range(601, 609, [&](const int&) {
+            count += 100;
+        });
+        bst.range(-100, 5, [&](const int& a) {
+            count += a + 1;
+        });
+
+        BinarySearchTree<int> empty;
+        empty.range(0, 100, [&](const int&) {
+            count += 1000;
+        });
+
+        return (count == 12 && empty.lowerBound(0) == empty.end());
+    }
+
+    // A whole tree linked in between two values, then into an empty tree
+    int BST_test15() {
+        BST_testGraft bst;
+        BST_testGraft subtree;
+        for (int i = 0; i < 10; i++) {
+            bst.insert(((i * 7) % 10) * 10);
+        }
+        for (int i = 0; i < 8; i++) {
+            subtree.insert(51 + (i * 3) % 8);
+        }
+        bst.graft(subtree);
+
+        // 0, 10 ... 50, 51 ... 58, 60 ... 90
+        int expected = 0;
+        size_t index = 0;
+        for (BinarySearchTree<int>::ConstIterator it = bst.begin(); it != bst.end(); ++it, index++) {
+            if (*it != expected || bst.select(index) != expected || bst.rank(expected) != index) {
+                return false;
+            }
+            expected += (expected >= 50 && expected < 58) ? 1 : (expected == 58) ? 2 : 10;
+        }
+        if (expected != 100 || bst.amount() != 18 || subtree.amount() != 0) {
+            return false;
+        }
+
+        BST_testGraft empty;
+        empty.graft(bst);
+        empty.graft(subtree);
+        return (empty.amount() == 18 && *empty.begin() == 0 && *--empty.end() == 90 && bst.begin() == bst.end());
+    }
+
+    // Runs that force every rotation, then removes of leaves, one child and two children nodes
+    int BST_test16() {
+        constexpr int n = 512;
+        bool in[n] = {};
+        BST_testNodes<AVLTree<int>> avl;
+
+        // Ascending rotates left, descending rotates right, the odd ones land under those and rotate twice
+        for (int phase = 0; phase < 4; phase++) {
+            for (int j = 0; j < n / 4; j++) {
+                int i = (phase % 2 == 0) ? j : n / 4 - 1 - j;
+                int value = i * 4 + ((phase == 0) ? 0 : (phase == 1) ? 2 : (phase == 2) ? 1 : 3);
+                avl.insert(value);
+                in[value] = true;
+                if (!avl.valid()) {
+                    return false;
+                }
+            }
+            if (!BST_testWalk(avl, in, n)) {
+                return false;
+            }
+        }
+
+        int removed[3] = {};
+        for (int round = 0; round < 3 * 60; round++) {
+            const BST_testNodes<AVLTree<int>>::Node* node = avl.pick(round % 3);
+            if (node == nullptr) {
+                continue;
+            }
+            int value = node->data;
+            if (avl.remove(value) != value) {
+                return false;
+            }
+            in[value] = false;
+            removed[round % 3]++;
+            if (!avl.valid() || !BST_testWalk(avl, in, n)) {
+                return false;
+            }
+        }
+
+        return (removed[0] > 0 && removed[1] > 0 && removed[2] > 0);
+    }
+
+    // Sets and Maps keep the same order and sizes as the tree under them
+    int BST_test17() {
+        constexpr int n = 1000;
+        bool in[n] = {};
+        BST_testNodes<Set<int>> set;
+        unsigned int seed = 17;
+        for (int i = 0; i < n; i++) {
+            seed = seed * 1103515245 + 12345;
+            int value = (int)((seed >> 8) % n);
+            if (!in[value]) {
+                set.insert(value);
+                in[value] = true;
+            }
+        }
+        if (!set.valid() || !BST_testWalk(set, in, n)) {
+            return false;
+        }
+        for (int i = 0; i < n; i += 3) {
+            if (in[i]) {
+                set.remove(i);
+                in[i] = false;
+            }
+        }
+        if (!set.valid() || !BST_testWalk(set, in, n)) {
+            return false;
+        }
+
+        BST_testNodes<Map<int, int>> map;
+        for (int i = 0; i < n; i++) {
+            map[i] = i * 2;
+            if (i % 64 == 0 && !map.valid()) {
+                return false;
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            if (map.select(i) != i || map.rank(i) != (size_t)i || map[i] != i * 2) {
+                return false;
+            }
+        }
+
+        int expected = n;
+        Map<int, int>::ConstIterator it = map.end();
+        while (it != map.begin()) {
+            --it;
+            if (it->key != --expected || it->data != expected * 2) {
+                return false;
+            }
+        }
+        return (expected == 0 && map.valid() && map.size() == n);
+    }
+
+    // A scratch queue grows with how wide it gets, not how much went through it
+    int BST_test18() {
+        constexpr int n = 100000;
+        constexpr int width = 100;
+        ScratchPool::trim();
+        size_t allocations = ScratchPool::stats().allocations;
+        {
+            Scratch<int> queue;
+            for (int i = 0; i < width; i++) {
+                queue.push(i);
+            }
+            for (int i = width; i < n; i++) {
+                queue.push(i);
+                if (queue.popFront() != i - width || queue.size() != width) {
+                    return false;
+                }
+            }
+        }
+
+        // The first buffer, then grown twice to hold twice the width
+        if (ScratchPool::stats().allocations - allocations > 3) {
+            return false;
+        }
+        allocations = ScratchPool::stats().allocations;
+
+        // A full tree 2048 wide, breadth first keeps its values in order and grows the buffer to 4096 at most
+        BinarySearchTree<int> bst;
+        for (int step = 1 << 11; step > 0; step /= 2) {
+            for (int i = step; i < (1 << 12); i += step * 2) {
+                bst.insert(i);
+            }
+        }
+        int expected = 1 << 11;
+        int step = 1 << 11;
+        bool ordered = true;
+        bst.breadthFirst([&](const int& a) {
+            if (a != expected) {
+                ordered = false;
+            }
+            expected += step * 2;
+            if (expected >= (1 << 12)) {
+                step /= 2;
+                expected = step;
+            }
+        });
+
+        return (ordered && step == 0 && ScratchPool::stats().allocations - allocations <= 5);
+    }
 }
 
 
@@ -227,7 +676,7 @@ typedef int(*testf_t)(void);
 int main() {
     using namespace cslib;
 
-    constexpr size_t TEST_SIZE = 10;
+    constexpr size_t TEST_SIZE = 18;
     testf_t test[TEST_SIZE] = {
         BST_test1,
         BST_test2,
@@ -238,7 +687,15 @@ int main() {
         BST_test7,
         BST_test8,
         BST_test9,
-        BST_test10
+        BST_test10,
+        BST_test11,
+        BST_test12,
+        BST_test13,
+        BST_test14,
+        BST_test15,
+        BST_test16,
+        BST_test17,
+        BST_test18
     };
 
     for (int i = 0; i < TEST_SIZE; i++) {
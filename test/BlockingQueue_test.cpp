@@ -0,0 +1,132 @@
+#include "BlockingQueue.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+namespace cslib {
+    // Capacity, timeouts and closing on one thread
+    int BlockingQueue_test1() {
+        BlockingQueue<int> q(4);
+        for (int i = 0; i < 4; i++) {
+            if (!q.tryEnqueue(i)) {
+                return false;
+            }
+        }
+        if (q.tryEnqueue(4) || q.size() != 4) {
+            return false;
+        }
+
+        int batch[8];
+        if (q.dequeueBatch(batch, 3, std::chrono::milliseconds(0)) != 3 || batch[0] != 0 || batch[2] != 2) {
+            return false;
+        }
+
+        // Nothing comes, so it gives up
+        int value = 0;
+        if (!q.tryDequeue(value) || value != 3 || q.dequeueBatch(batch, 8, std::chrono::milliseconds(10)) != 0) {
+            return false;
+        }
+
+        // Closed, what's left still comes out
+        q.enqueue(5);
+        q.enqueue(6);
+        q.close();
+        if (q.enqueue(7) || q.tryEnqueue(7) || !q.closed()) {
+            return false;
+        }
+        if (!q.dequeue(value) || value != 5 || q.dequeueBatch(batch, 8, std::chrono::milliseconds(1000)) != 1 || batch[0] != 6) {
+            return false;
+        }
+
+        // Drained, nothing waits anymore
+        return (!q.dequeue(value) && q.dequeueBatch(batch, 8, std::chrono::milliseconds(1000)) == 0 && q.empty());
+    }
+
+    // Producers are held back, consumers drain in batches until it's closed
+    int BlockingQueue_test2() {
+        constexpr int producers = 3;
+        constexpr int consumers = 2;
+        constexpr int n = 20000;
+        BlockingQueue<int> q(64);
+        std::atomic<long long> sum{ 0 };
+        std::atomic<int> count{ 0 };
+        std::atomic<bool> bounded{ true };
+
+        std::thread* workers = new std::thread[producers + consumers];
+        for (int t = 0; t < producers; t++) {
+            workers[t] = std::thread([&q, t]() {
+                // One at a time, then in batches bigger than the capacity
+                int i = 0;
+                for (; i < n / 2; i++) {
+                    q.enqueue(t * n + i);
+                }
+
+                int batch[100];
+                while (i < n) {
+                    int size = (n - i < 100) ? n - i : 100;
+                    for (int j = 0; j < size; j++) {
+                        batch[j] = t * n + i + j;
+                    }
+                    i += (int)q.enqueueMany(batch, size);
+                }
+            });
+        }
+        for (int t = 0; t < consumers; t++) {
+            workers[producers + t] = std::thread([&q, &sum, &count, &bounded]() {
+                int batch[32];
+                while (true) {
+                    size_t taken = q.dequeueBatch(batch, 32, std::chrono::milliseconds(50));
+                    if (taken == 0) {
+                        if (q.closed() && q.empty()) {
+                            return;
+                        }
+                        continue;
+                    }
+                    if (q.size() > q.capacity()) {
+                        bounded = false;
+                    }
+                    for (size_t i = 0; i < taken; i++) {
+                        sum += batch[i];
+                        count++;
+                    }
+                }
+            });
+        }
+
+        for (int t = 0; t < producers; t++) {
+            workers[t].join();
+        }
+        q.close();
+        for (int t = 0; t < consumers; t++) {
+            workers[producers + t].join();
+        }
+        delete[] workers;
+
+        long long total = (long long)producers * n;
+        return (bounded && count == total && sum == total * (total - 1) / 2);
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 2;
+    testf_t test[TEST_SIZE] = {
+        BlockingQueue_test1,
+        BlockingQueue_test2
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
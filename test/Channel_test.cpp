@@ -0,0 +1,175 @@
+#include "Channel.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+
+namespace cslib {
+    /**
+     * @fn Channel_produce
+     * @brief Sends p_first up to p_first + p_count, closes the channel if it's the last producer
+     */
+    Task Channel_produce(Channel<int>& p_channel, int p_first, int p_count, std::atomic<int>& p_producers) {
+        for (int i = p_first; i < p_first + p_count; i++) {
+            if (!(co_await p_channel.send(i))) {
+                break;
+            }
+        }
+        if (--p_producers == 0) {
+            p_channel.close();
+        }
+    }
+
+    /**
+     * @fn Channel_consume
+     * @brief Receives until the channel is closed and drained, checks the values come in order if asked
+     */
+    Task Channel_consume(Channel<int>& p_channel, std::atomic<long long>& p_sum, std::atomic<int>& p_count, bool* p_ordered) {
+        int value = 0;
+        int last = -1;
+        while (co_await p_channel.receive(value)) {
+            if (p_ordered != nullptr && value != last + 1) {
+                *p_ordered = false;
+            }
+            last = value;
+            p_sum += value;
+            p_count++;
+        }
+    }
+
+    /**
+     * @fn Channel_stage
+     * @brief Adds one to every value on the way through, then closes the next channel
+     */
+    Task Channel_stage(Channel<int>& p_in, Channel<int>& p_out) {
+        int value = 0;
+        while (co_await p_in.receive(value)) {
+            co_await p_out.send(value + 1);
+        }
+        p_out.close();
+    }
+
+    // Buffered and unbuffered on one thread, with a long pipeline of stages
+    int Channel_test1() {
+        for (size_t capacity = 0; capacity <= 8; capacity += 8) {
+            constexpr int n = 1000;
+            LoopExecutor executor;
+            Channel<int> channel(capacity);
+            std::atomic<int> producers{ 1 };
+            std::atomic<long long> sum{ 0 };
+            std::atomic<int> count{ 0 };
+            bool ordered = true;
+
+            // The consumer waits first, the producer hands values over
+            executor.spawn(Channel_consume(channel, sum, count, &ordered));
+            executor.spawn(Channel_produce(channel, 0, n, producers));
+            executor.run();
+            if (!ordered || count != n || sum != (long long)n * (n - 1) / 2 || !channel.closed()) {
+                return false;
+            }
+        }
+
+        // Nothing to wait on outside of coroutines
+        Channel<int> unbuffered;
+        Channel<int> buffered(2);
+        int value = 0;
+        if (unbuffered.trySend(1) || unbuffered.tryReceive(value)) {
+            return false;
+        }
+        if (!buffered.trySend(1) || !buffered.trySend(2) || buffered.trySend(3) || buffered.size() != 2) {
+            return false;
+        }
+        buffered.close();
+        if (buffered.trySend(4) || !buffered.tryReceive(value) || value != 1 || !buffered.tryReceive(value) || value != 2 || buffered.tryReceive(value)) {
+            return false;
+        }
+
+        // A thousand stages on one thread, each one holds a value at most and keeps the order
+        constexpr int stages = 1000;
+        constexpr int n = 100;
+        LoopExecutor executor;
+        Channel<int>* channels = new Channel<int>[stages + 1];
+        std::atomic<int> producers{ 1 };
+        std::atomic<long long> sum{ 0 };
+        std::atomic<int> count{ 0 };
+        bool ordered = true;
+        for (int i = 0; i < stages; i++) {
+            executor.spawn(Channel_stage(channels[i], channels[i + 1]));
+        }
+        executor.spawn(Channel_consume(channels[stages], sum, count, &ordered));
+        executor.spawn(Channel_produce(channels[0], -stages, n, producers));
+        executor.run();
+        delete[] channels;
+
+        return (ordered && count == n && sum == (long long)n * (n - 1) / 2);
+    }
+
+    // Many producers and consumers on a pool of threads
+    int Channel_test2() {
+        for (size_t capacity = 0; capacity <= 16; capacity += 16) {
+            constexpr int producers = 8;
+            constexpr int consumers = 4;
+            constexpr int n = 5000;
+            ThreadPoolExecutor executor(4);
+            Channel<int> channel(capacity);
+            std::atomic<int> left{ producers };
+            std::atomic<long long> sum{ 0 };
+            std::atomic<int> count{ 0 };
+
+            for (int i = 0; i < consumers; i++) {
+                executor.spawn(Channel_consume(channel, sum, count, nullptr));
+            }
+            for (int i = 0; i < producers; i++) {
+                executor.spawn(Channel_produce(channel, i * n, n, left));
+            }
+            executor.wait();
+
+            long long total = (long long)producers * n;
+            if (count != total || sum != total * (total - 1) / 2) {
+                return false;
+            }
+        }
+
+        // Stages spread over the threads, values still come out in order
+        constexpr int stages = 64;
+        constexpr int n = 2000;
+        ThreadPoolExecutor executor(4);
+        Channel<int>* channels = new Channel<int>[stages + 1];
+        std::atomic<int> producers{ 1 };
+        std::atomic<long long> sum{ 0 };
+        std::atomic<int> count{ 0 };
+        bool ordered = true;
+        for (int i = 0; i < stages; i++) {
+            executor.spawn(Channel_stage(channels[i], channels[i + 1]));
+        }
+        executor.spawn(Channel_consume(channels[stages], sum, count, &ordered));
+        executor.spawn(Channel_produce(channels[0], -stages, n, producers));
+        executor.wait();
+        delete[] channels;
+
+        return (ordered && count == n && sum == (long long)n * (n - 1) / 2);
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 2;
+    testf_t test[TEST_SIZE] = {
+        Channel_test1,
+        Channel_test2
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include "ConcurrentQueue.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+namespace cslib {
+    // First in first out on one thread
+    int ConcurrentQueue_test1() {
+        constexpr int n = 1000;
+        ConcurrentQueue<int> q;
+
+        // Twice, the second time on recycled nodes
+        for (int round = 0; round < 2; round++) {
+            for (int i = 0; i < n; i++) {
+                q.enqueue(i);
+            }
+            for (int i = 0; i < n; i++) {
+                if (q.dequeue() != i) {
+                    return false;
+                }
+            }
+            Epoch::collect();
+        }
+
+        int value = 0;
+        CS_RANGE_TEST(q.dequeue(), OutOfRange);
+        return (q.empty() && !q.tryDequeue(value));
+    }
+
+    // Every value enqueued is dequeued exactly once, in order per producer
+    int ConcurrentQueue_test2() {
+        constexpr int producers = 2;
+        constexpr int consumers = 2;
+        constexpr int n = 50000;
+        ConcurrentQueue<int> q;
+        std::atomic<long long> sum{ 0 };
+        std::atomic<int> count{ 0 };
+        std::atomic<bool> ordered{ true };
+
+        std::thread* workers = new std::thread[producers + consumers];
+        for (int t = 0; t < producers; t++) {
+            workers[t] = std::thread([&q, t]() {
+                for (int i = 0; i < n; i++) {
+                    q.enqueue(t * n + i);
+                }
+            });
+        }
+        for (int t = 0; t < consumers; t++) {
+            workers[producers + t] = std::thread([&q, &sum, &count, &ordered]() {
+                int last[producers] = { -1, -1 };
+                int value = 0;
+                while (count.load() < producers * n) {
+                    if (!q.tryDequeue(value)) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    // A consumer sees each producer's values in the order they went in
+                    if (value <= last[value / n]) {
+                        ordered = false;
+                    }
+                    last[value / n] = value;
+                    sum += value;
+                    count++;
+                }
+            });
+        }
+        for (int t = 0; t < producers + consumers; t++) {
+            workers[t].join();
+        }
+        delete[] workers;
+
+        long long total = (long long)producers * n;
+        Epoch::collect();
+        return (ordered && count == total && sum == total * (total - 1) / 2 && q.empty());
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 2;
+    testf_t test[TEST_SIZE] = {
+        ConcurrentQueue_test1,
+        ConcurrentQueue_test2
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,160 @@
+#include "ConcurrentSkipList.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+namespace cslib {
+    // Ordered like a set on one thread
+    int ConcurrentSkipList_test1() {
+        constexpr int n = 5000;
+        ConcurrentSkipList<int, int> list;
+
+        // Insert out of order, twice
+        for (int i = 0; i < n; i++) {
+            int key = (i * 7919) % n;
+            if (!list.insert(key, key * 2) || list.insert(key, 0)) {
+                return false;
+            }
+        }
+        if (list.size() != n) {
+            return false;
+        }
+
+        // Erase the odd ones
+        for (int i = 1; i < n; i += 2) {
+            if (!list.erase(i) || list.erase(i)) {
+                return false;
+            }
+        }
+
+        // Walk in order
+        int expected = 0;
+        for (ConcurrentSkipList<int, int>::ConstIterator it = list.cbegin(); it != list.cend(); ++it) {
+            if (it.key() != expected || *it != expected * 2) {
+                return false;
+            }
+            expected += 2;
+        }
+
+        int value = 0;
+        if (!list.find(100, value) || value != 200 || list.find(101, value) || list.contains(-1)) {
+            return false;
+        }
+
+        // Copies are deep
+        ConcurrentSkipList<int, int> copy = list;
+        list.erase(0);
+        return (expected == n && copy.contains(0) && copy.size() == n / 2 && !list.contains(0));
+    }
+
+    // Range scans
+    int ConcurrentSkipList_test2() {
+        ConcurrentSkipList<int, int> list;
+        for (int i = 0; i < 1000; i += 10) {
+            list.insert(i, i);
+        }
+
+        int sum = 0;
+        size_t count = list.range(95, 200, [&sum](const int&, const int& p_value) {
+            sum += p_value;
+        });
+
+        // 100, 110 ... 190
+        if (count != 10 || sum != 1450) {
+            return false;
+        }
+
+        ConcurrentSkipList<int, int>::ConstIterator it = list.lowerBound(990);
+        if (it == list.cend() || it.key() != 990) {
+            return false;
+        }
+        ++it;
+        return (it == list.cend() && list.range(2000, 3000, [](const int&, const int&) {}) == 0);
+    }
+
+    // Writers and readers at once
+    int ConcurrentSkipList_test3() {
+        constexpr int threads = 4;
+        constexpr int n = 20000;
+        ConcurrentSkipList<int, int> list;
+        std::atomic<bool> failed{ false };
+
+        // Every writer owns the keys equal to its index modulo threads
+        std::thread* writers = new std::thread[threads];
+        for (int t = 0; t < threads; t++) {
+            writers[t] = std::thread([&list, &failed, t]() {
+                for (int i = t; i < n; i += threads) {
+                    if (!list.insert(i, -i)) {
+                        failed = true;
+                    }
+                }
+                // Take back every other one of ours
+                for (int i = t; i < n; i += 2 * threads) {
+                    if (!list.erase(i)) {
+                        failed = true;
+                    }
+                }
+            });
+        }
+
+        // A reader scanning while they work, it must always see order
+        std::thread reader([&list, &failed]() {
+            for (int pass = 0; pass < 50; pass++) {
+                int last = -1;
+                for (ConcurrentSkipList<int, int>::ConstIterator it = list.cbegin(); it != list.cend(); ++it) {
+                    if (it.key() <= last || *it != -it.key()) {
+                        failed = true;
+                    }
+                    last = it.key();
+                }
+            }
+        });
+
+        for (int t = 0; t < threads; t++) {
+            writers[t].join();
+        }
+        reader.join();
+        delete[] writers;
+
+        if (failed) {
+            return false;
+        }
+
+        // What's left is exactly the keys nobody erased
+        size_t count = 0;
+        for (ConcurrentSkipList<int, int>::ConstIterator it = list.cbegin(); it != list.cend(); ++it) {
+            if ((it.key() % (2 * threads)) < threads) {
+                return false;
+            }
+            count++;
+        }
+
+        Epoch::collect();
+        return (count == n / 2 && list.size() == n / 2);
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 3;
+    testf_t test[TEST_SIZE] = {
+        ConcurrentSkipList_test1,
+        ConcurrentSkipList_test2,
+        ConcurrentSkipList_test3
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
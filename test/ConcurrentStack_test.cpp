@@ -0,0 +1,88 @@
+#include "ConcurrentStack.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+namespace cslib {
+    // Last in first out on one thread
+    int ConcurrentStack_test1() {
+        constexpr int n = 1000;
+        ConcurrentStack<int> s;
+
+        for (int i = 0; i < n; i++) {
+            s.push(i);
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            if (s.pop() != i) {
+                return false;
+            }
+        }
+
+        int value = 0;
+        CS_RANGE_TEST(s.pop(), StackUnderflow);
+        return (s.empty() && !s.tryPop(value));
+    }
+
+    // Every value pushed is popped exactly once
+    int ConcurrentStack_test2() {
+        constexpr int threads = 4;
+        constexpr int n = 50000;
+        ConcurrentStack<int> s;
+        std::atomic<long long> sum{ 0 };
+        std::atomic<int> count{ 0 };
+
+        std::thread* workers = new std::thread[threads];
+        for (int t = 0; t < threads; t++) {
+            workers[t] = std::thread([&s, &sum, &count, t]() {
+                // Push one, pop one, so pushes and pops overlap
+                for (int i = 0; i < n; i++) {
+                    s.push(t * n + i);
+                    int value = 0;
+                    if (s.tryPop(value)) {
+                        sum += value;
+                        count++;
+                    }
+                }
+            });
+        }
+        for (int t = 0; t < threads; t++) {
+            workers[t].join();
+        }
+        delete[] workers;
+
+        // Whatever is left
+        int value = 0;
+        while (s.tryPop(value)) {
+            sum += value;
+            count++;
+        }
+
+        long long total = (long long)threads * n;
+        Epoch::collect();
+        return (count == total && sum == total * (total - 1) / 2);
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 2;
+    testf_t test[TEST_SIZE] = {
+        ConcurrentStack_test1,
+        ConcurrentStack_test2
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include "Deque.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace cslib {
+    // Both ends, across many blocks
+    int Deque_test1() {
+        constexpr int n = 5000;
+        Deque<int> d;
+
+        // Odd ones to the front, even ones to the back
+        for (int i = 0; i < n; i++) {
+            if (i % 2 == 0) {
+                d.pushBack(i);
+            } else {
+                d.pushFront(i);
+            }
+        }
+        if (d.size() != n || d.front() != n - 1 || d.back() != n - 2) {
+            return false;
+        }
+
+        // Front to back reads the odd ones down, then the even ones up
+        for (int i = 0; i < n; i++) {
+            int expected = (i < n / 2) ? n - 1 - 2 * i : 2 * (i - n / 2);
+            if (d[i] != expected) {
+                return false;
+            }
+        }
+
+        int index = 0;
+        for (Deque<int>::ConstIterator it = d.cbegin(); it != d.cend(); ++it) {
+            if (*it != d[index++]) {
+                return false;
+            }
+        }
+
+        for (int i = n - 2; i >= 0; i -= 2) {
+            if (d.popBack() != i) {
+                return false;
+            }
+        }
+        for (int i = n - 1; i >= 0; i -= 2) {
+            if (d.popFront() != i) {
+                return false;
+            }
+        }
+
+        CS_RANGE_TEST(d.popFront(), OutOfRange);
+        CS_RANGE_TEST(d.popBack(), OutOfRange);
+        CS_RANGE_TEST(d.front(), OutOfRange);
+        CS_RANGE_TEST(d[0], OutOfRange);
+
+        return (index == n && d.empty() && d.begin() == d.end());
+    }
+
+    // A sliding window, the values never move
+    int Deque_test2() {
+        constexpr int n = 20000;
+        constexpr int window = 100;
+        Deque<int> d;
+
+        for (int i = 0; i < window; i++) {
+            d.pushBack(i);
+        }
+        const int* last = &d.back();
+        for (int i = window; i < n; i++) {
+            d.pushBack(i);
+            if (d.popFront() != i - window) {
+                return false;
+            }
+            if (d.size() != window || (i < 2 * window - 1 && *last != window - 1)) {
+                return false;
+            }
+        }
+
+        // Pushing on the front a lot grows the map without moving anything
+        const int* back = &d.back();
+        for (int i = 0; i < n; i++) {
+            d.pushFront(-i);
+        }
+        if (*back != n - 1 || d.size() != window + n) {
+            return false;
+        }
+
+        // Copies are deep
+        Deque<int> copy = d;
+        d.clear();
+        return (d.empty() && copy.size() == window + n && copy.front() == -(n - 1) && copy.back() == n - 1);
+    }
+
+    // A window sliding far both ways keeps its values as the map recentres
+    int Deque_test3() {
+        constexpr int n = 200000;
+        constexpr int window = 100;
+        Deque<int> d;
+
+        for (int i = 0; i < window; i++) {
+            d.pushBack(i);
+        }
+        for (int i = window; i < n; i++) {
+            d.pushBack(i);
+            if (d.popFront() != i - window || d.front() != i - window + 1) {
+                return false;
+            }
+        }
+
+        // Back the other way, past where it started
+        for (int i = n - window - 1; i > -n; i--) {
+            d.pushFront(i);
+            if (d.popBack() != i + window || d.back() != i + window - 1) {
+                return false;
+            }
+        }
+
+        for (int i = 0; i < window; i++) {
+            if (d[i] != -n + 1 + i) {
+                return false;
+            }
+        }
+        return (d.size() == window);
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 3;
+    testf_t test[TEST_SIZE] = {
+        Deque_test1,
+        Deque_test2,
+        Deque_test3
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include "DoublyLinkedList.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace cslib {
+    // Append, prepend and read both ways
+    int DoublyLinkedList_test1() {
+        constexpr int n = 1000;
+        DoublyLinkedList<int> dl;
+
+        for (int i = 0; i < n; i++) {
+            if (i % 2 == 0) {
+                dl.append(i);
+            } else {
+                dl.prepend(-i);
+            }
+        }
+
+        if (dl.size() != n) {
+            return false;
+        }
+
+        // Forwards matches index
+        size_t index = 0;
+        for (DoublyLinkedList<int>::ConstIterator it = dl.cbegin(); it != dl.cend(); ++it) {
+            if (*it != dl[index]) {
+                return false;
+            }
+            index++;
+        }
+
+        // Backwards is forwards reversed
+        for (DoublyLinkedList<int>::Iterator it = dl.rbegin(); it != dl.rend(); --it) {
+            index--;
+            if (*it != dl[index]) {
+                return false;
+            }
+        }
+
+        // Stepping off the end comes back in at either side
+        DoublyLinkedList<int>::Iterator back = dl.end();
+        DoublyLinkedList<int>::ConstIterator front = dl.crend();
+        --back;
+        ++front;
+        if (*back != dl.back() || *front != dl.front() || --dl.rend() != dl.rbegin()) {
+            return false;
+        }
+
+        return (index == 0 && dl.front() == -(n - 1) && dl.back() == n - 2);
+    }
+
+    // Removes through iterators while walking
+    int DoublyLinkedList_test2() {
+        DoublyLinkedList<int> dl;
+        for (int i = 0; i < 100; i++) {
+            dl.append(i);
+        }
+
+        // Drop every odd value in one pass
+        DoublyLinkedList<int>::Iterator it = dl.begin();
+        while (it != dl.end()) {
+            DoublyLinkedList<int>::Iterator next = it;
+            ++next;
+            if (*it % 2 == 1) {
+                dl.remove(it);
+            }
+            it = next;
+        }
+
+        if (dl.size() != 50) {
+            return false;
+        }
+
+        // Insert before each value through iterators
+        for (it = dl.begin(); it != dl.end(); ++it) {
+            dl.insert(it, *it + 1);
+        }
+
+        for (size_t i = 0; i < dl.size(); i += 2) {
+            if (dl[i] != (int)i + 1 || dl[i + 1] != (int)i) {
+                return false;
+            }
+        }
+
+        return (dl.size() == 100);
+    }
+
+    // Pops, copies and bounds
+    int DoublyLinkedList_test3() {
+        DoublyLinkedList<int> dl;
+        for (int i = 0; i < 10; i++) {
+            dl.insert(i, i);
+        }
+
+        DoublyLinkedList<int> copy = dl;
+        if (dl.popFront() != 0 || dl.popBack() != 9 || dl.remove(3) != 4) {
+            return false;
+        }
+        if (dl.size() != 7 || copy.size() != 10 || copy[9] != 9) {
+            return false;
+        }
+
+        copy = dl;
+        while (!copy.empty()) {
+            copy.popBack();
+        }
+
+        CS_RANGE_TEST(copy.popFront(), OutOfRange);
+        CS_RANGE_TEST(copy.back(), OutOfRange);
+        CS_RANGE_TEST(dl[7], OutOfRange);
+        CS_RANGE_TEST(dl.insert(0, (size_t)8), OutOfRange);
+
+        // Iterators only work on the list they came from, both lists are left alone
+        copy.insert(42, (size_t)0);
+        CS_RANGE_TEST(copy.remove(dl.begin()), OutOfRange);
+        CS_RANGE_TEST(copy.insert(dl.end(), 1), OutOfRange);
+        CS_RANGE_TEST(dl.insert(copy.begin(), 1), OutOfRange);
+        CS_RANGE_TEST(dl.remove(DoublyLinkedList<int>::Iterator()), OutOfRange);
+        if (dl.size() != 7 || dl.front() != 1 || dl.back() != 8 || copy.size() != 1 || copy.popBack() != 42) {
+            return false;
+        }
+
+        return (copy.size() == 0 && copy.begin() == copy.end());
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 3;
+    testf_t test[TEST_SIZE] = {
+        DoublyLinkedList_test1,
+        DoublyLinkedList_test2,
+        DoublyLinkedList_test3
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include "IntrusiveList.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace cslib {
+    struct RecentTag {};
+    struct DirtyTag {};
+
+    // An object that sits in two lists at once
+    struct Entry : public IntrusiveListHook<RecentTag>, public IntrusiveListHook<DirtyTag> {
+        int key;
+    };
+
+    // Links, moves and unlinks without allocating
+    int IntrusiveList_test1() {
+        constexpr int n = 16;
+        Entry entries[n];
+        IntrusiveList<Entry, RecentTag> recent;
+
+        for (int i = 0; i < n; i++) {
+            entries[i].key = i;
+            recent.pushFront(entries[i]);
+        }
+
+        // Touch a few, least recent falls to the back
+        recent.moveToFront(entries[0]);
+        recent.moveToFront(entries[1]);
+        if (recent.front().key != 1 || recent.back().key != 2) {
+            return false;
+        }
+
+        // Evict from the back
+        Entry& evicted = recent.popBack();
+        if (evicted.key != 2 || recent.contains(evicted) || recent.size() != n - 1) {
+            return false;
+        }
+
+        recent.remove(entries[8]);
+        CS_RANGE_TEST(recent.remove(entries[8]), IntrusiveListHookInUse);
+        CS_RANGE_TEST(recent.pushBack(entries[0]), IntrusiveListHookInUse);
+
+        // Walk it both ways
+        int count = 0;
+        for (IntrusiveList<Entry, RecentTag>::Iterator it = recent.begin(); it != recent.end(); ++it) {
+            if (it->key == 8 || it->key == 2) {
+                return false;
+            }
+            count++;
+        }
+        for (IntrusiveList<Entry, RecentTag>::Iterator it = recent.rbegin(); it != recent.end(); --it) {
+            count--;
+        }
+
+        // Stepping off the end comes back in at either side
+        IntrusiveList<Entry, RecentTag>::Iterator last = recent.end();
+        IntrusiveList<Entry, RecentTag>::Iterator first = recent.end();
+        if (--last != recent.rbegin() || ++first != recent.begin()) {
+            return false;
+        }
+
+        return (count == 0 && (int)recent.size() == n - 2);
+    }
+
+    // One object in two lists through two hooks
+    int IntrusiveList_test2() {
+        Entry entries[4];
+        IntrusiveList<Entry, DirtyTag> dirty;
+        {
+            IntrusiveList<Entry, RecentTag> recent;
+            for (int i = 0; i < 4; i++) {
+                entries[i].key = i;
+                recent.pushBack(entries[i]);
+                if (i % 2 == 0) {
+                    dirty.pushBack(entries[i]);
+                }
+            }
+
+            recent.remove(entries[2]);
+            if (!dirty.contains(entries[2]) || dirty.size() != 2) {
+                return false;
+            }
+        }
+
+        // Destroying the list leaves its objects unlinked
+        for (int i = 0; i < 4; i++) {
+            if (static_cast<IntrusiveListHook<RecentTag>&>(entries[i]).linked()) {
+                return false;
+            }
+        }
+
+        dirty.clear();
+        CS_RANGE_TEST(dirty.popFront(), OutOfRange);
+        return (dirty.empty());
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 2;
+    testf_t test[TEST_SIZE] = {
+        IntrusiveList_test1,
+        IntrusiveList_test2
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
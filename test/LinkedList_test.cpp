@@ -281,6 +281,193 @@ namespace cslib {
         ll.remove(9);
 
         CS_RANGE_TEST(ll[9], OutOfRange);
+
+        return (ll.size() == 9);
+    }
+
+    // Node recycling
+    int LinkedList_test11() {
+        constexpr size_t n = 256;
+        LinkedList<int> ll;
+
+        // Fill and drain a few times, only the first round needs fresh nodes
+        for (size_t round = 0; round < 4; round++) {
+            for (size_t i = 0; i < n; i++) {
+                ll.append(i);
+            }
+            while (ll.size() != 0) {
+                ll.remove(0);
+            }
+        }
+
+        NodePoolStats stats = ll.poolStats();
+        if (stats.requests != 4 * n || stats.recycled != 3 * n || stats.live != 0) {
+            return false;
+        }
+
+        // Lists on the shared pool recycle each other's nodes
+        LinkedList<int> left(true);
+        LinkedList<int> right(true);
+        for (size_t i = 0; i < n; i++) {
+            left.append(i);
+        }
+        while (left.size() != 0) {
+            left.remove(0);
+        }
+        for (size_t i = 0; i < n; i++) {
+            right.append(i);
+        }
+
+        return (right.poolStats().recycled >= n && right.poolStats().hitRate() > 0.0);
+    }
+
+    // Cursor stays correct through inserts and removes
+    int LinkedList_test12() {
+        constexpr size_t n = 2048;
+        int expected[n];
+        size_t size = 0;
+        LinkedList<int> ll;
+
+        unsigned int seed = 12345;
+        for (size_t step = 0; step < 8 * n; step++) {
+            seed = seed * 1103515245 + 12345;
+            size_t r = (seed >> 8);
+
+            // Insert somewhere, remove somewhere or read around
+            if (size == 0 || (r % 3 == 0 && size < n)) {
+                size_t at = r % (size + 1);
+                ll.insert((int)step, at);
+                for (size_t i = size; i > at; i--) {
+                    expected[i] = expected[i - 1];
+                }
+                expected[at] = (int)step;
+                size++;
+            } else if (r % 3 == 1) {
+                size_t at = r % size;
+                if (ll.remove(at) != expected[at]) {
+                    return false;
+                }
+                for (size_t i = at; i + 1 < size; i++) {
+                    expected[i] = expected[i + 1];
+                }
+                size--;
+            } else {
+                size_t at = r % size;
+                size_t end = (at + 8 < size) ? at + 8 : size;
+                for (size_t i = at; i < end; i++) {
+                    if (ll[i] != expected[i]) {
+                        return false;
+                    }
+                }
+            }
+
+            if (ll.size() != size) {
+                return false;
+            }
+        }
+
+        // Walk it all one last time
+        for (size_t i = 0; i < size; i++) {
+            if (ll[i] != expected[i]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // Reverse, splice and split only move nodes
+    int LinkedList_test13() {
+        LinkedList<int> ll;
+        LinkedList<int> other;
+        for (int i = 0; i < 10; i++) {
+            ll.append(i);
+            other.append(100 + i);
+        }
+
+        ll.reverse();
+        if (ll[0] != 9 || ll[9] != 0 || ll.size() != 10) {
+            return false;
+        }
+        LinkedList_reverse(ll);
+
+        // Take 100..104 into the middle
+        ll.splice(5, other, 0, 5);
+        if (ll.size() != 15 || other.size() != 5 || ll[5] != 100 || ll[9] != 104 || ll[10] != 5 || other[0] != 105) {
+            return false;
+        }
+
+        // The rest on the end, appending must still work
+        ll.splice(ll.size(), other);
+        ll.append(200);
+        if (ll.size() != 21 || other.size() != 0 || ll[19] != 109 || ll[20] != 200) {
+            return false;
+        }
+
+        // Split it back off, the nodes keep working in the other list
+        ll.split(15, other);
+        other.append(300);
+        if (ll.size() != 15 || other.size() != 7 || other[0] != 105 || other[6] != 300 || ll[14] != 9) {
+            return false;
+        }
+
+        CS_RANGE_TEST(ll.splice(16, other, 0, 1), OutOfRange);
+        CS_RANGE_TEST(ll.splice(0, other, 5, 3), OutOfRange);
+        CS_RANGE_TEST(ll.splice(0, ll), LinkedListException);
+
+        // Nothing new was made for the moves
+        return (ll.poolStats().requests == 11 && other.poolStats().requests == 11);
+    }
+
+    // Merging and sorting, both stable
+    int LinkedList_test14() {
+        constexpr size_t n = 3000;
+        LinkedList<double> ll;
+
+        // Equal keys carry their order in the fraction
+        unsigned int seed = 4242;
+        for (size_t i = 0; i < n; i++) {
+            seed = seed * 1103515245 + 12345;
+            ll.append((double)((seed >> 8) % 100) + (double)i / n);
+        }
+
+        // Stable sorting by the key alone keeps the fractions increasing
+        struct Key {
+            double value;
+            bool operator<(const Key& p_key) const { return (int)this->value < (int)p_key.value; }
+        };
+        LinkedList<Key> keys;
+        for (LinkedList<double>::ConstIterator it = ll.cbegin(); it != ll.cend(); ++it) {
+            keys.append(Key{ *it });
+        }
+        keys.sort();
+
+        Key last = keys[0];
+        for (LinkedList<Key>::ConstIterator it = keys.cbegin(); it != keys.cend(); ++it) {
+            if ((*it) < last || (!(last < (*it)) && it->value < last.value)) {
+                return false;
+            }
+            last = *it;
+        }
+
+        // Sort two halves and merge them back together
+        LinkedList<double> half;
+        ll.split(n / 2, half);
+        ll.sort();
+        half.sort();
+        ll.merge(half);
+        ll.append(1000.0);
+
+        if (ll.size() != n + 1 || half.size() != 0) {
+            return false;
+        }
+        for (size_t i = 1; i < n; i++) {
+            if (ll[i] < ll[i - 1]) {
+                return false;
+            }
+        }
+
+        return (ll[n] == 1000.0);
     }
 }
 
@@ -291,7 +478,7 @@ typedef int(*testf_t)(void);
 int main() {
     using namespace cslib;
 
-    constexpr size_t TEST_SIZE = 10;
+    constexpr size_t TEST_SIZE = 14;
     testf_t test[TEST_SIZE] = { 
         LinkedList_test1,
         LinkedList_test2,
@@ -302,7 +489,11 @@ int main() {
         LinkedList_test7,
         LinkedList_test8,
         LinkedList_test9,
-        LinkedList_test10
+        LinkedList_test10,
+        LinkedList_test11,
+        LinkedList_test12,
+        LinkedList_test13,
+        LinkedList_test14
     };
 
     for (int i = 0; i < TEST_SIZE; i++) {
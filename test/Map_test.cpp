@@ -0,0 +1,126 @@
+#include "Map.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace cslib {
+    // Keys 10, 20 ... 100, each holding a tenth of itself
+    Map<int, int> Map_testTens() {
+        Map<int, int> map;
+        for (int i = 10; i >= 1; i--) {
+            map[i * 10] = i;
+        }
+        return map;
+    }
+
+    // Bounds on keys that are there, missing between, below the smallest and above the biggest
+    int Map_test1() {
+        Map<int, int> map = Map_testTens();
+
+        if (map.lowerBound(50)->key != 50 || map.upperBound(50)->key != 60 ||
+            map.lowerBound(55)->key != 60 || map.upperBound(55)->key != 60 ||
+            map.lowerBound(-5)->key != 10 || map.upperBound(-5)->key != 10 ||
+            map.lowerBound(101) != map.end() || map.upperBound(100) != map.end()) {
+            return false;
+        }
+        if (map.lowerBound(55)->data != 6 || (--map.upperBound(1000))->key != 100 || map.last()->key != 100 || --map.last() != map.lowerBound(90)) {
+            return false;
+        }
+
+        if (map.floor(55) != 50 || map.floor(50) != 50 || map.floor(1000) != 100 ||
+            map.ceiling(55) != 60 || map.ceiling(60) != 60 || map.ceiling(-1000) != 10) {
+            return false;
+        }
+        CS_RANGE_TEST(map.floor(9), BSTNodeNotFound);
+        CS_RANGE_TEST(map.ceiling(101), BSTNodeNotFound);
+
+        Map<int, int> empty;
+        CS_RANGE_TEST(empty.floor(0), BSTNodeNotFound);
+        CS_RANGE_TEST(empty.ceiling(0), BSTNodeNotFound);
+        return (empty.lowerBound(0) == empty.end() && empty.upperBound(0) == empty.end());
+    }
+
+    // Ranges keep the from key and stop before the to key
+    int Map_test2() {
+        Map<int, int> map = Map_testTens();
+
+        int expected = 30;
+        map.range(30, 60, [&](const int& p_key, const int& p_data) {
+            if (p_key == expected && p_data == expected / 10) {
+                expected += 10;
+            }
+        });
+        if (expected != 60) {
+            return false;
+        }
+
+        // Ends that aren't keys, and ends past both sides
+        int count = 0;
+        map.range(25, 61, [&](const int&, const int&) {
+            count++;
+        });
+        map.range(-100, 1000, [&](const int&, const int&) {
+            count += 100;
+        });
+        if (count != 4 + 1000) {
+            return false;
+        }
+
+        // Nothing when the ends meet or cross, or miss the keys
+        map.range(50, 50, [&](const int&, const int&) {
+            count++;
+        });
+        map.range(80, 20, [&](const int&, const int&) {
+            count++;
+        });
+        map.range(101, 200, [&](const int&, const int&) {
+            count++;
+        });
+        map.range(-10, 10, [&](const int&, const int&) {
+            count++;
+        });
+        return (count == 1004);
+    }
+
+    // select and rank for keys there, missing, and past both ends
+    int Map_test3() {
+        Map<int, int> map = Map_testTens();
+
+        for (size_t i = 0; i < 10; i++) {
+            int key = (int)(i + 1) * 10;
+            if (map.select(i) != key || map.rank(key) != i || map.rank(key + 5) != i + 1) {
+                return false;
+            }
+        }
+        CS_RANGE_TEST(map.select(10), OutOfRange);
+
+        Map<int, int> empty;
+        CS_RANGE_TEST(empty.select(0), OutOfRange);
+
+        return (map.rank(-1) == 0 && map.rank(1000) == 10 && empty.rank(0) == 0 && map.size() == 10);
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 3;
+    testf_t test[TEST_SIZE] = {
+        Map_test1,
+        Map_test2,
+        Map_test3
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
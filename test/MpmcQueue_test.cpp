@@ -0,0 +1,128 @@
+#include "MpmcQueue.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+namespace cslib {
+    // Filling and wrapping on one thread
+    int MpmcQueue_test1() {
+        MpmcQueue<int> q(100);
+        if (q.capacity() != 128 || !q.empty()) {
+            return false;
+        }
+
+        int next = 0;
+        int expected = 0;
+        for (int round = 0; round < 5; round++) {
+            while (q.tryEnqueue(next)) {
+                next++;
+            }
+            if (q.size() != 128) {
+                return false;
+            }
+
+            // Blocking and non blocking take turns
+            int value = 0;
+            for (int i = 0; i < 100; i++) {
+                if (i % 2 == 0) {
+                    value = q.dequeue();
+                } else if (!q.tryDequeue(value)) {
+                    return false;
+                }
+                if (value != expected++) {
+                    return false;
+                }
+            }
+            q.enqueue(next++);
+        }
+
+        int value = 0;
+        while (q.tryDequeue(value)) {
+            if (value != expected++) {
+                return false;
+            }
+        }
+
+        return (expected == next && q.empty() && !q.tryDequeue(value));
+    }
+
+    // Every value enqueued is dequeued exactly once, in order per producer
+    int MpmcQueue_test2() {
+        constexpr int producers = 3;
+        constexpr int consumers = 3;
+        constexpr int n = 50000;
+        MpmcQueue<int> q(64);
+        std::atomic<long long> sum{ 0 };
+        std::atomic<int> count{ 0 };
+        std::atomic<bool> ordered{ true };
+
+        std::thread* workers = new std::thread[producers + consumers];
+        for (int t = 0; t < producers; t++) {
+            workers[t] = std::thread([&q, t]() {
+                for (int i = 0; i < n; i++) {
+                    if (i % 2 == 0) {
+                        q.enqueue(t * n + i);
+                        continue;
+                    }
+                    while (!q.tryEnqueue(t * n + i)) {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (int t = 0; t < consumers; t++) {
+            workers[producers + t] = std::thread([&q, &sum, &count, &ordered, t]() {
+                int last[producers] = { -1, -1, -1 };
+                for (int i = 0; i < n; i++) {
+                    int value = 0;
+                    if (t == 0) {
+                        while (!q.tryDequeue(value)) {
+                            std::this_thread::yield();
+                        }
+                    } else {
+                        value = q.dequeue();
+                    }
+
+                    // A consumer sees each producer's values in the order they went in
+                    if (value <= last[value / n]) {
+                        ordered = false;
+                    }
+                    last[value / n] = value;
+                    sum += value;
+                    count++;
+                }
+            });
+        }
+        for (int t = 0; t < producers + consumers; t++) {
+            workers[t].join();
+        }
+        delete[] workers;
+
+        long long total = (long long)producers * n;
+        return (ordered && count == total && sum == total * (total - 1) / 2 && q.empty());
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 2;
+    testf_t test[TEST_SIZE] = {
+        MpmcQueue_test1,
+        MpmcQueue_test2
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
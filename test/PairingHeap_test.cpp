@@ -0,0 +1,153 @@
+#include "PairingHeap.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace cslib {
+    // Pops come out in order, whatever order they went in
+    int PairingHeap_test1() {
+        constexpr size_t n = 5000;
+        PairingHeap<int> h;
+
+        unsigned int seed = 17;
+        for (size_t i = 0; i < n; i++) {
+            seed = seed * 1103515245 + 12345;
+            h.push((int)((seed >> 8) % 1000));
+        }
+        if (h.size() != n) {
+            return false;
+        }
+
+        // Copies are deep
+        PairingHeap<int> copy = h;
+
+        int last = -1;
+        while (!h.empty()) {
+            int value = h.pop();
+            if (value < last) {
+                return false;
+            }
+            last = value;
+        }
+
+        CS_RANGE_TEST(h.pop(), OutOfRange);
+        CS_RANGE_TEST(h.top(), OutOfRange);
+
+        return (copy.size() == n && h.size() == 0);
+    }
+
+    // Handles follow their values through decreaseKey and erase
+    int PairingHeap_test2() {
+        constexpr size_t n = 500;
+        PairingHeap<int> h;
+        PairingHeap<int>::Handle handles[n];
+
+        for (size_t i = 0; i < n; i++) {
+            handles[i] = h.push((int)(1000 + i));
+        }
+
+        // Pop once so the nodes are spread across a tree, not all under the root
+        if (h.pop() != 1000) {
+            return false;
+        }
+
+        // Bring the odd ones under the even ones, backwards
+        for (size_t i = 1; i < n; i += 2) {
+            h.decreaseKey(handles[i], (int)(n - i));
+            if (h.get(handles[i]) != (int)(n - i)) {
+                return false;
+            }
+        }
+        CS_RANGE_TEST(h.decreaseKey(handles[2], 5000), PriorityQueueKeyIncreased);
+        if (h.top() != 1) {
+            return false;
+        }
+
+        // Every fourth even one leaves, and the top
+        size_t erased = 0;
+        for (size_t i = 8; i < n; i += 8) {
+            if (h.erase(handles[i]) != (int)(1000 + i)) {
+                return false;
+            }
+            erased++;
+        }
+        if (h.erase(handles[n - 1]) != 1) {
+            return false;
+        }
+        erased++;
+
+        int last = -1;
+        size_t count = 0;
+        while (!h.empty()) {
+            int value = h.pop();
+            if (value < last) {
+                return false;
+            }
+            last = value;
+            count++;
+        }
+
+        return (count == n - 1 - erased);
+    }
+
+    // Melding moves everything over and keeps handles working
+    int PairingHeap_test3() {
+        PairingHeap<int> left;
+        PairingHeap<int> right;
+        PairingHeap<int>::Handle handle = nullptr;
+
+        for (int i = 0; i < 100; i++) {
+            left.push(2 * i);
+            if (i == 50) {
+                handle = right.push(2 * i + 1);
+            } else {
+                right.push(2 * i + 1);
+            }
+        }
+
+        left.meld(right);
+        if (left.size() != 200 || !right.empty()) {
+            return false;
+        }
+
+        // The other heap still works after giving everything away
+        right.push(7);
+        left.decreaseKey(handle, -1);
+
+        if (left.pop() != -1) {
+            return false;
+        }
+        for (int i = 0; i < 199; i++) {
+            int expected = (i < 101) ? i : i + 1;
+            if (left.pop() != expected) {
+                return false;
+            }
+        }
+
+        return (left.empty() && right.size() == 1 && right.top() == 7);
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 3;
+    testf_t test[TEST_SIZE] = {
+        PairingHeap_test1,
+        PairingHeap_test2,
+        PairingHeap_test3
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
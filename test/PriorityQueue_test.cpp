@@ -0,0 +1,151 @@
+#include "PriorityQueue.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace cslib {
+    // Pops come out in order, whatever order they went in
+    int PriorityQueue_test1() {
+        constexpr size_t n = 5000;
+        PriorityQueue<int> q;
+
+        unsigned int seed = 31;
+        for (size_t i = 0; i < n; i++) {
+            seed = seed * 1103515245 + 12345;
+            q.push((int)((seed >> 8) % 1000));
+        }
+        if (q.size() != n) {
+            return false;
+        }
+
+        int last = -1;
+        while (!q.empty()) {
+            int value = q.pop();
+            if (value < last) {
+                return false;
+            }
+            last = value;
+        }
+
+        CS_RANGE_TEST(q.pop(), OutOfRange);
+        CS_RANGE_TEST(q.top(), OutOfRange);
+
+        // A binary max heap the other way round
+        PriorityQueue<int, std::greater<int>, 2> max;
+        for (int i = 0; i < 100; i++) {
+            max.push(i * 37 % 100);
+        }
+        for (int i = 99; i >= 0; i--) {
+            if (max.pop() != i) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Building from a Vector and pushing in batches
+    int PriorityQueue_test2() {
+        constexpr size_t n = 1000;
+        Vector<int> values;
+        for (size_t i = 0; i < n; i++) {
+            values.push((int)((i * 7919) % n));
+        }
+
+        PriorityQueue<int> q(values);
+        if (q.size() != n || q.top() != 0) {
+            return false;
+        }
+
+        // Small batches sift, big ones rebuild
+        int batch[n];
+        for (size_t i = 0; i < n; i++) {
+            batch[i] = (int)(n + (i * 31) % n);
+        }
+        q.pushMany(batch, 10);
+        q.pushMany(batch + 10, n - 10);
+
+        for (size_t i = 0; i < 2 * n; i++) {
+            if (q.pop() != (int)i) {
+                return false;
+            }
+        }
+        return q.empty();
+    }
+
+    // Handles follow their values through decreaseKey, update and erase
+    int PriorityQueue_test3() {
+        constexpr size_t n = 500;
+        IndexedPriorityQueue<int> q;
+        IndexedPriorityQueue<int>::Handle handles[n];
+
+        for (size_t i = 0; i < n; i++) {
+            handles[i] = q.push((int)(1000 + i));
+        }
+
+        // Bring the odd ones under the even ones, backwards
+        for (size_t i = 1; i < n; i += 2) {
+            q.decreaseKey(handles[i], (int)(n - i));
+        }
+        CS_RANGE_TEST(q.decreaseKey(handles[0], 5000), PriorityQueueKeyIncreased);
+
+        // Every fourth even one leaves
+        size_t erased = 0;
+        for (size_t i = 0; i < n; i += 8) {
+            erased = i;
+            if (q.erase(handles[i]) != (int)(1000 + i) || q.contains(handles[i])) {
+                return false;
+            }
+        }
+        CS_RANGE_TEST(q.erase(handles[0]), OutOfRange);
+        CS_RANGE_TEST(q.get(handles[0]), OutOfRange);
+
+        // Push one to the back
+        q.update(handles[1], 100000);
+        if (q.get(handles[1]) != 100000) {
+            return false;
+        }
+
+        // Freed handles get reused
+        IndexedPriorityQueue<int>::Handle reused = q.push(-1);
+        if (reused != handles[erased] || q.topHandle() != reused || q.pop() != -1) {
+            return false;
+        }
+
+        int last = -1;
+        size_t count = 0;
+        while (!q.empty()) {
+            int value = q.pop();
+            if (value < last) {
+                return false;
+            }
+            last = value;
+            count++;
+        }
+
+        return (count == n - (n + 7) / 8 && last == 100000);
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 3;
+    testf_t test[TEST_SIZE] = {
+        PriorityQueue_test1,
+        PriorityQueue_test2,
+        PriorityQueue_test3
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+#include "Queue.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace cslib {
+    // Enqueue test
+    int Queue_test1() {
+        constexpr size_t n = 1000;
+        Queue<int> q;
+
+        for (size_t i = 0; i < n; i++) {
+            q.enqueue(i);
+        }
+        if (q.size() != n || q.front() != 0) {
+            return false;
+        }
+
+        // Front to back
+        int expected = 0;
+        for (Queue<int>::Iterator it = q.begin(); it != q.end(); ++it) {
+            if (*it != expected) {
+                return false;
+            }
+            expected++;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            if (q.dequeue() != (int)i) {
+                return false;
+            }
+        }
+
+        CS_RANGE_TEST(q.dequeue(), OutOfRange);
+        CS_RANGE_TEST(q.front(), OutOfRange);
+
+        return (expected == n && q.empty());
+    }
+
+    // Ring buffer wrapping and growing
+    int Queue_test2() {
+        constexpr size_t n = 5000;
+        Queue<int, RingBuffer<int>> q;
+
+        // Keep a few in while going around, so the front isn't at the start when it grows
+        int next = 0;
+        int expected = 0;
+        for (size_t i = 0; i < n; i++) {
+            q.enqueue(next++);
+            q.enqueue(next++);
+            if (q.dequeue() != expected++) {
+                return false;
+            }
+        }
+        if (q.size() != n || q.front() != expected) {
+            return false;
+        }
+
+        for (Queue<int, RingBuffer<int>>::ConstIterator it = q.cbegin(); it != q.cend(); ++it) {
+            if (*it != expected) {
+                return false;
+            }
+            expected++;
+        }
+
+        // Copies are deep
+        Queue<int, RingBuffer<int>> copy = q;
+        while (!q.empty()) {
+            q.dequeue();
+        }
+
+        CS_RANGE_TEST(q.dequeue(), OutOfRange);
+        CS_RANGE_TEST(q.front(), OutOfRange);
+
+        return (expected == next && copy.size() == n && copy.front() == n);
+    }
+
+    // Ring buffer bulk enqueue and dequeue
+    int Queue_test3() {
+        constexpr size_t n = 1000;
+        int values[n];
+        for (size_t i = 0; i < n; i++) {
+            values[i] = i;
+        }
+
+        Queue<int, RingBuffer<int>> q;
+        q.reserve(n + 1);
+        q.enqueue(-1);
+        if (q.dequeue() != -1) {
+            return false;
+        }
+
+        // Goes past the end of the array and around
+        q.enqueueMany(values, n);
+        q.enqueue(-1);
+
+        int dequeued[n];
+        size_t total = 0;
+        while (total < n) {
+            size_t count = q.dequeueMany(dequeued, 7);
+            for (size_t i = 0; i < count && total + i < n; i++) {
+                if (dequeued[i] != (int)(total + i)) {
+                    return false;
+                }
+            }
+            total += count;
+        }
+
+        // Asking for more than there is gives what's left
+        return (total == n + 1 && dequeued[n % 7] == -1 && q.empty() && q.dequeueMany(dequeued, 10) == 0);
+    }
+
+    // Growing while the new value is one of ours
+    int Queue_test4() {
+        Queue<LinkedList<int>, RingBuffer<LinkedList<int>>> q;
+        LinkedList<int> list;
+        list.append(7);
+        q.enqueue(list);
+
+        // Every doubling copies the front out of the array being freed
+        for (int i = 0; i < 100; i++) {
+            q.enqueue(q.front());
+        }
+
+        size_t count = 0;
+        while (!q.empty()) {
+            LinkedList<int> front = q.dequeue();
+            if (front.size() != 1 || front[0] != 7) {
+                return false;
+            }
+            count++;
+        }
+        return (count == 101);
+    }
+}
+
+
+
+typedef int(*testf_t)(void);
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 4;
+    testf_t test[TEST_SIZE] = {
+        Queue_test1,
+        Queue_test2,
+        Queue_test3,
+        Queue_test4
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
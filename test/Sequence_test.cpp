@@ -0,0 +1,166 @@
+#include "Sequence.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace cslib {
+    // Inserts, removes and reads anywhere against an array
+    int Sequence_test1() {
+        constexpr size_t n = 2048;
+        int expected[n];
+        size_t size = 0;
+        Sequence<int> seq;
+
+        unsigned int seed = 99;
+        for (size_t step = 0; step < 16 * n; step++) {
+            seed = seed * 1103515245 + 12345;
+            size_t r = (seed >> 8);
+
+            if (size == 0 || (r % 3 == 0 && size < n)) {
+                size_t at = r % (size + 1);
+                seq.insert((int)step, at);
+                for (size_t i = size; i > at; i--) {
+                    expected[i] = expected[i - 1];
+                }
+                expected[at] = (int)step;
+                size++;
+            } else if (r % 3 == 1) {
+                size_t at = r % size;
+                if (seq.remove(at) != expected[at]) {
+                    return false;
+                }
+                for (size_t i = at; i + 1 < size; i++) {
+                    expected[i] = expected[i + 1];
+                }
+                size--;
+            } else {
+                size_t at = r % size;
+                if (seq[at] != expected[at]) {
+                    return false;
+                }
+            }
+
+            if (seq.size() != size) {
+                return false;
+            }
+        }
+
+        // Walk it in order
+        size_t i = 0;
+        for (Sequence<int>::ConstIterator it = seq.cbegin(); it != seq.cend(); ++it) {
+            if (*it != expected[i]) {
+                return false;
+            }
+            i++;
+        }
+
+        return (i == size);
+    }
+
+    // Splitting and joining
+    int Sequence_test2() {
+        constexpr int n = 10000;
+        Sequence<int> seq;
+        for (int i = 0; i < n; i++) {
+            seq.append(i);
+        }
+
+        // Rotate by cutting the front off and putting it on the back
+        Sequence<int> tail;
+        seq.split(n / 4, tail);
+        if (seq.size() != n / 4 || tail.size() != n - n / 4) {
+            return false;
+        }
+        tail.concat(seq);
+        if (seq.size() != 0 || tail.size() != n) {
+            return false;
+        }
+
+        for (int i = 0; i < n; i++) {
+            if (tail[i] != (i + n / 4) % n) {
+                return false;
+            }
+        }
+
+        CS_RANGE_TEST(tail.split(n + 1, seq), OutOfRange);
+        CS_RANGE_TEST(tail.concat(tail), LinkedListException);
+
+        // The moved nodes are freed by the one that has them
+        tail.split(0, seq);
+        return (tail.size() == 0 && seq.size() == n && seq[n - 1] == n / 4 - 1);
+    }
+
+    // Copies are deep and keep their order
+    int Sequence_test3() {
+        Sequence<int> seq;
+        for (int i = 0; i < 100; i++) {
+            seq.insert(i, 0);
+        }
+
+        Sequence<int> copy = seq;
+        seq.swap(0, 99);
+        seq.remove(50);
+
+        int expected = 99;
+        for (Sequence<int>::Iterator it = copy.begin(); it != copy.end(); ++it) {
+            if (*it != expected) {
+                return false;
+            }
+            expected--;
+        }
+
+        copy = seq;
+        CS_RANGE_TEST(copy[99], OutOfRange);
+        CS_RANGE_TEST(copy.remove(99), OutOfRange);
+        CS_RANGE_TEST(copy.insert(0, 100), OutOfRange);
+
+        return (expected == -1 && copy.size() == 99 && copy[0] == 0 && copy[98] == 99);
+    }
+
+    // Joining many small sequences still gives a balanced tree
+    int Sequence_test4() {
+        constexpr int n = 100000;
+        Sequence<int> seq;
+        for (int i = 0; i < n; i++) {
+            Sequence<int> piece;
+            piece.append(i);
+            seq.concat(piece);
+        }
+
+        for (int i = 0; i < n; i += 97) {
+            if (seq[i] != i) {
+                return false;
+            }
+        }
+
+        Sequence<int> tail;
+        seq.split(n / 2, tail);
+        tail.concat(seq);
+        return (tail.size() == (size_t)n && tail[0] == n / 2 && tail[n - 1] == n / 2 - 1);
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 4;
+    testf_t test[TEST_SIZE] = {
+        Sequence_test1,
+        Sequence_test2,
+        Sequence_test3,
+        Sequence_test4
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include "SpscQueue.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+namespace cslib {
+    // Filling, wrapping and batches on one thread
+    int SpscQueue_test1() {
+        SpscQueue<int> q(100);
+        if (q.capacity() != 128 || !q.empty()) {
+            return false;
+        }
+
+        // Go around the ring a few times
+        int next = 0;
+        int expected = 0;
+        for (int round = 0; round < 5; round++) {
+            while (q.tryPush(next)) {
+                next++;
+            }
+            if (q.size() != 128) {
+                return false;
+            }
+
+            int value = 0;
+            for (int i = 0; i < 100; i++) {
+                if (!q.tryPop(value) || value != expected++) {
+                    return false;
+                }
+            }
+        }
+
+        // Batches only take what fits and what's there
+        int values[200];
+        for (int i = 0; i < 200; i++) {
+            values[i] = next + i;
+        }
+        if (q.pushMany(values, 200) != 100) {
+            return false;
+        }
+        next += 100;
+
+        int popped[200];
+        size_t count = q.popMany(popped, 200);
+        for (size_t i = 0; i < count; i++) {
+            if (popped[i] != expected++) {
+                return false;
+            }
+        }
+
+        int value = 0;
+        return (count == 128 && expected == next && q.empty() && !q.tryPop(value) && q.popMany(popped, 10) == 0);
+    }
+
+    // Everything comes out in order across threads
+    int SpscQueue_test2() {
+        constexpr int n = 200000;
+        SpscQueue<int> q(64);
+
+        std::thread producer([&q]() {
+            int batch[16];
+            int i = 0;
+            while (i < n) {
+                // Mix single and batched pushes
+                if (i % 3 == 0) {
+                    if (q.tryPush(i)) {
+                        i++;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                    continue;
+                }
+
+                int count = (n - i < 16) ? n - i : 16;
+                for (int j = 0; j < count; j++) {
+                    batch[j] = i + j;
+                }
+                size_t pushed = q.pushMany(batch, count);
+                if (pushed == 0) {
+                    std::this_thread::yield();
+                }
+                i += (int)pushed;
+            }
+        });
+
+        bool ordered = true;
+        int expected = 0;
+        int batch[16];
+        while (expected < n) {
+            int value = 0;
+            if (expected % 2 == 0) {
+                if (q.tryPop(value)) {
+                    ordered = ordered && (value == expected);
+                    expected++;
+                } else {
+                    std::this_thread::yield();
+                }
+                continue;
+            }
+
+            size_t count = q.popMany(batch, 16);
+            if (count == 0) {
+                std::this_thread::yield();
+            }
+            for (size_t i = 0; i < count; i++) {
+                ordered = ordered && (batch[i] == expected);
+                expected++;
+            }
+        }
+        producer.join();
+
+        return (ordered && q.empty());
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 2;
+    testf_t test[TEST_SIZE] = {
+        SpscQueue_test1,
+        SpscQueue_test2
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
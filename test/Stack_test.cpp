@@ -60,7 +60,70 @@ namespace cslib {
         return true;
     }
 
+    // Array backed push, pop and walk across chunks
+    int Stack_test4() {
+        constexpr size_t n = 5000;
+        Stack<int, ArrayStack<int>> s;
 
+        for (size_t i = 0; i < n; i++) {
+            s.push(i);
+        }
+        if (s.size() != n || s.top() != n - 1) {
+            return false;
+        }
+
+        // Top to bottom
+        int expected = n - 1;
+        for (Stack<int, ArrayStack<int>>::ConstIterator it = s.cbegin(); it != s.cend(); ++it) {
+            if (*it != expected) {
+                return false;
+            }
+            expected--;
+        }
+
+        // Copies are deep
+        Stack<int, ArrayStack<int>> copy = s;
+        for (size_t i = 0; i < n; i++) {
+            if (s.pop() != (int)(n - i - 1)) {
+                return false;
+            }
+        }
+
+        CS_RANGE_TEST(s.pop(), StackUnderflow);
+        CS_RANGE_TEST(s.top(), StackUnderflow);
+
+        return (expected == -1 && s.empty() && copy.size() == n && copy.top() == n - 1);
+    }
+
+    // Array backed bulk push and pop
+    int Stack_test5() {
+        constexpr size_t n = 1000;
+        int values[n];
+        for (size_t i = 0; i < n; i++) {
+            values[i] = i;
+        }
+
+        Stack<int, ArrayStack<int>> s;
+        s.reserve(n);
+        s.push(-1);
+        s.pushMany(values, n);
+
+        // Pop in pieces, across the chunk edges
+        int popped[n];
+        size_t total = 0;
+        while (total < n) {
+            size_t count = s.popMany(popped, 8);
+            for (size_t i = 0; i < count; i++) {
+                if (popped[i] != (int)(n - total - i - 1)) {
+                    return false;
+                }
+            }
+            total += count;
+        }
+
+        // Asking for more than there is gives what's left
+        return (s.popMany(popped, 10) == 1 && popped[0] == -1 && s.empty() && s.popMany(popped, 10) == 0);
+    }
 }
 
 
@@ -70,11 +133,13 @@ typedef int(*testf_t)(void);
 int main() {
     using namespace cslib;
 
-    constexpr size_t TEST_SIZE = 3;
+    constexpr size_t TEST_SIZE = 5;
     testf_t test[TEST_SIZE] = {
         Stack_test1,
         Stack_test2,
-        Stack_test3
+        Stack_test3,
+        Stack_test4,
+        Stack_test5
     };
     
     for (int i = 0; i < TEST_SIZE; i++) {
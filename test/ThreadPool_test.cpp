@@ -0,0 +1,126 @@
+#include "ThreadPool.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace cslib {
+    /**
+     * @fn ThreadPool_fib
+     * @brief Fibonacci, forking both halves until they're small
+     */
+    long long ThreadPool_fib(ThreadPool& p_pool, int p_n) {
+        if (p_n < 15) {
+            return (p_n < 2) ? p_n : ThreadPool_fib(p_pool, p_n - 1) + ThreadPool_fib(p_pool, p_n - 2);
+        }
+
+        long long left = 0;
+        TaskGroup group;
+        p_pool.spawn(group, [&p_pool, &left, p_n]() {
+            left = ThreadPool_fib(p_pool, p_n - 1);
+        });
+        long long right = ThreadPool_fib(p_pool, p_n - 2);
+        p_pool.sync(group);
+        return left + right;
+    }
+
+    // Futures, fork-join and exceptions
+    int ThreadPool_test1() {
+        ThreadPool pool(4);
+        if (pool.threads() != 4 || ThreadPool::instance().threads() == 0) {
+            return false;
+        }
+
+        std::future<int> answer = pool.submit([]() { return 6 * 7; });
+        std::future<void> thrown = pool.submit([]() { throw OutOfRange(); });
+        if (answer.get() != 42) {
+            return false;
+        }
+        CS_RANGE_TEST(thrown.get(), OutOfRange);
+
+        // From outside the pool and from inside it
+        if (ThreadPool_fib(pool, 25) != 75025) {
+            return false;
+        }
+        std::future<long long> inside = pool.submit([&pool]() { return ThreadPool_fib(pool, 22); });
+        if (inside.get() != 17711) {
+            return false;
+        }
+
+        // The first exception comes out of sync, after everything else has run
+        std::atomic<int> ran{ 0 };
+        TaskGroup group;
+        for (int i = 0; i < 100; i++) {
+            pool.spawn(group, [&ran, i]() {
+                ran++;
+                if (i == 50) {
+                    throw OutOfRange();
+                }
+            });
+        }
+        CS_RANGE_TEST(pool.sync(group), OutOfRange);
+        pool.sync(group);
+
+        return (ran == 100 && group.done());
+    }
+
+    // parallelFor on every index once, nested and with any grain
+    int ThreadPool_test2() {
+        constexpr size_t n = 100000;
+        ThreadPool pool(4);
+        std::atomic<int>* hits = new std::atomic<int>[n]();
+
+        size_t grains[] = { 0, 1, 7, 1000, n * 2 };
+        for (size_t g = 0; g < sizeof(grains) / sizeof(grains[0]); g++) {
+            pool.parallelFor(0, n, [hits](size_t i) {
+                hits[i]++;
+            }, grains[g]);
+        }
+        pool.parallelFor(5, 5, [hits](size_t i) {
+            hits[i] += 100;
+        });
+
+        bool once = true;
+        for (size_t i = 0; i < n; i++) {
+            if (hits[i] != 5) {
+                once = false;
+            }
+        }
+        delete[] hits;
+
+        // Rows in parallel, each row in parallel again
+        constexpr size_t rows = 200;
+        constexpr size_t columns = 300;
+        std::atomic<long long> sum{ 0 };
+        pool.parallelFor(0, rows, [&pool, &sum](size_t row) {
+            pool.parallelFor(0, columns, [&sum, row](size_t column) {
+                sum += (long long)(row * columns + column);
+            });
+        });
+
+        long long total = (long long)(rows * columns);
+        return (once && sum == total * (total - 1) / 2);
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 2;
+    testf_t test[TEST_SIZE] = {
+        ThreadPool_test1,
+        ThreadPool_test2
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include "UnrolledList.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace cslib {
+
+    /**
+     * @class UnrolledList_testCursor
+     * @brief Reaches the cursor so tests can see when it moves
+     */
+    struct UnrolledList_testCursor : public UnrolledList<int> {
+        bool at(size_t p_index) const {
+            return (this->m_cursor != nullptr && this->m_cursorIndex == p_index);
+        }
+    };
+
+    // Append and read back
+    int UnrolledList_test1() {
+        constexpr size_t n = 4096;
+        UnrolledList<int> ul;
+
+        for (size_t i = 0; i < n; i++) {
+            ul.append(i);
+        }
+
+        if (ul.size() != n) {
+            return false;
+        }
+
+        // By index
+        for (size_t i = 0; i < n; i++) {
+            if (ul[i] != (int)i) {
+                return false;
+            }
+        }
+
+        // By iterator
+        size_t i = 0;
+        for (UnrolledList<int>::ConstIterator it = ul.cbegin(); it != ul.cend(); ++it) {
+            if (*it != (int)i) {
+                return false;
+            }
+            i++;
+        }
+
+        return (i == n);
+    }
+
+    // Inserts and removes anywhere
+    int UnrolledList_test2() {
+        constexpr size_t n = 2048;
+        int expected[n];
+        size_t size = 0;
+        UnrolledList<int> ul;
+
+        unsigned int seed = 777;
+        for (size_t step = 0; step < 8 * n; step++) {
+            seed = seed * 1103515245 + 12345;
+            size_t r = (seed >> 8);
+
+            if (size == 0 || (r % 2 == 0 && size < n)) {
+                size_t at = r % (size + 1);
+                ul.insert((int)step, at);
+                for (size_t i = size; i > at; i--) {
+                    expected[i] = expected[i - 1];
+                }
+                expected[at] = (int)step;
+                size++;
+            } else {
+                size_t at = r % size;
+                if (ul.remove(at) != expected[at]) {
+                    return false;
+                }
+                for (size_t i = at; i + 1 < size; i++) {
+                    expected[i] = expected[i + 1];
+                }
+                size--;
+            }
+        }
+
+        if (ul.size() != size) {
+            return false;
+        }
+
+        size_t i = 0;
+        for (UnrolledList<int>::Iterator it = ul.begin(); it != ul.end(); ++it) {
+            if (*it != expected[i]) {
+                return false;
+            }
+            i++;
+        }
+
+        return (i == size);
+    }
+
+    // Copies, swaps and empty lists
+    int UnrolledList_test3() {
+        UnrolledList<char> ul;
+        char str[] = "Hello World!";
+        const size_t n = strlen(str);
+        for (size_t i = 0; i < n; i++) {
+            ul.append(str[i]);
+        }
+
+        UnrolledList<char> copy = ul;
+        for (size_t i = 0; i < (n / 2); i++) {
+            copy.swap(i, n - i - 1);
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            if (copy[i] != str[n - i - 1] || ul[i] != str[i]) {
+                return false;
+            }
+        }
+
+        while (ul.size() != 0) {
+            ul.remove(ul.size() - 1);
+        }
+
+        CS_RANGE_TEST(ul.remove(0), OutOfRange);
+        CS_RANGE_TEST(ul[0], OutOfRange);
+
+        return (ul.cbegin() == ul.cend());
+    }
+
+    // Const indexing reads the cursor but never moves it
+    int UnrolledList_test4() {
+        constexpr size_t n = 1024;
+        UnrolledList_testCursor ul;
+        for (size_t i = 0; i < n; i++) {
+            ul.append(i);
+        }
+
+        // Park the cursor on the node holding the first value
+        ul[0] = 0;
+        if (!ul.at(0)) {
+            return false;
+        }
+
+        const UnrolledList<int>& reader = ul;
+        for (size_t i = n; i > 0; i--) {
+            if (reader[i - 1] != (int)i - 1 || !ul.at(0)) {
+                return false;
+            }
+        }
+
+        // Non-const indexing still moves it
+        ul[n - 1] = 0;
+        return (!ul.at(0) && reader[n - 1] == 0);
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 4;
+    testf_t test[TEST_SIZE] = {
+        UnrolledList_test1,
+        UnrolledList_test2,
+        UnrolledList_test3,
+        UnrolledList_test4
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
@@ -1,4 +1,5 @@
 #include "Vector.h"
+#include "VectorLoader.h"
 #include "Test.h"
 
 #include <stdio.h>
@@ -179,12 +180,78 @@ namespace cslib {
 
         return true;
     }
+
+    // Parsing integers
+    int Vector_test10() {
+        const char text[] = "12, -7,0\n123456789012,  +42\n-9223372036854775808";
+        const int64_t expected[] = { 12, -7, 0, 123456789012LL, 42, INT64_MIN };
+        constexpr size_t n = 6;
+
+        Vector<int64_t> v;
+        if (Vector_parse(text, strlen(text), v) != n || v.size() != n) {
+            return false;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            if (v[i] != expected[i]) {
+                return false;
+            }
+        }
+
+        // Every 20 digit value that fits
+        Vector<uint64_t> u;
+        Vector_parse("18446744073709551615 10000000000000000000", 41, u, ' ');
+        if (u.size() != 2 || u[0] != UINT64_MAX || u[1] != 10000000000000000000ULL) {
+            return false;
+        }
+        CS_RANGE_TEST(Vector_parse("18446744073709551616", 20, u), ParseInvalidNumber);
+        CS_RANGE_TEST(Vector_parse("100000000000000000000", 21, u), ParseInvalidNumber);
+
+        // Bad tokens and overflows, nothing is kept
+        Vector<int> bad;
+        bad.push(5);
+        CS_RANGE_TEST(Vector_parse("1,2x,3", 6, bad), ParseInvalidNumber);
+        CS_RANGE_TEST(Vector_parse("2147483648", 10, bad), ParseInvalidNumber);
+
+        return (u.size() == 2 && bad.size() == 1 && bad[0] == 5);
+    }
+
+    // Parsing floats
+    int Vector_test11() {
+        // Big enough to be split across threads
+        constexpr size_t n = 300000;
+        char* text = new char[n * 16];
+        size_t length = 0;
+        for (size_t i = 0; i < n; i++) {
+            length += sprintf(text + length, "%zu.25 ", i);
+        }
+
+        Vector<double> v;
+        v.push(-1.0);
+        size_t added = Vector_parse(text, length, v, ' ');
+        delete[] text;
+
+        if (added != n || v.size() != n + 1 || v[0] != -1.0) {
+            return false;
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            if (v[i + 1] != (double)i + 0.25) {
+                return false;
+            }
+        }
+
+        // Exactly rounded
+        Vector<float> f;
+        Vector_parse("0.1;3.4028235e38", 16, f, ';');
+        return (f[0] == 0.1f && f[1] == 3.4028235e38f);
+    }
 }
 
 int main() {
     using namespace cslib;
 
-    constexpr size_t TEST_SIZE = 9;
+    constexpr size_t TEST_SIZE = 11;
     testf_t test[TEST_SIZE] = {
         Vector_test1,
         Vector_test2,
@@ -194,7 +261,9 @@ int main() {
         Vector_test6,
         Vector_test7,
         Vector_test8,
-        Vector_test9
+        Vector_test9,
+        Vector_test10,
+        Vector_test11
     };
 
     for (int i = 0; i < TEST_SIZE; i++) {
@@ -0,0 +1,131 @@
+#include "WorkStealingDeque.h"
+#include "Test.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+namespace cslib {
+    // The owner gets the newest back, thieves the oldest, across growing
+    int WorkStealingDeque_test1() {
+        constexpr int n = 1000;
+        WorkStealingDeque<int> d;
+        int value = 0;
+        if (d.pop(value) || d.steal(value) || !d.empty()) {
+            return false;
+        }
+
+        for (int i = 0; i < n; i++) {
+            d.push(i);
+        }
+        if (d.size() != n || d.capacity() < n) {
+            return false;
+        }
+
+        // Both ends at once, they meet in the middle
+        for (int i = 0; i < n / 2; i++) {
+            if (!d.steal(value) || value != i) {
+                return false;
+            }
+            if (!d.pop(value) || value != n - 1 - i) {
+                return false;
+            }
+        }
+        if (d.pop(value) || d.steal(value) || !d.empty()) {
+            return false;
+        }
+
+        // Wrapping around the array
+        for (int i = 0; i < 10 * n; i++) {
+            d.push(i);
+            if (!d.steal(value) || value != i) {
+                return false;
+            }
+        }
+        return d.empty();
+    }
+
+    // Thieves race the owner, every value is taken exactly once
+    int WorkStealingDeque_test2() {
+        constexpr int thieves = 3;
+        constexpr int n = 100000;
+        WorkStealingDeque<int> d(2);
+        std::atomic<int>* taken = new std::atomic<int>[n]();
+        std::atomic<bool> done{ false };
+
+        std::thread* workers = new std::thread[thieves];
+        for (int t = 0; t < thieves; t++) {
+            workers[t] = std::thread([&d, &done, taken]() {
+                int value = 0;
+                while (!done.load() || !d.empty()) {
+                    if (d.steal(value)) {
+                        taken[value]++;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        // Bursts of pushes, then the owner takes some back itself
+        unsigned int seed = 7;
+        int pushed = 0;
+        int value = 0;
+        while (pushed < n) {
+            seed = seed * 1103515245 + 12345;
+            int burst = (int)((seed >> 8) % 64) + 1;
+            for (int i = 0; i < burst && pushed < n; i++) {
+                d.push(pushed++);
+            }
+
+            seed = seed * 1103515245 + 12345;
+            int pops = (int)((seed >> 8) % 64);
+            for (int i = 0; i < pops; i++) {
+                if (d.pop(value)) {
+                    taken[value]++;
+                }
+            }
+        }
+        while (d.pop(value)) {
+            taken[value]++;
+        }
+        done = true;
+
+        for (int t = 0; t < thieves; t++) {
+            workers[t].join();
+        }
+        delete[] workers;
+
+        bool once = true;
+        for (int i = 0; i < n; i++) {
+            if (taken[i] != 1) {
+                once = false;
+            }
+        }
+        delete[] taken;
+
+        return (once && d.empty());
+    }
+}
+
+
+
+int main() {
+    using namespace cslib;
+
+    constexpr size_t TEST_SIZE = 2;
+    testf_t test[TEST_SIZE] = {
+        WorkStealingDeque_test1,
+        WorkStealingDeque_test2
+    };
+
+    for (int i = 0; i < TEST_SIZE; i++) {
+        int result = test[i]();
+        cslib::Datastructure_test(i + 1, result);
+        if (!result) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}